@@ -24,6 +24,11 @@
 #endif
 
 #if defined(CONFIG_NATIVE_POSIX_STDOUT_CONSOLE)
+static int native_posix_str_out(const char *str, size_t len)
+{
+	return fwrite(str, 1, len, stdout);
+}
+
 /**
  *
  * @brief Initialize the driver that provides the printk output
@@ -41,6 +46,10 @@ static void native_posix_stdout_init(void)
 
 	extern void __printk_hook_install(int (*fn)(int));
 	__printk_hook_install(putchar);
+
+	extern void __printk_str_hook_install(
+		int (*fn)(const char *str, size_t len));
+	__printk_str_hook_install(native_posix_str_out);
 }
 
 /**
@@ -16,6 +16,7 @@
 #include <SEGGER_RTT.h>
 
 extern void __printk_hook_install(int (*fn)(int));
+extern void __printk_str_hook_install(int (*fn)(const char *str, size_t len));
 extern void __stdout_hook_install(int (*fn)(int));
 
 static bool host_present;
@@ -34,15 +35,15 @@ static void wait(void)
 	}
 }
 
-static int rtt_console_out(int character)
+static int rtt_console_str_out(const char *str, size_t len)
 {
-	char c = (char)character;
+	size_t done = 0;
 	unsigned int cnt;
 	int max_cnt = CONFIG_RTT_TX_RETRY_CNT;
 
-	do {
+	while (done < len) {
 		SEGGER_RTT_LOCK();
-		cnt = SEGGER_RTT_WriteNoLock(0, &c, 1);
+		cnt = SEGGER_RTT_WriteNoLock(0, &str[done], len - done);
 		SEGGER_RTT_UNLOCK();
 
 		/* There are two possible reasons for not writing any data to
@@ -60,20 +61,28 @@ static int rtt_console_out(int character)
 		 * The host is marked as active if the attempt is successful.
 		 */
 		if (cnt) {
-			/* byte processed - host is present. */
+			/* data processed - host is present. */
 			host_present = true;
-		} else if (host_present) {
-			if (max_cnt) {
-				wait();
-				max_cnt--;
-				continue;
-			} else {
-				host_present = false;
-			}
+			done += cnt;
+			continue;
+		} else if (host_present && max_cnt) {
+			wait();
+			max_cnt--;
+			continue;
 		}
 
+		host_present = false;
 		break;
-	} while (1);
+	}
+
+	return len;
+}
+
+static int rtt_console_out(int character)
+{
+	char c = (char)character;
+
+	(void)rtt_console_str_out(&c, 1);
 
 	return character;
 }
@@ -83,6 +92,7 @@ static int rtt_console_init(const struct device *d)
 	ARG_UNUSED(d);
 
 	__printk_hook_install(rtt_console_out);
+	__printk_str_hook_install(rtt_console_str_out);
 	__stdout_hook_install(rtt_console_out);
 
 	return 0;
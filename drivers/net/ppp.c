@@ -28,7 +28,6 @@ LOG_MODULE_REGISTER(net_ppp, LOG_LEVEL);
 #include <zephyr/net/net_if.h>
 #include <zephyr/net/net_core.h>
 #include <zephyr/sys/ring_buffer.h>
-#include <zephyr/sys/crc.h>
 #include <zephyr/drivers/uart.h>
 #include <zephyr/drivers/console/uart_mux.h>
 #include <zephyr/random/rand32.h>
@@ -36,6 +35,8 @@ LOG_MODULE_REGISTER(net_ppp, LOG_LEVEL);
 #include "../../subsys/net/ip/net_stats.h"
 #include "../../subsys/net/ip/net_private.h"
 
+#include "ppp_hdlc.h"
+
 #define UART_BUF_LEN CONFIG_NET_PPP_UART_BUF_LEN
 #define UART_TX_BUF_LEN CONFIG_NET_PPP_ASYNC_UART_TX_BUF_LEN
 
@@ -93,13 +94,15 @@ struct ppp_driver_context {
 #endif
 	enum ppp_driver_state state;
 
+	/* Unescaping state and FCS of the frame being received */
+	struct ppp_hdlc_rx rx;
+
 #if defined(CONFIG_PPP_CLIENT_CLIENTSERVER)
 	/* correctly received CLIENT bytes */
 	uint8_t client_index;
 #endif
 
 	uint8_t init_done : 1;
-	uint8_t next_escaped : 1;
 };
 
 static struct ppp_driver_context ppp_driver_context_data;
@@ -253,7 +256,8 @@ static void uart_recovery(struct k_work *work)
 }
 #endif
 
-static int ppp_save_byte(struct ppp_driver_context *ppp, uint8_t byte)
+static int ppp_save_bytes(struct ppp_driver_context *ppp,
+			  const uint8_t *data, size_t len)
 {
 	int ret;
 
@@ -276,15 +280,16 @@ static int ppp_save_byte(struct ppp_driver_context *ppp, uint8_t byte)
 	 * needed. Normally it would just print too much data.
 	 */
 	if (0) {
-		LOG_DBG("Saving byte %02x", byte);
+		LOG_HEXDUMP_DBG(data, len, "Saving");
 	}
 
 	/* This is not very intuitive but we must allocate new buffer
 	 * before we write a byte to last available cursor position.
 	 */
-	if (ppp->available == 1) {
+	if (ppp->available <= len) {
 		ret = net_pkt_alloc_buffer(ppp->pkt,
-					   CONFIG_NET_BUF_DATA_SIZE,
+					   MAX(len + 1,
+					       CONFIG_NET_BUF_DATA_SIZE),
 					   AF_UNSPEC, K_NO_WAIT);
 		if (ret < 0) {
 			LOG_ERR("[%p] cannot allocate new data buffer", ppp);
@@ -294,17 +299,15 @@ static int ppp_save_byte(struct ppp_driver_context *ppp, uint8_t byte)
 		ppp->available = net_pkt_available_buffer(ppp->pkt);
 	}
 
-	if (ppp->available) {
-		ret = net_pkt_write_u8(ppp->pkt, byte);
-		if (ret < 0) {
-			LOG_ERR("[%p] Cannot write to pkt %p (%d)",
-				ppp, ppp->pkt, ret);
-			goto out_of_mem;
-		}
-
-		ppp->available--;
+	ret = net_pkt_write(ppp->pkt, data, len);
+	if (ret < 0) {
+		LOG_ERR("[%p] Cannot write to pkt %p (%d)",
+			ppp, ppp->pkt, ret);
+		goto out_of_mem;
 	}
 
+	ppp->available -= len;
+
 	return 0;
 
 out_of_mem:
@@ -402,6 +405,32 @@ static int ppp_send_bytes(struct ppp_driver_context *ppp,
 	return off;
 }
 
+/* Escape data into the send buffer, flushing it whenever it gets full, and
+ * update the FCS over the data.
+ */
+static int ppp_send_escaped(struct ppp_driver_context *ppp,
+			    const uint8_t *data, size_t len, int off,
+			    uint16_t *fcs)
+{
+	size_t consumed;
+
+	while (len > 0) {
+		consumed = len;
+
+		off += ppp_hdlc_escape(data, &consumed, &ppp->send_buf[off],
+				       sizeof(ppp->send_buf) - off, fcs);
+
+		data += consumed;
+		len -= consumed;
+
+		if (len > 0 || off >= sizeof(ppp->send_buf)) {
+			off = ppp_send_flush(ppp, off);
+		}
+	}
+
+	return off;
+}
+
 #if defined(CONFIG_PPP_CLIENT_CLIENTSERVER)
 
 #define CLIENT "CLIENT"
@@ -436,10 +465,11 @@ static void ppp_handle_client(struct ppp_driver_context *ppp, uint8_t byte)
 }
 #endif
 
-static int ppp_input_byte(struct ppp_driver_context *ppp, uint8_t byte)
+/* Handle the frame start and address bytes, the rest of the frame is
+ * processed by ppp_input().
+ */
+static void ppp_input_byte(struct ppp_driver_context *ppp, uint8_t byte)
 {
-	int ret = -EAGAIN;
-
 	switch (ppp->state) {
 	case STATE_HDLC_FRAME_START:
 		/* Synchronizing the flow with HDLC flag field */
@@ -460,7 +490,7 @@ static int ppp_input_byte(struct ppp_driver_context *ppp, uint8_t byte)
 			/* Check if we need to sync again */
 			if (byte == 0x7e) {
 				/* Just skip to the start of the pkt byte */
-				return -EAGAIN;
+				return;
 			}
 
 			LOG_DBG("Invalid (0x%02x) byte, expecting Address",
@@ -479,43 +509,12 @@ static int ppp_input_byte(struct ppp_driver_context *ppp, uint8_t byte)
 			 * the FCS. The address field will not be passed
 			 * to upper stack.
 			 */
-			ret = ppp_save_byte(ppp, byte);
-			if (ret < 0) {
-				ppp_change_state(ppp, STATE_HDLC_FRAME_START);
-			}
-
-			ret = -EAGAIN;
-		}
-
-		break;
+			ppp->rx.fcs = ppp_hdlc_fcs(PPP_HDLC_FCS_INIT, &byte, 1);
+			ppp->rx.escaped = false;
 
-	case STATE_HDLC_FRAME_DATA:
-		/* If the next frame starts, then send this one
-		 * up in the network stack.
-		 */
-		if (byte == 0x7e) {
-			LOG_DBG("End of pkt (0x%02x)", byte);
-			ppp_change_state(ppp, STATE_HDLC_FRAME_ADDRESS);
-			ret = 0;
-		} else {
-			if (byte == 0x7d) {
-				/* RFC 1662, ch. 4.2 */
-				ppp->next_escaped = true;
-				break;
-			}
-
-			if (ppp->next_escaped) {
-				/* RFC 1662, ch. 4.2 */
-				byte ^= 0x20;
-				ppp->next_escaped = false;
-			}
-
-			ret = ppp_save_byte(ppp, byte);
-			if (ret < 0) {
+			if (ppp_save_bytes(ppp, &byte, 1) < 0) {
 				ppp_change_state(ppp, STATE_HDLC_FRAME_START);
 			}
-
-			ret = -EAGAIN;
 		}
 
 		break;
@@ -524,30 +523,57 @@ static int ppp_input_byte(struct ppp_driver_context *ppp, uint8_t byte)
 		LOG_ERR("[%p] Invalid state %d", ppp, ppp->state);
 		break;
 	}
-
-	return ret;
 }
 
-static bool ppp_check_fcs(struct ppp_driver_context *ppp)
+/* Feed received data to the HDLC deframer. The frame data is unescaped in
+ * place and appended to the pkt in bulk. Returns the number of bytes
+ * consumed, which is less than len if a frame ended before that.
+ */
+static size_t ppp_input(struct ppp_driver_context *ppp, uint8_t *data,
+			size_t len, bool *frame_end)
 {
-	struct net_buf *buf;
-	uint16_t crc;
+	size_t i = 0, consumed, out_len;
+	bool end;
 
-	buf = ppp->pkt->buffer;
-	if (!buf) {
-		return false;
-	}
+	*frame_end = false;
 
-	crc = crc16_ccitt(0xffff, buf->data, buf->len);
+	while (i < len) {
+		if (ppp->state != STATE_HDLC_FRAME_DATA) {
+			ppp_input_byte(ppp, data[i++]);
+			continue;
+		}
 
-	buf = buf->frags;
+		consumed = ppp_hdlc_unescape(&ppp->rx, &data[i], len - i,
+					     &out_len, &end);
+		if (out_len > 0 &&
+		    ppp_save_bytes(ppp, &data[i], out_len) < 0) {
+			ppp_change_state(ppp, STATE_HDLC_FRAME_START);
+		}
 
-	while (buf) {
-		crc = crc16_ccitt(crc, buf->data, buf->len);
-		buf = buf->frags;
+		i += consumed;
+
+		if (end) {
+			/* If the next frame starts, then send this one
+			 * up in the network stack.
+			 */
+			LOG_DBG("End of pkt (0x%02x)", PPP_HDLC_FLAG);
+			ppp_change_state(ppp, STATE_HDLC_FRAME_ADDRESS);
+			*frame_end = true;
+			break;
+		}
 	}
 
-	if (crc != 0xf0b8) {
+	return i;
+}
+
+static bool ppp_check_fcs(struct ppp_driver_context *ppp)
+{
+	/* The FCS is calculated while unescaping the received data, so
+	 * there is no need to go through the pkt again.
+	 */
+	uint16_t crc = ppp->rx.fcs;
+
+	if (crc != PPP_HDLC_FCS_GOOD) {
 		LOG_DBG("Invalid FCS (0x%x)", crc);
 #if defined(CONFIG_NET_STATISTICS_PPP)
 		ppp->stats.chkerr++;
@@ -605,36 +631,45 @@ static void ppp_process_msg(struct ppp_driver_context *ppp)
 	ppp->pkt = NULL;
 }
 
+/* Pass a received frame to the stack. Returns false if there was nothing
+ * to pass, empty or too short frames are ignored.
+ */
+static bool ppp_process_frame(struct ppp_driver_context *ppp)
+{
+	if (!ppp->pkt) {
+		return false;
+	}
+
+	if (net_pkt_get_len(ppp->pkt) <= 3) {
+		net_pkt_unref(ppp->pkt);
+		ppp->pkt = NULL;
+		return false;
+	}
+
+	ppp_process_msg(ppp);
+
+	return true;
+}
+
 #if defined(CONFIG_NET_TEST)
 static uint8_t *ppp_recv_cb(uint8_t *buf, size_t *off)
 {
 	struct ppp_driver_context *ppp =
 		CONTAINER_OF(buf, struct ppp_driver_context, buf);
-	size_t i, len = *off;
+	size_t i = 0, len = *off;
+	bool frame_end;
 
-	for (i = 0; i < *off; i++) {
-		if (0) {
-			/* Extra debugging can be enabled separately if really
-			 * needed. Normally it would just print too much data.
-			 */
-			LOG_DBG("[%zd] %02x", i, buf[i]);
-		}
+	while (i < len) {
+		i += ppp_input(ppp, &buf[i], len - i, &frame_end);
 
-		if (ppp_input_byte(ppp, buf[i]) == 0) {
-			/* Ignore empty or too short frames */
-			if (ppp->pkt && net_pkt_get_len(ppp->pkt) > 3) {
-				ppp_process_msg(ppp);
-				break;
-			}
+		if (frame_end && ppp_process_frame(ppp)) {
+			break;
 		}
 	}
 
-	if (i == *off) {
-		*off = 0;
-	} else {
-		*off = len - i - 1;
-
-		memmove(&buf[0], &buf[i + 1], *off);
+	*off = len - i;
+	if (*off > 0) {
+		memmove(&buf[0], &buf[i], *off);
 	}
 
 	return buf;
@@ -674,59 +709,16 @@ void ppp_driver_feed_data(uint8_t *data, int data_len)
 }
 #endif
 
-static bool calc_fcs(struct net_pkt *pkt, uint16_t *fcs, uint16_t protocol)
-{
-	struct net_buf *buf;
-	uint16_t crc;
-	uint16_t c;
-
-	buf = pkt->buffer;
-	if (!buf) {
-		return false;
-	}
-
-	/* HDLC Address and Control fields */
-	c = sys_cpu_to_be16(0xff << 8 | 0x03);
-
-	crc = crc16_ccitt(0xffff, (const uint8_t *)&c, sizeof(c));
-
-	if (protocol > 0) {
-		crc = crc16_ccitt(crc, (const uint8_t *)&protocol,
-				  sizeof(protocol));
-	}
-
-	while (buf) {
-		crc = crc16_ccitt(crc, buf->data, buf->len);
-		buf = buf->frags;
-	}
-
-	crc ^= 0xffff;
-	*fcs = crc;
-
-	return true;
-}
-
-static uint16_t ppp_escape_byte(uint8_t byte, int *offset)
-{
-	if (byte == 0x7e || byte == 0x7d || byte < 0x20) {
-		*offset = 0;
-		return (0x7d << 8) | (byte ^ 0x20);
-	}
-
-	*offset = 1;
-	return byte;
-}
-
 static int ppp_send(const struct device *dev, struct net_pkt *pkt)
 {
 	struct ppp_driver_context *ppp = dev->data;
 	struct net_buf *buf = pkt->buffer;
 	uint16_t protocol = 0;
+	static const uint8_t addr_ctrl[] = { 0xff, 0x03 };
 	int send_off = 0;
 	uint32_t sync_addr_ctrl;
-	uint16_t fcs, escaped;
+	uint16_t fcs, fcs_le, unused = 0U;
 	uint8_t byte;
-	int i, offset;
 
 #if defined(CONFIG_NET_TEST)
 	return 0;
@@ -766,26 +758,20 @@ static int ppp_send(const struct device *dev, struct net_pkt *pkt)
 		}
 	}
 
-	if (!calc_fcs(pkt, &fcs, protocol)) {
-		return -ENOMEM;
-	}
-
 	/* Sync, Address & Control fields */
 	sync_addr_ctrl = sys_cpu_to_be32(0x7e << 24 | 0xff << 16 |
 					 0x7d << 8 | 0x23);
 	send_off = ppp_send_bytes(ppp, (const uint8_t *)&sync_addr_ctrl,
 				  sizeof(sync_addr_ctrl), send_off);
 
+	/* The FCS is calculated while the data is escaped, the Address and
+	 * Control fields are already escaped above so add them here.
+	 */
+	fcs = ppp_hdlc_fcs(PPP_HDLC_FCS_INIT, addr_ctrl, sizeof(addr_ctrl));
+
 	if (protocol > 0) {
-		escaped = htons(ppp_escape_byte(protocol, &offset));
-		send_off = ppp_send_bytes(ppp, (uint8_t *)&escaped + offset,
-					  offset ? 1 : 2,
-					  send_off);
-
-		escaped = htons(ppp_escape_byte(protocol >> 8, &offset));
-		send_off = ppp_send_bytes(ppp, (uint8_t *)&escaped + offset,
-					  offset ? 1 : 2,
-					  send_off);
+		send_off = ppp_send_escaped(ppp, (const uint8_t *)&protocol,
+					    sizeof(protocol), send_off, &fcs);
 	}
 
 	/* Note that we do not print the first four bytes and FCS bytes at the
@@ -797,27 +783,17 @@ static int ppp_send(const struct device *dev, struct net_pkt *pkt)
 	}
 
 	while (buf) {
-		for (i = 0; i < buf->len; i++) {
-			/* Escape illegal bytes */
-			escaped = htons(ppp_escape_byte(buf->data[i], &offset));
-			send_off = ppp_send_bytes(ppp,
-						  (uint8_t *)&escaped + offset,
-						  offset ? 1 : 2,
-						  send_off);
-		}
-
+		send_off = ppp_send_escaped(ppp, buf->data, buf->len,
+					    send_off, &fcs);
 		buf = buf->frags;
 	}
 
-	escaped = htons(ppp_escape_byte(fcs, &offset));
-	send_off = ppp_send_bytes(ppp, (uint8_t *)&escaped + offset,
-				  offset ? 1 : 2,
-				  send_off);
-
-	escaped = htons(ppp_escape_byte(fcs >> 8, &offset));
-	send_off = ppp_send_bytes(ppp, (uint8_t *)&escaped + offset,
-				  offset ? 1 : 2,
-				  send_off);
+	/* FCS is sent least significant byte first, and it is not part of
+	 * the FCS calculation itself.
+	 */
+	fcs_le = sys_cpu_to_le16(fcs ^ 0xffff);
+	send_off = ppp_send_escaped(ppp, (const uint8_t *)&fcs_le,
+				    sizeof(fcs_le), send_off, &unused);
 
 	byte = 0x7e;
 	send_off = ppp_send_bytes(ppp, &byte, 1, send_off);
@@ -831,7 +807,8 @@ static int ppp_send(const struct device *dev, struct net_pkt *pkt)
 static int ppp_consume_ringbuf(struct ppp_driver_context *ppp)
 {
 	uint8_t *data;
-	size_t len, tmp;
+	size_t len, tmp, consumed;
+	bool frame_end;
 	int ret;
 
 	len = ring_buf_get_claim(&ppp->rx_ringbuf, &data,
@@ -848,14 +825,18 @@ static int ppp_consume_ringbuf(struct ppp_driver_context *ppp)
 
 	tmp = len;
 
+	/* The claimed data is unescaped in place as it is released from
+	 * the ring buffer right after this.
+	 */
 	do {
-		if (ppp_input_byte(ppp, *data++) == 0) {
-			/* Ignore empty or too short frames */
-			if (ppp->pkt && net_pkt_get_len(ppp->pkt) > 3) {
-				ppp_process_msg(ppp);
-			}
+		consumed = ppp_input(ppp, data, tmp, &frame_end);
+		if (frame_end) {
+			(void)ppp_process_frame(ppp);
 		}
-	} while (--tmp);
+
+		data += consumed;
+		tmp -= consumed;
+	} while (tmp);
 
 	ret = ring_buf_get_finish(&ppp->rx_ringbuf, len);
 	if (ret < 0) {
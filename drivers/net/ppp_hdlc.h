@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ *
+ * HDLC-like framing (RFC 1662) helpers for the PPP driver. The byte stream
+ * is escaped and unescaped in bulk, and the FCS is calculated in the same
+ * pass over the data.
+ */
+
+#ifndef ZEPHYR_DRIVERS_NET_PPP_HDLC_H_
+#define ZEPHYR_DRIVERS_NET_PPP_HDLC_H_
+
+#include <zephyr/types.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PPP_HDLC_FLAG     0x7e
+#define PPP_HDLC_ESCAPE   0x7d
+#define PPP_HDLC_XOR      0x20
+
+#define PPP_HDLC_FCS_INIT 0xffff
+#define PPP_HDLC_FCS_GOOD 0xf0b8
+
+/** Receive side unescaping state that is kept between input chunks. */
+struct ppp_hdlc_rx {
+	/** FCS calculated over the unescaped data so far */
+	uint16_t fcs;
+
+	/** The last byte of the previous chunk was an escape byte */
+	bool escaped;
+};
+
+/**
+ * @brief Update the 16-bit FCS with the given data.
+ *
+ * @param fcs Current FCS value, PPP_HDLC_FCS_INIT at frame start
+ * @param data Data to calculate the FCS over
+ * @param len Length of the data
+ *
+ * @return Updated FCS value
+ */
+uint16_t ppp_hdlc_fcs(uint16_t fcs, const uint8_t *data, size_t len);
+
+/**
+ * @brief Escape data for sending.
+ *
+ * Bytes 0x7e, 0x7d and all control characters below 0x20 are escaped.
+ * The FCS is updated over the unescaped bytes that were consumed.
+ *
+ * @param src Data to escape
+ * @param src_len Length of the data. On return, the number of bytes that
+ *        were consumed, which is less than the original value if the
+ *        destination buffer became full.
+ * @param dst Destination buffer
+ * @param dst_len Size of the destination buffer
+ * @param fcs FCS to update
+ *
+ * @return Number of bytes written to the destination buffer
+ */
+size_t ppp_hdlc_escape(const uint8_t *src, size_t *src_len,
+		       uint8_t *dst, size_t dst_len, uint16_t *fcs);
+
+/**
+ * @brief Unescape received data in place.
+ *
+ * Decoding stops after the first flag byte, which ends the frame. The FCS
+ * in the state is updated over the unescaped bytes.
+ *
+ * @param rx Receive state
+ * @param data Received data, overwritten with the unescaped bytes
+ * @param len Length of the received data
+ * @param out_len Number of unescaped bytes at the start of data on return
+ * @param end Set to true if a flag byte was found
+ *
+ * @return Number of received bytes consumed, including the flag byte
+ */
+size_t ppp_hdlc_unescape(struct ppp_hdlc_rx *rx, uint8_t *data, size_t len,
+			 size_t *out_len, bool *end);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_DRIVERS_NET_PPP_HDLC_H_ */
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_LOG_BACKEND_FS_H_
+#define ZEPHYR_LOG_BACKEND_FS_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief File system backend statistics. */
+struct log_backend_fs_stats {
+	/** Number of bytes written to the log files. */
+	uint32_t bytes;
+
+	/** Number of write operations. */
+	uint32_t writes;
+
+	/** Number of file synchronizations. */
+	uint32_t syncs;
+};
+
+/**
+ * @brief Write buffered output and synchronize the log file.
+ *
+ * Intended to be called before the system is suspended or powered off
+ * when CONFIG_LOG_BACKEND_FS_BUFFERED is enabled. Without buffering the
+ * log file is always synchronized and the function does nothing.
+ *
+ * @return 0 on success, negative error code otherwise.
+ */
+int log_backend_fs_sync(void);
+
+/**
+ * @brief Get the backend statistics.
+ *
+ * @param stats Statistics.
+ */
+void log_backend_fs_get_stats(struct log_backend_fs_stats *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_LOG_BACKEND_FS_H_ */
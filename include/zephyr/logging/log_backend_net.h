@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_LOG_BACKEND_NET_H_
+#define ZEPHYR_LOG_BACKEND_NET_H_
+
+#include <stdint.h>
+#include <zephyr/logging/log_backend.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Networking backend statistics. */
+struct log_backend_net_stats {
+	/** Number of messages sent to the server. */
+	uint32_t sent;
+
+	/** Number of datagrams sent to the server. */
+	uint32_t datagrams;
+
+	/** Number of messages that could not be sent. */
+	uint32_t dropped;
+
+	/** Number of messages truncated to fit in a datagram. */
+	uint32_t truncated;
+
+	/** Number of messages waiting to be sent. */
+	uint32_t queued;
+};
+
+/**
+ * @brief Get the networking backend.
+ *
+ * @return Backend instance.
+ */
+const struct log_backend *log_backend_net_get(void);
+
+/**
+ * @brief Send the collected messages.
+ *
+ * When CONFIG_LOG_BACKEND_NET_BATCH is enabled, messages are sent once
+ * the datagram is full or CONFIG_LOG_BACKEND_NET_BATCH_TIMEOUT has passed.
+ * This sends the collected messages right away. Without batching each
+ * message is sent when processed and the function does nothing.
+ *
+ * @return 0 on success, negative error code otherwise.
+ */
+int log_backend_net_flush(void);
+
+/**
+ * @brief Get the backend statistics.
+ *
+ * @param stats Statistics.
+ */
+void log_backend_net_get_stats(struct log_backend_net_stats *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_LOG_BACKEND_NET_H_ */
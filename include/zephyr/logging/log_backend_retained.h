@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_LOG_BACKEND_RETAINED_H_
+#define ZEPHYR_LOG_BACKEND_RETAINED_H_
+
+#include <zephyr/logging/log_backend.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Replay messages stored before reset to a backend.
+ *
+ * Messages stored in the retained RAM buffer before the last reset are
+ * validated and passed to the backend in the order they were logged.
+ * Messages are kept in the buffer, so they can be replayed again, until
+ * they are overwritten or log_backend_retained_clear() is called. Intended
+ * to be called early after boot, as new messages overwrite the oldest ones.
+ *
+ * @param backend Backend, e.g. UART or file system backend.
+ *
+ * @return Number of replayed messages or -EBUSY if replay is in progress.
+ */
+int log_backend_retained_replay(const struct log_backend *backend);
+
+/**
+ * @brief Discard all messages stored in the retained RAM buffer.
+ */
+void log_backend_retained_clear(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_LOG_BACKEND_RETAINED_H_ */
@@ -154,6 +154,20 @@ extern "C" {
 	)								    \
 	))
 
+/** @internal
+ * @brief Check if message is suppressed by rate limiting or deduplication.
+ *
+ * Called before the message is created.
+ *
+ * @param source Source descriptor passed to the message.
+ * @param level Message severity level.
+ * @param fmt Format string identifying the call site.
+ *
+ * @retval true Message shall be dropped.
+ * @retval false Message shall be logged.
+ */
+bool z_log_suppress(const void *source, uint8_t level, const char *fmt);
+
 /*****************************************************************************/
 /****************** Definitions used by minimal logging *********************/
 /*****************************************************************************/
@@ -237,6 +251,10 @@ static inline char z_log_minimal_level_to_char(int level)
 	int _mode; \
 	void *_src = IS_ENABLED(CONFIG_LOG_RUNTIME_FILTERING) ? \
 		(void *)_dsource : (void *)_source; \
+	if (IS_ENABLED(CONFIG_LOG_SUPPRESS) && !is_user_context && \
+	    z_log_suppress(_src, _level, GET_ARG_N(1, __VA_ARGS__))) { \
+		break; \
+	} \
 	Z_LOG_MSG2_CREATE(UTIL_NOT(IS_ENABLED(CONFIG_USERSPACE)), _mode, \
 			  CONFIG_LOG_DOMAIN_ID, _src, _level, NULL,\
 			  0, __VA_ARGS__); \
@@ -312,6 +330,10 @@ static inline char z_log_minimal_level_to_char(int level)
 	int mode; \
 	void *_src = IS_ENABLED(CONFIG_LOG_RUNTIME_FILTERING) ? \
 		(void *)_dsource : (void *)_source; \
+	if (IS_ENABLED(CONFIG_LOG_SUPPRESS) && !is_user_context && \
+	    z_log_suppress(_src, _level, _str)) { \
+		break; \
+	} \
 	Z_LOG_MSG2_CREATE(UTIL_NOT(IS_ENABLED(CONFIG_USERSPACE)), mode, \
 			  CONFIG_LOG_DOMAIN_ID, _src, _level, \
 			  _data, _len, \
@@ -256,6 +256,38 @@ int log_mem_get_usage(uint32_t *buf_size, uint32_t *usage);
  */
 int log_mem_get_max_usage(uint32_t *max);
 
+/**
+ * @brief Set rate limit of a source.
+ *
+ * Requires CONFIG_LOG_RATELIMIT option. Limit applies to each call site of
+ * the source independently.
+ *
+ * @param domain_id ID of the domain.
+ * @param source_id Source (module or instance) ID.
+ * @param burst Maximum number of messages from a call site within
+ *		CONFIG_LOG_RATELIMIT_INTERVAL_MS. 0 disables rate limiting
+ *		of the source.
+ *
+ * @retval 0 on successful operation.
+ * @retval -ENOTSUP if feature is disabled.
+ * @retval -EINVAL if source ID is invalid.
+ * @retval -ENOMEM if CONFIG_LOG_RATELIMIT_MODULES sources have custom limit.
+ */
+int log_ratelimit_set(uint32_t domain_id, int16_t source_id, uint16_t burst);
+
+/**
+ * @brief Get number of suppressed messages.
+ *
+ * Requires CONFIG_LOG_RATELIMIT or CONFIG_LOG_DEDUP option.
+ *
+ * @param[out] ratelimited Number of messages dropped by rate limiting.
+ * @param[out] repeated Number of messages dropped as repeated.
+ *
+ * @retval -ENOTSUP if features are disabled.
+ * @retval 0 successfully collected counters.
+ */
+int log_suppressed_get(uint32_t *ratelimited, uint32_t *repeated);
+
 #if defined(CONFIG_LOG) && !defined(CONFIG_LOG_MODE_MINIMAL)
 #define LOG_CORE_INIT() log_core_init()
 #define LOG_PANIC() log_panic()
@@ -52,6 +52,9 @@ void z_log_runtime_filters_init(void);
 /* Notify log_core that a backend was enabled. */
 void z_log_notify_backend_enabled(void);
 
+/* Log pending report of repeated messages dropped by deduplication. */
+void z_log_suppress_flush(void);
+
 /** @brief Get pointer to the filter set of the log source.
  *
  * @param source_id Source ID.
@@ -193,6 +193,24 @@ void log_output_timestamp_freq_set(uint32_t freq);
  */
 uint64_t log_output_timestamp_to_us(uint32_t timestamp);
 
+/** @brief Select the message shared by the formatted message cache.
+ *
+ * Called by the logging core before a message is passed to the backends
+ * and with NULL once all backends processed it. Text of the selected
+ * message is formatted once and reused by every backend processing it
+ * with the same flags.
+ *
+ * @param msg Log message or NULL to stop caching.
+ */
+#ifdef CONFIG_LOG_OUTPUT_FORMAT_CACHE
+void z_log_output_cache_reset(struct log_msg2 *msg);
+#else
+static inline void z_log_output_cache_reset(struct log_msg2 *msg)
+{
+	ARG_UNUSED(msg);
+}
+#endif
+
 /**
  * @}
  */
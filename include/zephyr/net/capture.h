@@ -29,6 +29,7 @@ extern "C" {
 /** @cond INTERNAL_HIDDEN */
 
 struct net_if;
+struct net_pkt;
 
 struct net_capture_interface_api {
 	/** Cleanup the setup. This will also disable capturing. After this
@@ -252,6 +253,230 @@ static inline void net_capture_foreach(net_capture_cb_t cb, void *user_data)
 
 /** @endcond */
 
+/**
+ * @brief One instruction of a capture filter program.
+ *
+ * @details The layout and the opcodes are the same as in classic BPF, so
+ *          the output of "tcpdump -dd" can be used as a filter program.
+ *          Only a subset of the instructions is supported, see
+ *          net_capture_filter_set().
+ */
+struct net_capture_filter_insn {
+	uint16_t code;
+	uint8_t jt;
+	uint8_t jf;
+	uint32_t k;
+};
+
+/**
+ * @brief Set the filter that is run for every packet before it is captured.
+ *
+ * @details The program sees the packet data starting from the link layer
+ *          header, as the packet is given to the capture code. The return
+ *          value of the program tells how many bytes of the packet to
+ *          capture, 0 means that the packet is not captured at all.
+ *          Supported instructions are loads (absolute, indirect, length,
+ *          immediate and the IPv4 header length), ALU operations with a
+ *          constant, forward jumps, returns and register transfers.
+ *          The program is copied, so the caller does not need to keep it.
+ *
+ * @param prog Filter program, or NULL to capture all packets
+ * @param len Number of instructions in the program
+ *
+ * @return 0 if ok, -EINVAL if the program is invalid, -ENOMEM if it is
+ *         too long
+ */
+#if defined(CONFIG_NET_CAPTURE_FILTER)
+int net_capture_filter_set(const struct net_capture_filter_insn *prog,
+			   size_t len);
+#else
+static inline int net_capture_filter_set(
+				const struct net_capture_filter_insn *prog,
+				size_t len)
+{
+	ARG_UNUSED(prog);
+	ARG_UNUSED(len);
+
+	return -ENOTSUP;
+}
+#endif
+
+/** @cond INTERNAL_HIDDEN */
+
+/**
+ * @brief Run the capture filter for a packet.
+ *
+ * @param pkt The network packet to check
+ *
+ * @return Number of bytes to capture, 0 if the packet is not captured
+ */
+#if defined(CONFIG_NET_CAPTURE_FILTER)
+uint32_t net_capture_filter_run(struct net_pkt *pkt);
+#else
+static inline uint32_t net_capture_filter_run(struct net_pkt *pkt)
+{
+	ARG_UNUSED(pkt);
+
+	return UINT32_MAX;
+}
+#endif
+
+/** @endcond */
+
+/** Frame is owned by the capture code */
+#define NET_CAPTURE_FRAME_KERNEL 0
+/** Frame contains a captured packet and is owned by the reader */
+#define NET_CAPTURE_FRAME_USER   1
+
+/**
+ * @brief Frame in the capture ring.
+ *
+ * @details The ring is a fixed array of frames that is shared between
+ *          the capture code and a single reader. The reader looks at the
+ *          status of the next frame and hands it back after processing,
+ *          so no data is copied and no call is needed per frame when
+ *          there are packets in the ring.
+ */
+struct net_capture_frame {
+	/** NET_CAPTURE_FRAME_KERNEL or NET_CAPTURE_FRAME_USER */
+	atomic_t status;
+
+	/** Capture time in microseconds since boot */
+	uint64_t timestamp;
+
+	/** Length of the packet */
+	uint32_t len;
+
+	/** Number of bytes of the packet stored in data */
+	uint16_t caplen;
+
+	/** Index of the network interface the packet was captured on */
+	uint8_t iface;
+
+	/** Captured data */
+	uint8_t data[] __aligned(4);
+};
+
+/** Capture ring statistics */
+struct net_capture_ring_stats {
+	/** Packets stored to the ring */
+	uint32_t captured;
+
+	/** Packets dropped because the ring was full */
+	uint32_t dropped;
+
+	/** Packets rejected by the capture filter */
+	uint32_t filtered;
+};
+
+/**
+ * @typedef net_capture_write_cb_t
+ * @brief Callback used to write out the pcapng data.
+ *
+ * @param data Data to write
+ * @param len Length of the data
+ * @param user_data User supplied data
+ *
+ * @return 0 if ok, <0 if the data could not be written
+ */
+typedef int (*net_capture_write_cb_t)(const void *data, size_t len,
+				      void *user_data);
+
+#if defined(CONFIG_NET_CAPTURE_RING) || defined(__DOXYGEN__)
+/**
+ * @brief Start capturing packets to the capture ring.
+ *
+ * @param iface Network interface to capture, NULL to capture all of them
+ *
+ * @return 0 if ok, <0 if error
+ */
+int net_capture_ring_enable(struct net_if *iface);
+
+/**
+ * @brief Stop capturing packets to the capture ring.
+ *
+ * @details The frames that are already in the ring can still be read.
+ */
+void net_capture_ring_disable(void);
+
+/**
+ * @brief Check if capturing to the ring is enabled.
+ *
+ * @param iface Set to the captured interface, NULL if all interfaces
+ *        are captured. Can be NULL.
+ *
+ * @return true if enabled, false otherwise
+ */
+bool net_capture_ring_is_enabled(struct net_if **iface);
+
+/**
+ * @brief Get the next captured frame from the ring.
+ *
+ * @details The frame stays in the ring until it is released with
+ *          net_capture_ring_release(). Only one reader is supported, and
+ *          the frames must be released in the order they are returned.
+ *
+ * @param timeout How long to wait for a frame if the ring is empty
+ *
+ * @return Next frame, or NULL if there was none within the timeout
+ */
+struct net_capture_frame *net_capture_ring_get(k_timeout_t timeout);
+
+/**
+ * @brief Give a frame back to the capture ring.
+ *
+ * @param frame Frame returned by net_capture_ring_get()
+ */
+void net_capture_ring_release(struct net_capture_frame *frame);
+
+/**
+ * @brief Get the capture ring statistics.
+ *
+ * @param stats Statistics are copied here
+ */
+void net_capture_ring_get_stats(struct net_capture_ring_stats *stats);
+
+/**
+ * @brief Write the frames in the capture ring out in pcapng format.
+ *
+ * @details A section header and one interface description per network
+ *          interface are written first, followed by an enhanced packet
+ *          block for every frame in the ring. The frames are released
+ *          as they are written, so this acts as the ring reader.
+ *
+ * @param cb Callback that writes the data
+ * @param user_data User supplied data passed to the callback
+ *
+ * @return Number of frames written, <0 if the callback failed
+ */
+int net_capture_ring_export(net_capture_write_cb_t cb, void *user_data);
+#endif /* CONFIG_NET_CAPTURE_RING */
+
+/** @cond INTERNAL_HIDDEN */
+
+/**
+ * @brief Store a packet to the capture ring.
+ *
+ * @param iface Network interface of the packet
+ * @param pkt The network packet
+ * @param snaplen Maximum number of bytes to store
+ */
+#if defined(CONFIG_NET_CAPTURE_RING)
+void net_capture_ring_add(struct net_if *iface, struct net_pkt *pkt,
+			  uint32_t snaplen);
+#else
+static inline void net_capture_ring_add(struct net_if *iface,
+					struct net_pkt *pkt,
+					uint32_t snaplen)
+{
+	ARG_UNUSED(iface);
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(snaplen);
+}
+#endif
+
+/** @endcond */
+
 /**
  * @}
  */
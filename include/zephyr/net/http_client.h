@@ -23,6 +23,7 @@
 #include <zephyr/kernel.h>
 #include <zephyr/net/net_ip.h>
 #include <zephyr/net/http_parser.h>
+#include <zephyr/net/tls_credentials.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -93,6 +94,25 @@ typedef void (*http_response_cb_t)(struct http_response *rsp,
 				   enum http_final_call final_data,
 				   void *user_data);
 
+/**
+ * @typedef http_body_cb_t
+ * @brief Callback used to stream the response body to the application.
+ *
+ * The data pointer points directly into the receive buffer, so the body is
+ * handed over without being accumulated or copied by the HTTP client. The
+ * data is only valid for the duration of the callback.
+ *
+ * @param rsp HTTP response information
+ * @param data Pointer to the body fragment
+ * @param len Length of the body fragment
+ * @param user_data User specified data specified in http_client_req()
+ *
+ * @return 0 to continue receiving, <0 to abort the request.
+ */
+typedef int (*http_body_cb_t)(struct http_response *rsp,
+			      const uint8_t *data, size_t len,
+			      void *user_data);
+
 /**
  * HTTP response from the server.
  */
@@ -190,9 +210,15 @@ struct http_response {
 	 */
 	uint16_t http_status_code;
 
+	/** Set if the response has a Content-Length header */
 	uint8_t cl_present : 1;
 	uint8_t body_found : 1;
 	uint8_t message_complete : 1;
+
+	/** Set if the server allows the connection to be used for further
+	 * requests after this response (HTTP keep-alive).
+	 */
+	uint8_t keep_alive : 1;
 };
 
 /** HTTP client internal data that the application should not touch
@@ -220,6 +246,12 @@ struct http_client_internal_data {
 
 	/** Request timeout */
 	k_timeout_t timeout;
+
+	/** The request can still be retried by the connection pool: the
+	 * connection was reused and nothing has been received yet, so the
+	 * response callback has not been called.
+	 */
+	bool retry_on_close;
 };
 
 /**
@@ -246,6 +278,15 @@ struct http_request {
 	 */
 	const struct http_parser_settings *http_cb;
 
+	/** User supplied callback function to call for each received body
+	 * fragment. This is optional. If set, the body is streamed to the
+	 * application straight from the receive buffer and the receive
+	 * buffer is reused after every read, so the response callback is
+	 * only called once, with HTTP_DATA_FINAL, when the response is
+	 * complete.
+	 */
+	http_body_cb_t body_cb;
+
 	/** User supplied buffer where received data is stored */
 	uint8_t *recv_buf;
 
@@ -329,6 +370,89 @@ struct http_request {
 int http_client_req(int sock, struct http_request *req,
 		    int32_t timeout, void *user_data);
 
+/**
+ * @brief Send several HTTP requests back to back on one connection
+ * (HTTP/1.1 pipelining) and then receive the responses in order.
+ *
+ * All requests are written to the socket before the first response is
+ * read, so the round trip time is paid only once for the whole batch.
+ * The response callback of each request is called as its response is
+ * received. Data belonging to a following response that is received
+ * together with the previous one is moved to the start of the next
+ * request's receive buffer, so the requests may share the same buffer.
+ * The server must support persistent connections.
+ *
+ * @param sock Socket id of the connection.
+ * @param reqs Array of HTTP requests to send
+ * @param count Number of requests in the array
+ * @param timeout Max timeout to wait for all the responses, in milliseconds.
+ * @param user_data User specified data that is passed to the callbacks.
+ *
+ * @return <0 if error, otherwise number of requests whose response was
+ *         fully received.
+ */
+int http_client_req_pipelined(int sock, struct http_request **reqs,
+			      size_t count, int32_t timeout, void *user_data);
+
+/** Security tag value meaning that a pooled connection does not use TLS */
+#define HTTP_CLIENT_POOL_NO_TLS -1
+
+/**
+ * @brief Get a connected socket to the given server from the HTTP client
+ * connection pool.
+ *
+ * An idle keep-alive connection to the same host, port and TLS security
+ * tag is reused if one exists, otherwise a new connection is created.
+ * The socket must be given back with http_client_conn_release().
+ *
+ * @param host Server host name or address
+ * @param port Server port, or NULL for the default port
+ * @param sec_tag TLS security tag, or HTTP_CLIENT_POOL_NO_TLS
+ *
+ * @return Socket id on success, <0 if error.
+ */
+int http_client_conn_get(const char *host, const char *port,
+			 sec_tag_t sec_tag);
+
+/**
+ * @brief Give a socket obtained with http_client_conn_get() back to the
+ * connection pool.
+ *
+ * @param sock Socket id of the connection
+ * @param reuse If true, the connection is kept open for later requests
+ *        (until the idle timeout expires), otherwise it is closed.
+ */
+void http_client_conn_release(int sock, bool reuse);
+
+/**
+ * @brief Close all idle connections in the HTTP client connection pool.
+ */
+void http_client_pool_flush(void);
+
+/**
+ * @brief Do a HTTP request over a pooled connection.
+ *
+ * This is a convenience wrapper around http_client_conn_get(),
+ * http_client_req() and http_client_conn_release(). The connection is
+ * kept for reuse if the server allows it. If a reused connection turns
+ * out to have been closed by the server before any response data was
+ * received, a GET, HEAD, OPTIONS or TRACE request is retried on another
+ * connection without calling the response callback. Other requests are
+ * not retried, as the server may already have processed them.
+ *
+ * @param host Server host name or address
+ * @param port Server port, or NULL for the default port
+ * @param sec_tag TLS security tag, or HTTP_CLIENT_POOL_NO_TLS
+ * @param req HTTP request information
+ * @param timeout Max timeout to wait for the data, in milliseconds.
+ * @param user_data User specified data that is passed to the callback.
+ *
+ * @return <0 if error, >=0 amount of data sent to the server
+ */
+int http_client_pool_req(const char *host, const char *port,
+			 sec_tag_t sec_tag, struct http_request *req,
+			 int32_t timeout, void *user_data);
+
 #ifdef __cplusplus
 }
 #endif
@@ -38,9 +38,27 @@ struct ieee802154_security_ctx {
 	uint8_t key_len;
 	uint8_t level	: 3;
 	uint8_t key_mode	: 2;
-	uint8_t _unused	: 3;
+	uint8_t session_ready	: 1;
+	uint8_t _unused	: 2;
 };
 
+#ifdef CONFIG_NET_L2_IEEE802154_RX_STATS
+/* Stages of the receive path that are timed separately */
+enum ieee802154_rx_stage {
+	IEEE802154_RX_STAGE_PARSE,
+	IEEE802154_RX_STAGE_DECIPHER,
+	IEEE802154_RX_STAGE_UNCOMPRESS,
+	IEEE802154_RX_STAGE_COUNT,
+};
+
+struct ieee802154_rx_stats {
+	/* Data frames that went through the receive path */
+	uint32_t frames;
+	/* Cycles spent in each stage for all of these frames */
+	uint64_t cycles[IEEE802154_RX_STAGE_COUNT];
+};
+#endif
+
 /* This not meant to be used by any code but 802.15.4 L2 stack */
 struct ieee802154_context {
 	enum net_l2_flags flags;
@@ -63,6 +81,9 @@ struct ieee802154_context {
 #endif
 #ifdef CONFIG_NET_L2_IEEE802154_SECURITY
 	struct ieee802154_security_ctx sec_ctx;
+#endif
+#ifdef CONFIG_NET_L2_IEEE802154_RX_STATS
+	struct ieee802154_rx_stats rx_stats;
 #endif
 	int16_t tx_power;
 	uint8_t sequence;
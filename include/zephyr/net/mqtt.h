@@ -468,6 +468,19 @@ struct mqtt_internal {
 
 	/** Internal. Remaining payload length to read. */
 	uint32_t remaining_payload;
+
+#if defined(CONFIG_MQTT_LIB_OUTBOX)
+	/** Internal. Bytes of the outbox buffer in use. */
+	uint32_t outbox_len;
+
+	/** Internal. Number of queued packets not sent yet. */
+	uint16_t outbox_unsent;
+
+	/** Internal. Number of QoS 1 and QoS 2 publications sent and not
+	 *  acknowledged yet.
+	 */
+	uint16_t outbox_inflight;
+#endif
 };
 
 /**
@@ -524,6 +537,18 @@ struct mqtt_client {
 	/** Size of transmit buffer. */
 	uint32_t tx_buf_size;
 
+#if defined(CONFIG_MQTT_LIB_OUTBOX)
+	/** Buffer holding the messages queued with mqtt_publish_queued()
+	 *  until they are sent (QoS 0) or acknowledged (QoS 1 and QoS 2).
+	 *  Shall be kept intact across reconnects so that unacknowledged
+	 *  messages can be retransmitted.
+	 */
+	uint8_t *outbox_buf;
+
+	/** Size of the outbox buffer. */
+	uint32_t outbox_buf_size;
+#endif
+
 	/** Keepalive interval for this client in seconds.
 	 *  Default is CONFIG_MQTT_KEEPALIVE.
 	 */
@@ -607,6 +632,54 @@ int mqtt_connect(struct mqtt_client *client);
 int mqtt_publish(struct mqtt_client *client,
 		 const struct mqtt_publish_param *param);
 
+#if defined(CONFIG_MQTT_LIB_OUTBOX)
+/**
+ * @brief API to queue a message for publishing.
+ *
+ * The packet, including its payload, is copied to the client outbox, so the
+ * parameters can be reused as soon as the function returns. Queued packets
+ * are sent in batches, with as few transport writes as possible, whenever
+ * @kconfig{CONFIG_MQTT_OUTBOX_BATCH_SIZE} packets are pending, and from
+ * mqtt_input(), mqtt_live() and mqtt_outbox_flush().
+ *
+ * At most @kconfig{CONFIG_MQTT_OUTBOX_INFLIGHT_MAX} QoS 1 and QoS 2 messages
+ * are unacknowledged at any time. The library sends the PUBREL for queued
+ * QoS 2 messages itself, so mqtt_publish_qos2_release() shall not be called
+ * for them. Messages not acknowledged when the connection is lost are sent
+ * again, with the DUP flag set, once the client is connected again.
+ *
+ * @param[in] client Client instance for which the procedure is requested.
+ *                   Shall not be NULL.
+ * @param[in] param Parameters to be used for the publish message.
+ *                  Shall not be NULL.
+ *
+ * @return 0 or a negative error code (errno.h) indicating reason of failure.
+ *         -ENOMEM is returned if the outbox is full.
+ */
+int mqtt_publish_queued(struct mqtt_client *client,
+			const struct mqtt_publish_param *param);
+
+/**
+ * @brief API to send all queued messages the inflight window allows.
+ *
+ * @param[in] client Client instance for which the procedure is requested.
+ *                   Shall not be NULL.
+ *
+ * @return 0 or a negative error code (errno.h) indicating reason of failure.
+ */
+int mqtt_outbox_flush(struct mqtt_client *client);
+
+/**
+ * @brief API to get the number of messages in the client outbox.
+ *
+ * @param[in] client Client instance for which the procedure is requested.
+ *                   Shall not be NULL.
+ *
+ * @return Number of messages not sent or not acknowledged yet.
+ */
+int mqtt_outbox_count(struct mqtt_client *client);
+#endif /* CONFIG_MQTT_LIB_OUTBOX */
+
 /**
  * @brief API used by client to send acknowledgment on receiving QoS1 publish
  *        message. Should be called on reception of @ref MQTT_EVT_PUBLISH with
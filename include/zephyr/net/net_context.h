@@ -340,6 +340,29 @@ __net_socket struct net_context {
 	bool proxy_enabled;
 #endif
 
+#if defined(CONFIG_NET_PKT_BUDGET)
+	/** Data buffers used by the packets sent via this context */
+	struct net_buf_budget tx_budget;
+#endif
+
+#if defined(CONFIG_NET_UDP_FAST_PATH)
+	/** Headers of the last packet sent to the connected peer */
+	struct {
+		/** Interface the headers were built for */
+		struct net_if *iface;
+		/** Source address used in the headers */
+		struct net_if_addr *ifaddr;
+		/** Partial checksums of the fixed IPv4 and UDP fields */
+		uint16_t ip_sum;
+		uint16_t udp_sum;
+		/** Length of the IP and UDP headers, 0 if nothing is cached */
+		uint8_t hdr_len;
+		/** Checksums are calculated in software */
+		bool chksum;
+		/** IP and UDP headers without lengths, TTL and checksums */
+		uint8_t hdr[NET_IPV6UDPH_LEN] __aligned(4);
+	} udp_cache;
+#endif
 };
 
 static inline bool net_context_is_used(struct net_context *context)
@@ -1150,6 +1173,39 @@ static inline void net_context_setup_pools(struct net_context *context,
 #define net_context_setup_pools(context, tx_pool, data_pool)
 #endif
 
+/**
+ * @brief Set the TX data buffer budget of a network context
+ *
+ * When the context holds as many buffers as the limit, or when the
+ * remaining buffers are reserved for others, sending fails with -ENOBUFS.
+ *
+ * TCP contexts are not bounded by the budget: queued TCP data and the
+ * segments sent from it are charged to the network interface only.
+ *
+ * @param context Network context.
+ * @param reserved Number of TX buffers reserved for the context
+ * @param limit Maximum number of TX buffers, 0 if there is no limit
+ *
+ * @return 0 if ok, -EINVAL if the reservation is over the limit,
+ *         -ENOMEM if there are not enough unreserved buffers,
+ *         -EBADF if the context is not in use,
+ *         -ENOTSUP if budgets are not enabled.
+ */
+#if defined(CONFIG_NET_PKT_BUDGET)
+int net_context_set_buf_budget(struct net_context *context,
+			       uint16_t reserved, uint16_t limit);
+#else
+static inline int net_context_set_buf_budget(struct net_context *context,
+					     uint16_t reserved, uint16_t limit)
+{
+	ARG_UNUSED(context);
+	ARG_UNUSED(reserved);
+	ARG_UNUSED(limit);
+
+	return -ENOTSUP;
+}
+#endif
+
 /**
  * @brief Check if a port is in use (bound)
  *
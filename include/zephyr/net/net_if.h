@@ -468,6 +468,29 @@ struct net_if_dev {
 #endif /* CONFIG_NET_SOCKETS_OFFLOAD */
 };
 
+/**
+ * @brief Network data buffer budget
+ *
+ * Keeps count of the data buffers held by an interface or a context, see
+ * CONFIG_NET_PKT_BUDGET.
+ */
+struct net_buf_budget {
+	/** Buffers reserved for this budget only */
+	uint16_t reserved;
+
+	/** Maximum number of buffers, 0 if there is no limit */
+	uint16_t limit;
+
+	/** Buffers currently in use */
+	uint16_t used;
+
+	/** Highest number of buffers in use */
+	uint16_t peak;
+
+	/** Allocations that were denied */
+	uint32_t denied;
+};
+
 /**
  * @brief Network Interface structure
  *
@@ -494,6 +517,14 @@ struct net_if {
 	 */
 	int tx_pending;
 #endif
+
+#if defined(CONFIG_NET_PKT_BUDGET)
+	/** Data buffers used by the packets received via this interface */
+	struct net_buf_budget rx_budget;
+
+	/** Data buffers used by the packets sent via this interface */
+	struct net_buf_budget tx_budget;
+#endif
 };
 
 /**
@@ -853,6 +884,34 @@ static inline void net_if_set_mtu(struct net_if *iface,
 	iface->if_dev->mtu = mtu;
 }
 
+/**
+ * @brief Set the data buffer budget of a network interface
+ *
+ * @param iface Pointer to a network interface structure
+ * @param tx Set the TX budget if true, the RX budget otherwise
+ * @param reserved Number of buffers reserved for the interface
+ * @param limit Maximum number of buffers, 0 if there is no limit
+ *
+ * @return 0 if ok, -EINVAL if the reservation is over the limit,
+ *         -ENOMEM if there are not enough unreserved buffers,
+ *         -ENOTSUP if budgets are not enabled.
+ */
+#if defined(CONFIG_NET_PKT_BUDGET)
+int net_if_set_buf_budget(struct net_if *iface, bool tx,
+			  uint16_t reserved, uint16_t limit);
+#else
+static inline int net_if_set_buf_budget(struct net_if *iface, bool tx,
+					uint16_t reserved, uint16_t limit)
+{
+	ARG_UNUSED(iface);
+	ARG_UNUSED(tx);
+	ARG_UNUSED(reserved);
+	ARG_UNUSED(limit);
+
+	return -ENOTSUP;
+}
+#endif
+
 /**
  * @brief Set the infinite status of the network interface address
  *
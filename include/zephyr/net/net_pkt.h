@@ -18,6 +18,7 @@
 
 #include <zephyr/types.h>
 #include <stdbool.h>
+#include <string.h>
 
 #include <zephyr/net/buf.h>
 
@@ -87,6 +88,12 @@ struct net_pkt {
 	struct net_if *orig_iface; /* Original network interface */
 #endif
 
+#if defined(CONFIG_NET_PKT_BUDGET)
+	struct net_buf_budget *budget; /* Budget charged for the data */
+	uint16_t budget_bufs; /* Data buffers charged to the budget */
+	bool budget_tx; /* Charged from the TX or the RX data pool */
+#endif
+
 #if defined(CONFIG_NET_PKT_TIMESTAMP)
 	/** Timestamp if available. */
 	struct net_ptp_time timestamp;
@@ -242,6 +249,11 @@ struct net_pkt {
 	uint8_t ipv6_next_hdr;	/* What is the very first next header */
 #endif /* CONFIG_NET_IPV6 */
 
+#if defined(CONFIG_NET_IPV4_FRAGMENT)
+	uint16_t ipv4_fragment_flags;	/* Fragment offset and MF (More Fragment) flag */
+	uint8_t ipv4_reassembled;	/* Is this pkt reassembled from fragments */
+#endif /* CONFIG_NET_IPV4_FRAGMENT */
+
 #if defined(CONFIG_IEEE802154)
 #if defined(CONFIG_IEEE802154_2015)
 	uint32_t ieee802154_ack_fc; /* Frame counter set in the ACK */
@@ -739,6 +751,70 @@ static inline void net_pkt_set_ipv6_fragment_id(struct net_pkt *pkt,
 }
 #endif /* CONFIG_NET_IPV6_FRAGMENT */
 
+#if defined(CONFIG_NET_IPV4_FRAGMENT)
+static inline uint16_t net_pkt_ipv4_fragment_offset(struct net_pkt *pkt)
+{
+	return (pkt->ipv4_fragment_flags & NET_IPV4_FRAGH_OFFSET_MASK) * 8U;
+}
+
+static inline bool net_pkt_ipv4_fragment_more(struct net_pkt *pkt)
+{
+	return (pkt->ipv4_fragment_flags & NET_IPV4_FRAGH_MF) != 0;
+}
+
+static inline void net_pkt_set_ipv4_fragment_flags(struct net_pkt *pkt,
+						   uint16_t flags)
+{
+	pkt->ipv4_fragment_flags = flags;
+}
+
+static inline bool net_pkt_ipv4_reassembled(struct net_pkt *pkt)
+{
+	return !!pkt->ipv4_reassembled;
+}
+
+static inline void net_pkt_set_ipv4_reassembled(struct net_pkt *pkt,
+						bool reassembled)
+{
+	pkt->ipv4_reassembled = reassembled;
+}
+#else /* CONFIG_NET_IPV4_FRAGMENT */
+static inline uint16_t net_pkt_ipv4_fragment_offset(struct net_pkt *pkt)
+{
+	ARG_UNUSED(pkt);
+
+	return 0;
+}
+
+static inline bool net_pkt_ipv4_fragment_more(struct net_pkt *pkt)
+{
+	ARG_UNUSED(pkt);
+
+	return 0;
+}
+
+static inline void net_pkt_set_ipv4_fragment_flags(struct net_pkt *pkt,
+						   uint16_t flags)
+{
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(flags);
+}
+
+static inline bool net_pkt_ipv4_reassembled(struct net_pkt *pkt)
+{
+	ARG_UNUSED(pkt);
+
+	return false;
+}
+
+static inline void net_pkt_set_ipv4_reassembled(struct net_pkt *pkt,
+						bool reassembled)
+{
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(reassembled);
+}
+#endif /* CONFIG_NET_IPV4_FRAGMENT */
+
 static inline uint8_t net_pkt_priority(struct net_pkt *pkt)
 {
 	return pkt->priority;
@@ -1869,6 +1945,45 @@ static inline void *net_pkt_cursor_get_pos(struct net_pkt *pkt)
 	return pkt->cursor.pos;
 }
 
+/** @cond INTERNAL_HIDDEN */
+
+/*
+ * Fast path for the cursor operations: returns the cursor position if the
+ * given amount of data is inside the current buffer and the cursor stays in
+ * that buffer after the operation, NULL if the operation has to go through
+ * the buffer chain. Writing appends to the buffer unless the packet is being
+ * overwritten, so then the whole buffer space can be used.
+ */
+static inline uint8_t *net_pkt_cursor_fast(struct net_pkt *pkt,
+					   size_t length, bool write)
+{
+	struct net_buf *buf = pkt->cursor.buf;
+	size_t end;
+
+	if (buf == NULL || pkt->cursor.pos == NULL) {
+		return NULL;
+	}
+
+	if (write && !net_pkt_is_being_overwritten(pkt)) {
+		end = net_buf_max_len(buf);
+	} else {
+		end = buf->len;
+	}
+
+	if ((size_t)(pkt->cursor.pos - buf->data) + length >= end) {
+		return NULL;
+	}
+
+	return pkt->cursor.pos;
+}
+
+int net_pkt_cursor_skip(struct net_pkt *pkt, size_t length);
+int net_pkt_cursor_read(struct net_pkt *pkt, void *data, size_t length);
+int net_pkt_cursor_write(struct net_pkt *pkt, const void *data,
+			 size_t length);
+
+/** @endcond */
+
 /**
  * @brief Skip some data from a net_pkt
  *
@@ -1889,7 +2004,22 @@ static inline void *net_pkt_cursor_get_pos(struct net_pkt *pkt)
  *
  * @return 0 in success, negative errno code otherwise.
  */
-int net_pkt_skip(struct net_pkt *pkt, size_t length);
+static inline int net_pkt_skip(struct net_pkt *pkt, size_t length)
+{
+	uint8_t *pos = net_pkt_cursor_fast(pkt, length, true);
+
+	if (pos == NULL) {
+		return net_pkt_cursor_skip(pkt, length);
+	}
+
+	if (!net_pkt_is_being_overwritten(pkt)) {
+		pkt->cursor.buf->len += length;
+	}
+
+	pkt->cursor.pos = pos + length;
+
+	return 0;
+}
 
 /**
  * @brief Memset some data in a net_pkt
@@ -1970,7 +2100,19 @@ struct net_pkt *net_pkt_shallow_clone(struct net_pkt *pkt,
  *
  * @return 0 on success, negative errno code otherwise.
  */
-int net_pkt_read(struct net_pkt *pkt, void *data, size_t length);
+static inline int net_pkt_read(struct net_pkt *pkt, void *data, size_t length)
+{
+	uint8_t *pos = net_pkt_cursor_fast(pkt, length, false);
+
+	if (pos == NULL) {
+		return net_pkt_cursor_read(pkt, data, length);
+	}
+
+	memcpy(data, pos, length);
+	pkt->cursor.pos = pos + length;
+
+	return 0;
+}
 
 /* Read uint8_t data data a net_pkt */
 static inline int net_pkt_read_u8(struct net_pkt *pkt, uint8_t *data)
@@ -1990,7 +2132,17 @@ static inline int net_pkt_read_u8(struct net_pkt *pkt, uint8_t *data)
  *
  * @return 0 on success, negative errno code otherwise.
  */
-int net_pkt_read_be16(struct net_pkt *pkt, uint16_t *data);
+static inline int net_pkt_read_be16(struct net_pkt *pkt, uint16_t *data)
+{
+	uint8_t d16[2];
+	int ret;
+
+	ret = net_pkt_read(pkt, d16, sizeof(uint16_t));
+
+	*data = sys_get_be16(d16);
+
+	return ret;
+}
 
 /**
  * @brief Read uint16_t little endian data from a net_pkt
@@ -2004,7 +2156,17 @@ int net_pkt_read_be16(struct net_pkt *pkt, uint16_t *data);
  *
  * @return 0 on success, negative errno code otherwise.
  */
-int net_pkt_read_le16(struct net_pkt *pkt, uint16_t *data);
+static inline int net_pkt_read_le16(struct net_pkt *pkt, uint16_t *data)
+{
+	uint8_t d16[2];
+	int ret;
+
+	ret = net_pkt_read(pkt, d16, sizeof(uint16_t));
+
+	*data = sys_get_le16(d16);
+
+	return ret;
+}
 
 /**
  * @brief Read uint32_t big endian data from a net_pkt
@@ -2018,7 +2180,17 @@ int net_pkt_read_le16(struct net_pkt *pkt, uint16_t *data);
  *
  * @return 0 on success, negative errno code otherwise.
  */
-int net_pkt_read_be32(struct net_pkt *pkt, uint32_t *data);
+static inline int net_pkt_read_be32(struct net_pkt *pkt, uint32_t *data)
+{
+	uint8_t d32[4];
+	int ret;
+
+	ret = net_pkt_read(pkt, d32, sizeof(uint32_t));
+
+	*data = sys_get_be32(d32);
+
+	return ret;
+}
 
 /**
  * @brief Write data into a net_pkt
@@ -2033,7 +2205,28 @@ int net_pkt_read_be32(struct net_pkt *pkt, uint32_t *data);
  *
  * @return 0 on success, negative errno code otherwise.
  */
-int net_pkt_write(struct net_pkt *pkt, const void *data, size_t length);
+static inline int net_pkt_write(struct net_pkt *pkt, const void *data,
+				size_t length)
+{
+	uint8_t *pos = net_pkt_cursor_fast(pkt, length, true);
+
+	if (pos == NULL) {
+		return net_pkt_cursor_write(pkt, data, length);
+	}
+
+	/* Data got with net_pkt_get_data() is already in place */
+	if (pos != data) {
+		memcpy(pos, data, length);
+	}
+
+	if (!net_pkt_is_being_overwritten(pkt)) {
+		pkt->cursor.buf->len += length;
+	}
+
+	pkt->cursor.pos = pos + length;
+
+	return 0;
+}
 
 /* Write uint8_t data into a net_pkt. */
 static inline int net_pkt_write_u8(struct net_pkt *pkt, uint8_t data)
@@ -2175,6 +2368,13 @@ struct net_pkt_data_access {
 
 #endif /* CONFIG_NET_HEADERS_ALWAYS_CONTIGUOUS */
 
+/** @cond INTERNAL_HIDDEN */
+
+void *net_pkt_cursor_get_data(struct net_pkt *pkt,
+			      struct net_pkt_data_access *access);
+
+/** @endcond */
+
 /**
  * @brief Get data from a network packet in a contiguous way
  *
@@ -2188,8 +2388,21 @@ struct net_pkt_data_access {
  *
  * @return a pointer to the requested contiguous data, NULL otherwise.
  */
-void *net_pkt_get_data(struct net_pkt *pkt,
-		       struct net_pkt_data_access *access);
+static inline void *net_pkt_get_data(struct net_pkt *pkt,
+				     struct net_pkt_data_access *access)
+{
+	uint8_t *pos = net_pkt_cursor_fast(pkt, access->size, true);
+
+	if (pos == NULL) {
+		return net_pkt_cursor_get_data(pkt, access);
+	}
+
+#if !defined(CONFIG_NET_HEADERS_ALWAYS_CONTIGUOUS)
+	access->data = pos;
+#endif
+
+	return pos;
+}
 
 /**
  * @brief Set contiguous data into a network packet
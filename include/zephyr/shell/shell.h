@@ -689,6 +689,7 @@ struct shell_transport {
  */
 struct shell_stats {
 	atomic_t log_lost_cnt; /*!< Lost log counter.*/
+	atomic_t tx_dropped_cnt; /*!< Dropped output bytes counter.*/
 };
 
 #ifdef CONFIG_SHELL_STATS
@@ -735,6 +736,7 @@ struct shell_backend_ctx_flags {
 	uint32_t cmd_ctx      :1; /*!< Shell is executing command */
 	uint32_t print_noinit :1; /*!< Print request from not initialized shell */
 	uint32_t sync_mode    :1; /*!< Shell in synchronous mode */
+	uint32_t tx_drop      :1; /*!< Output dropped, transport stalled */
 };
 
 BUILD_ASSERT((sizeof(struct shell_backend_ctx_flags) == sizeof(uint32_t)),
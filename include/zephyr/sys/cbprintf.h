@@ -223,6 +223,13 @@ BUILD_ASSERT(Z_IS_POW2(CBPRINTF_PACKAGE_ALIGNMENT));
  */
 #define Z_CBVPRINTF_PROCESS_FLAG_TAGGED_ARGS BIT(0)
 
+/** @brief Indicates the output callback takes strings.
+ *
+ * This tells z_cbvprintf_impl() that the output callback is a
+ * @ref cbprintf_str_cb which is called with runs of characters.
+ */
+#define Z_CBVPRINTF_PROCESS_FLAG_STR_OUT BIT(1)
+
 /**@} */
 
 #include <zephyr/sys/cbprintf_enums.h>
@@ -250,6 +257,21 @@ typedef int (*cbprintf_cb)(int c, void *ctx);
 typedef int (*cbprintf_cb)(/* int c, void *ctx */);
 #endif
 
+/** @brief Signature for a cbprintf callback function emitting strings.
+ *
+ * Literal text and converted values are passed in runs rather than one
+ * character at a time.
+ *
+ * @param str characters to output, not null terminated.
+ * @param len number of characters, never 0.
+ * @param ctx a pointer to an object that provides context for the
+ * output operation.
+ *
+ * @return a non-negative value, or a negative error code that will be
+ * returned from cbvprintf_str().
+ */
+typedef int (*cbprintf_str_cb)(const char *str, size_t len, void *ctx);
+
 /** @brief Signature for a cbprintf multibyte callback function.
  *
  * @param buf data.
@@ -725,6 +747,51 @@ int cbvprintf_tagged_args(cbprintf_cb out, void *ctx,
 				Z_CBVPRINTF_PROCESS_FLAG_TAGGED_ARGS);
 }
 
+/** @brief varargs-aware *printf-like output through a string callback.
+ *
+ * This is the same as cbvprintf() except that the output is passed to
+ * @p out in runs of characters. Literal text, converted values and
+ * padding are emitted with one call each instead of one call per
+ * character.
+ *
+ * @param out the function used to emit the generated characters.
+ *
+ * @param ctx context provided when invoking out
+ *
+ * @param format a standard ISO C format string with characters and conversion
+ * specifications.
+ *
+ * @param ap a reference to the values to be converted.
+ *
+ * @return the number of characters generated, or a negative error value
+ * returned from invoking @p out.
+ */
+static inline
+int cbvprintf_str(cbprintf_str_cb out, void *ctx, const char *format,
+		  va_list ap)
+{
+	return z_cbvprintf_impl((cbprintf_cb)out, ctx, format, ap,
+				Z_CBVPRINTF_PROCESS_FLAG_STR_OUT);
+}
+
+/* External formatters used by cbpprintf_str(), @p out is a cbprintf_str_cb */
+static inline
+int z_cbvprintf_str_formatter(cbprintf_cb out, void *ctx,
+			      const char *format, va_list ap)
+{
+	return z_cbvprintf_impl(out, ctx, format, ap,
+				Z_CBVPRINTF_PROCESS_FLAG_STR_OUT);
+}
+
+static inline
+int z_cbvprintf_str_tagged_args_formatter(cbprintf_cb out, void *ctx,
+					  const char *format, va_list ap)
+{
+	return z_cbvprintf_impl(out, ctx, format, ap,
+				Z_CBVPRINTF_PROCESS_FLAG_STR_OUT |
+				Z_CBVPRINTF_PROCESS_FLAG_TAGGED_ARGS);
+}
+
 /** @brief Generate the output for a previously captured format
  * operation.
  *
@@ -759,6 +826,41 @@ int cbpprintf(cbprintf_cb out, void *ctx, void *packaged)
 	return cbpprintf_external(out, cbvprintf, ctx, packaged);
 }
 
+/** @brief Generate the output for a previously captured format
+ * operation through a string callback.
+ *
+ * Same as cbpprintf() with the output passed to @p out in runs of
+ * characters, see cbvprintf_str().
+ *
+ * @param out the function used to emit the generated characters.
+ *
+ * @param ctx context provided when invoking out
+ *
+ * @param packaged the data required to generate the formatted output, as
+ * captured by cbprintf_package() or cbvprintf_package().
+ *
+ * @return the number of characters printed, or a negative error value
+ * returned from invoking @p out.
+ */
+static inline
+int cbpprintf_str(cbprintf_str_cb out, void *ctx, void *packaged)
+{
+#if defined(CONFIG_CBPRINTF_PACKAGE_SUPPORT_TAGGED_ARGUMENTS)
+	union cbprintf_package_hdr *hdr =
+		(union cbprintf_package_hdr *)packaged;
+
+	if ((hdr->desc.pkg_flags & CBPRINTF_PACKAGE_ARGS_ARE_TAGGED)
+	    == CBPRINTF_PACKAGE_ARGS_ARE_TAGGED) {
+		return cbpprintf_external((cbprintf_cb)out,
+					  z_cbvprintf_str_tagged_args_formatter,
+					  ctx, packaged);
+	}
+#endif
+
+	return cbpprintf_external((cbprintf_cb)out, z_cbvprintf_str_formatter,
+				  ctx, packaged);
+}
+
 #ifdef CONFIG_CBPRINTF_LIBC_SUBSTS
 
 /** @brief fprintf using Zephyrs cbprintf infrastructure.
@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_TRACING_TRACING_FILTER_H_
+#define ZEPHYR_INCLUDE_TRACING_TRACING_FILTER_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/util.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Tracing filter APIs
+ * @defgroup subsys_tracing_filter_apis Tracing filter APIs
+ * @ingroup subsys_tracing
+ * @{
+ */
+
+struct k_thread;
+
+/** @brief Types of traced objects which can be filtered. */
+enum tracing_filter_type {
+	TRACING_FILTER_TYPE_THREAD,
+	TRACING_FILTER_TYPE_WORK,
+	TRACING_FILTER_TYPE_POLL,
+	TRACING_FILTER_TYPE_SEMAPHORE,
+	TRACING_FILTER_TYPE_MUTEX,
+	TRACING_FILTER_TYPE_CONDVAR,
+	TRACING_FILTER_TYPE_QUEUE,
+	TRACING_FILTER_TYPE_FIFO,
+	TRACING_FILTER_TYPE_LIFO,
+	TRACING_FILTER_TYPE_STACK,
+	TRACING_FILTER_TYPE_MSGQ,
+	TRACING_FILTER_TYPE_MBOX,
+	TRACING_FILTER_TYPE_PIPE,
+	TRACING_FILTER_TYPE_HEAP,
+	TRACING_FILTER_TYPE_MEM_SLAB,
+	TRACING_FILTER_TYPE_TIMER,
+	TRACING_FILTER_TYPE_EVENT,
+	TRACING_FILTER_TYPE_PM,
+
+	TRACING_FILTER_TYPE_COUNT
+};
+
+/** @cond INTERNAL_HIDDEN */
+
+/* Bits below TRACING_FILTER_TYPE_COUNT are set for disabled types. */
+#define Z_TRACING_FILTER_THREADS BIT(30)
+#define Z_TRACING_FILTER_SAMPLING BIT(31)
+
+BUILD_ASSERT(TRACING_FILTER_TYPE_COUNT <= 30, "Too many filter types");
+
+extern atomic_t z_tracing_filter;
+extern atomic_t z_tracing_filter_events[ATOMIC_BITMAP_SIZE(256)];
+
+bool z_tracing_filter_check(enum tracing_filter_type type, uint16_t *cnt);
+
+/* Called at the hook site before the tracing format is involved. @p cnt
+ * is a counter of the hook site used for sampling.
+ */
+static inline bool z_tracing_filter_pass(enum tracing_filter_type type,
+					 uint16_t *cnt)
+{
+	atomic_val_t filter = atomic_get(&z_tracing_filter);
+
+	if ((filter & BIT(type)) != 0) {
+		return false;
+	}
+
+	if ((filter & (Z_TRACING_FILTER_THREADS |
+		       Z_TRACING_FILTER_SAMPLING)) != 0) {
+		return z_tracing_filter_check(type, cnt);
+	}
+
+	return true;
+}
+
+/** @endcond */
+
+/**
+ * @brief Enable or disable tracing of an object type.
+ *
+ * @param type Object type.
+ * @param enable True to trace events of the type, false to drop them.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if the type is invalid.
+ */
+int tracing_filter_type_set(enum tracing_filter_type type, bool enable);
+
+/**
+ * @brief Check if an object type is traced.
+ *
+ * @param type Object type.
+ *
+ * @return True if events of the type are traced.
+ */
+bool tracing_filter_type_is_enabled(enum tracing_filter_type type);
+
+/**
+ * @brief Get the name of an object type, e.g. "mutex".
+ *
+ * @param type Object type.
+ *
+ * @return Name or NULL if the type is invalid.
+ */
+const char *tracing_filter_type_name(enum tracing_filter_type type);
+
+/**
+ * @brief Get an object type by name.
+ *
+ * @param name Name as returned by tracing_filter_type_name().
+ *
+ * @return Object type or -EINVAL if there is no type with that name.
+ */
+int tracing_filter_type_from_name(const char *name);
+
+/**
+ * @brief Set sampling ratio of an object type.
+ *
+ * Only one in @p ratio events of each hook of the type is traced. Each hook
+ * counts its own events, so matching events, like the enter and exit of
+ * a call, are not necessarily traced for the same call, e.g. when a call
+ * can exit through different hooks.
+ *
+ * @param type Object type.
+ * @param ratio Sampling ratio, 0 or 1 to trace every event.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if the type is invalid.
+ */
+int tracing_filter_sampling_set(enum tracing_filter_type type,
+				uint16_t ratio);
+
+/**
+ * @brief Get sampling ratio of an object type.
+ *
+ * @param type Object type.
+ *
+ * @return Sampling ratio, 1 if every event is traced.
+ */
+uint16_t tracing_filter_sampling_get(enum tracing_filter_type type);
+
+/**
+ * @brief Add a thread to the thread filter.
+ *
+ * Once a thread is added, only events of the threads in the filter are
+ * traced. Events in interrupt context are dropped, except thread events
+ * like context switches, which are checked against the current thread.
+ *
+ * @param thread Thread.
+ *
+ * @retval 0 on success or if the thread is already in the filter.
+ * @retval -ENOMEM if CONFIG_TRACING_FILTER_THREADS threads are added.
+ */
+int tracing_filter_thread_add(struct k_thread *thread);
+
+/**
+ * @brief Remove a thread from the thread filter.
+ *
+ * Events of all threads are traced again once the last thread is removed.
+ *
+ * @param thread Thread.
+ *
+ * @retval 0 on success.
+ * @retval -ENOENT if the thread is not in the filter.
+ */
+int tracing_filter_thread_remove(struct k_thread *thread);
+
+/**
+ * @brief Remove all threads from the thread filter.
+ */
+void tracing_filter_thread_clear(void);
+
+/**
+ * @brief Enable or disable an event of the tracing format.
+ *
+ * Event IDs are defined by the tracing format, e.g. ctf_event_t for CTF.
+ * Formats without numeric event IDs ignore this filter.
+ *
+ * @param id Event ID.
+ * @param enable True to trace the event, false to drop it.
+ */
+void tracing_filter_event_set(uint8_t id, bool enable);
+
+/**
+ * @brief Check if an event of the tracing format is traced.
+ *
+ * @param id Event ID.
+ *
+ * @return True if the event is traced.
+ */
+static inline bool tracing_filter_event_is_enabled(uint8_t id)
+{
+	return !atomic_test_bit(z_tracing_filter_events, id);
+}
+
+/**
+ * @brief Trace all events again.
+ *
+ * Enables all object types and events, clears the thread filter and
+ * disables sampling.
+ */
+void tracing_filter_reset(void);
+
+/**
+ * @brief Get threads in the thread filter.
+ *
+ * @param buf Buffer for the threads.
+ * @param len Number of threads which fit in @p buf.
+ *
+ * @return Number of threads stored in @p buf.
+ */
+size_t tracing_filter_threads_get(struct k_thread **buf, size_t len);
+
+/**
+ * @brief Execute a filter command.
+ *
+ * Used by the shell and the host command channel. Supported commands:
+ *
+ * - type <type|all> <on|off>: enable or disable an object type.
+ * - sample <type|all> <ratio>: set sampling ratio of an object type.
+ * - event <id> <on|off>: enable or disable an event of the format.
+ * - thread <name|address|all> <on|off>: add or remove a thread from the
+ *   thread filter, "all on" clears the filter.
+ * - reset: trace all events again.
+ *
+ * @param argc Number of arguments.
+ * @param argv Command and its arguments.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if the command is invalid.
+ * @retval -ENOENT if the thread is not found.
+ * @retval -ENOMEM if the thread filter is full.
+ */
+int tracing_filter_cmd(size_t argc, char **argv);
+
+/** @} */ /* end of subsys_tracing_filter_apis */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_TRACING_TRACING_FILTER_H_ */
@@ -22,6 +22,10 @@
 
 #else
 
+#if defined(CONFIG_TRACING_FILTER)
+#include <zephyr/tracing/tracing_filter.h>
+#endif
+
 /**
  * @brief Tracing utility macros
  * @defgroup subsys_tracing_macros Tracing utility macros
@@ -65,6 +69,50 @@
 #define _SYS_PORT_TRACKING_OBJ_FUNC(name, func) \
 	sys_port_track_ ## name ## _ ## func
 
+/*
+ * Helper macros for the runtime filter, each hook site has its own counter
+ * for sampling.
+ */
+
+#if defined(CONFIG_TRACING_FILTER)
+#define _SYS_PORT_TRACING_FILTER_TYPE(type) \
+	sys_port_trace_filter_type_ ## type
+#define _SYS_PORT_TRACING_FILTER(type, trace_call) \
+	{ \
+		static uint16_t _sys_port_trace_cnt; \
+		\
+		if (z_tracing_filter_pass(_SYS_PORT_TRACING_FILTER_TYPE(type), \
+					  &_sys_port_trace_cnt)) { \
+			trace_call; \
+		} \
+	}
+
+#define sys_port_trace_filter_type_k_thread TRACING_FILTER_TYPE_THREAD
+#define sys_port_trace_filter_type_k_work TRACING_FILTER_TYPE_WORK
+#define sys_port_trace_filter_type_k_work_queue TRACING_FILTER_TYPE_WORK
+#define sys_port_trace_filter_type_k_work_delayable TRACING_FILTER_TYPE_WORK
+#define sys_port_trace_filter_type_k_work_poll TRACING_FILTER_TYPE_WORK
+#define sys_port_trace_filter_type_k_poll_api TRACING_FILTER_TYPE_POLL
+#define sys_port_trace_filter_type_k_sem TRACING_FILTER_TYPE_SEMAPHORE
+#define sys_port_trace_filter_type_k_mutex TRACING_FILTER_TYPE_MUTEX
+#define sys_port_trace_filter_type_k_condvar TRACING_FILTER_TYPE_CONDVAR
+#define sys_port_trace_filter_type_k_queue TRACING_FILTER_TYPE_QUEUE
+#define sys_port_trace_filter_type_k_fifo TRACING_FILTER_TYPE_FIFO
+#define sys_port_trace_filter_type_k_lifo TRACING_FILTER_TYPE_LIFO
+#define sys_port_trace_filter_type_k_stack TRACING_FILTER_TYPE_STACK
+#define sys_port_trace_filter_type_k_msgq TRACING_FILTER_TYPE_MSGQ
+#define sys_port_trace_filter_type_k_mbox TRACING_FILTER_TYPE_MBOX
+#define sys_port_trace_filter_type_k_pipe TRACING_FILTER_TYPE_PIPE
+#define sys_port_trace_filter_type_k_heap TRACING_FILTER_TYPE_HEAP
+#define sys_port_trace_filter_type_k_heap_sys TRACING_FILTER_TYPE_HEAP
+#define sys_port_trace_filter_type_k_mem_slab TRACING_FILTER_TYPE_MEM_SLAB
+#define sys_port_trace_filter_type_k_timer TRACING_FILTER_TYPE_TIMER
+#define sys_port_trace_filter_type_k_event TRACING_FILTER_TYPE_EVENT
+#define sys_port_trace_filter_type_pm TRACING_FILTER_TYPE_PM
+#else
+#define _SYS_PORT_TRACING_FILTER(type, trace_call) trace_call
+#endif
+
 /*
  * Object trace macros part of the system for checking if certain
  * objects should be traced or not depending on the tracing configuration.
@@ -198,7 +246,8 @@
  */
 #define SYS_PORT_TRACING_FUNC(type, func, ...) \
 	do { \
-		_SYS_PORT_TRACING_FUNC(type, func)(__VA_ARGS__); \
+		_SYS_PORT_TRACING_FILTER(type, \
+			_SYS_PORT_TRACING_FUNC(type, func)(__VA_ARGS__)); \
 	} while (false)
 
 /**
@@ -215,7 +264,8 @@
  */
 #define SYS_PORT_TRACING_FUNC_ENTER(type, func, ...) \
 	do { \
-		_SYS_PORT_TRACING_FUNC_ENTER(type, func)(__VA_ARGS__); \
+		_SYS_PORT_TRACING_FILTER(type, \
+			_SYS_PORT_TRACING_FUNC_ENTER(type, func)(__VA_ARGS__)); \
 	} while (false)
 
 /**
@@ -231,7 +281,8 @@
  */
 #define SYS_PORT_TRACING_FUNC_BLOCKING(type, func, ...) \
 	do { \
-		_SYS_PORT_TRACING_FUNC_BLOCKING(type, func)(__VA_ARGS__); \
+		_SYS_PORT_TRACING_FILTER(type, \
+			_SYS_PORT_TRACING_FUNC_BLOCKING(type, func)(__VA_ARGS__)); \
 	} while (false)
 
 /**
@@ -248,7 +299,8 @@
  */
 #define SYS_PORT_TRACING_FUNC_EXIT(type, func, ...) \
 	do { \
-		_SYS_PORT_TRACING_FUNC_EXIT(type, func)(__VA_ARGS__); \
+		_SYS_PORT_TRACING_FILTER(type, \
+			_SYS_PORT_TRACING_FUNC_EXIT(type, func)(__VA_ARGS__)); \
 	} while (false)
 
 /**
@@ -262,7 +314,8 @@
 #define SYS_PORT_TRACING_OBJ_INIT(obj_type, obj, ...) \
 	do { \
 		SYS_PORT_TRACING_TYPE_MASK(obj_type, \
-			_SYS_PORT_TRACING_OBJ_INIT(obj_type)(obj, ##__VA_ARGS__)); \
+			_SYS_PORT_TRACING_FILTER(obj_type, \
+			_SYS_PORT_TRACING_OBJ_INIT(obj_type)(obj, ##__VA_ARGS__))); \
 		SYS_PORT_TRACING_TYPE_MASK(obj_type, \
 			_SYS_PORT_TRACKING_OBJ_INIT(obj_type)(obj, ##__VA_ARGS__)); \
 	} while (false)
@@ -280,7 +333,8 @@
 #define SYS_PORT_TRACING_OBJ_FUNC(obj_type, func, obj, ...) \
 	do { \
 		SYS_PORT_TRACING_TYPE_MASK(obj_type, \
-			_SYS_PORT_TRACING_OBJ_FUNC(obj_type, func)(obj, ##__VA_ARGS__)); \
+			_SYS_PORT_TRACING_FILTER(obj_type, \
+			_SYS_PORT_TRACING_OBJ_FUNC(obj_type, func)(obj, ##__VA_ARGS__))); \
 		SYS_PORT_TRACING_TYPE_MASK(obj_type, \
 			_SYS_PORT_TRACKING_OBJ_FUNC(obj_type, func)(obj, ##__VA_ARGS__)); \
 	} while (false)
@@ -299,7 +353,8 @@
 #define SYS_PORT_TRACING_OBJ_FUNC_ENTER(obj_type, func, obj, ...) \
 	do { \
 		SYS_PORT_TRACING_TYPE_MASK(obj_type, \
-			_SYS_PORT_TRACING_OBJ_FUNC_ENTER(obj_type, func)(obj, ##__VA_ARGS__)); \
+			_SYS_PORT_TRACING_FILTER(obj_type, \
+			_SYS_PORT_TRACING_OBJ_FUNC_ENTER(obj_type, func)(obj, ##__VA_ARGS__))); \
 	} while (false)
 
 /**
@@ -316,8 +371,9 @@
 #define SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(obj_type, func, obj, timeout, ...) \
 	do { \
 		SYS_PORT_TRACING_TYPE_MASK(obj_type, \
+			_SYS_PORT_TRACING_FILTER(obj_type, \
 			_SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(obj_type, func) \
-			(obj, timeout, ##__VA_ARGS__)); \
+			(obj, timeout, ##__VA_ARGS__))); \
 	} while (false)
 
 /**
@@ -334,7 +390,8 @@
 #define SYS_PORT_TRACING_OBJ_FUNC_EXIT(obj_type, func, obj, ...) \
 	do { \
 		SYS_PORT_TRACING_TYPE_MASK(obj_type, \
-			_SYS_PORT_TRACING_OBJ_FUNC_EXIT(obj_type, func)(obj, ##__VA_ARGS__)); \
+			_SYS_PORT_TRACING_FILTER(obj_type, \
+			_SYS_PORT_TRACING_OBJ_FUNC_EXIT(obj_type, func)(obj, ##__VA_ARGS__))); \
 	} while (false)
 
 /**
@@ -1315,14 +1315,33 @@ static inline void store_count(const struct conversion *conv,
 	}
 }
 
-/* Outline function to emit all characters in [sp, ep). */
+/* Outline function to emit all characters in [sp, ep).
+ *
+ * With str_out set out is a cbprintf_str_cb and the whole range is passed
+ * in a single call.
+ */
 static int outs(cbprintf_cb out,
 		void *ctx,
 		const char *sp,
-		const char *ep)
+		const char *ep,
+		bool str_out)
 {
 	size_t count = 0;
 
+	if (str_out) {
+		size_t len = (ep == NULL) ? strlen(sp) : (size_t)(ep - sp);
+
+		if (len > 0) {
+			int rc = ((cbprintf_str_cb)out)(sp, len, ctx);
+
+			if (rc < 0) {
+				return rc;
+			}
+		}
+
+		return (int)len;
+	}
+
 	while ((sp < ep) || ((ep == NULL) && *sp)) {
 		int rc = out((int)*sp++, ctx);
 
@@ -1335,6 +1354,32 @@ static int outs(cbprintf_cb out,
 	return (int)count;
 }
 
+/* Outline function to emit n copies of the padding character c. */
+static int outpad(cbprintf_cb out,
+		  void *ctx,
+		  char c,
+		  int n,
+		  bool str_out)
+{
+	static const char spaces[] = "                ";
+	static const char zeros[] = "0000000000000000";
+	const char *pad = (c == '0') ? zeros : spaces;
+	size_t count = 0;
+
+	while (n > 0) {
+		int len = MIN(n, (int)(sizeof(spaces) - 1));
+		int rc = outs(out, ctx, pad, pad + len, str_out);
+
+		if (rc < 0) {
+			return rc;
+		}
+		count += rc;
+		n -= len;
+	}
+
+	return (int)count;
+}
+
 int z_cbvprintf_impl(cbprintf_cb out, void *ctx, const char *fp,
 		     va_list ap, uint32_t flags)
 {
@@ -1344,6 +1389,8 @@ int z_cbvprintf_impl(cbprintf_cb out, void *ctx, const char *fp,
 
 	const bool tagged_ap = (flags & Z_CBVPRINTF_PROCESS_FLAG_TAGGED_ARGS)
 			       == Z_CBVPRINTF_PROCESS_FLAG_TAGGED_ARGS;
+	const bool str_out = (flags & Z_CBVPRINTF_PROCESS_FLAG_STR_OUT)
+			     == Z_CBVPRINTF_PROCESS_FLAG_STR_OUT;
 
 /* Output character, returning EOF if output failed, otherwise
  * updating count.
@@ -1351,7 +1398,9 @@ int z_cbvprintf_impl(cbprintf_cb out, void *ctx, const char *fp,
  * NB: c is evaluated exactly once: side-effects are OK
  */
 #define OUTC(c) do { \
-	int rc = (*out)((int)(c), ctx); \
+	char _c = (char)(c); \
+	int rc = str_out ? ((cbprintf_str_cb)out)(&_c, 1, ctx) : \
+			   (*out)((int)_c, ctx); \
 	\
 	if (rc < 0) { \
 		return rc; \
@@ -1364,7 +1413,7 @@ int z_cbvprintf_impl(cbprintf_cb out, void *ctx, const char *fp,
  */
 
 #define OUTS(_sp, _ep) do { \
-	int rc = outs(out, ctx, _sp, _ep); \
+	int rc = outs(out, ctx, _sp, _ep, str_out); \
 	\
 	if (rc < 0) {	    \
 		return rc; \
@@ -1372,9 +1421,30 @@ int z_cbvprintf_impl(cbprintf_cb out, void *ctx, const char *fp,
 	count += rc; \
 } while (false)
 
+/* Output _n padding characters _c, returning a negative error if output
+ * failed.
+ */
+#define OUTPAD(_c, _n) do { \
+	int rc = outpad(out, ctx, _c, _n, str_out); \
+	\
+	if (rc < 0) { \
+		return rc; \
+	} \
+	count += rc; \
+} while (false)
+
 	while (*fp != 0) {
 		if (*fp != '%') {
-			OUTC(*fp++);
+			const char *sp = fp;
+
+			/* Emit the literal text up to the next conversion
+			 * as a single run.
+			 */
+			do {
+				++fp;
+			} while ((*fp != 0) && (*fp != '%'));
+
+			OUTS(sp, fp);
 			continue;
 		}
 
@@ -1761,9 +1831,8 @@ int z_cbvprintf_impl(cbprintf_cb out, void *ctx, const char *fp,
 					pad = '0';
 				}
 
-				while (width-- > 0) {
-					OUTC(pad);
-				}
+				OUTPAD(pad, width);
+				width = 0;
 			}
 		}
 
@@ -1780,18 +1849,19 @@ int z_cbvprintf_impl(cbprintf_cb out, void *ctx, const char *fp,
 			if (conv->specifier_a) {
 				/* Only padding is pre_exp */
 				while (*cp != 'p') {
-					OUTC(*cp++);
+					++cp;
 				}
+				OUTS(bps, cp);
 			} else {
 				while (isdigit((int)*cp)) {
-					OUTC(*cp++);
+					++cp;
 				}
+				OUTS(bps, cp);
 
 				pad_len = conv->pad0_value;
 				if (!conv->pad_postdp) {
-					while (pad_len-- > 0) {
-						OUTC('0');
-					}
+					OUTPAD('0', pad_len);
+					pad_len = 0;
 				}
 
 				if (*cp == '.') {
@@ -1799,19 +1869,17 @@ int z_cbvprintf_impl(cbprintf_cb out, void *ctx, const char *fp,
 					/* Remaining padding is
 					 * post-dp.
 					 */
-					while (pad_len-- > 0) {
-						OUTC('0');
-					}
+					OUTPAD('0', pad_len);
 				}
+
+				bps = cp;
 				while (isdigit((int)*cp)) {
-					OUTC(*cp++);
+					++cp;
 				}
+				OUTS(bps, cp);
 			}
 
-			pad_len = conv->pad0_pre_exp;
-			while (pad_len-- > 0) {
-				OUTC('0');
-			}
+			OUTPAD('0', conv->pad0_pre_exp);
 
 			OUTS(cp, bpe);
 		} else {
@@ -1823,22 +1891,17 @@ int z_cbvprintf_impl(cbprintf_cb out, void *ctx, const char *fp,
 				OUTC(conv->specifier);
 			}
 
-			pad_len = conv->pad0_value;
-			while (pad_len-- > 0) {
-				OUTC('0');
-			}
+			OUTPAD('0', conv->pad0_value);
 
 			OUTS(bps, bpe);
 		}
 
 		/* Finish left justification */
-		while (width > 0) {
-			OUTC(' ');
-			--width;
-		}
+		OUTPAD(' ', width);
 	}
 
 	return count;
+#undef OUTPAD
 #undef OUTS
 #undef OUTC
 }
@@ -46,12 +46,34 @@ static inline int convert_value(uint_value_type num, unsigned int base,
 }
 
 #define OUTC(_c) do { \
-	out((int)(_c), ctx); \
+	char _ch = (char)(_c); \
+	if (str_out) { \
+		((cbprintf_str_cb)out)(&_ch, 1, ctx); \
+	} else { \
+		out((int)_ch, ctx); \
+	} \
 	if (IS_ENABLED(CONFIG_CBPRINTF_LIBC_SUBSTS)) { \
 		++count; \
 	} \
 } while (false)
 
+/* Output _len characters from _s, in one call when out takes strings */
+#define OUTS(_s, _len) do { \
+	int _n = (_len); \
+	if (str_out) { \
+		if (_n > 0) { \
+			((cbprintf_str_cb)out)(_s, _n, ctx); \
+		} \
+	} else { \
+		for (int _i = 0; _i < _n; _i++) { \
+			out((int)(_s)[_i], ctx); \
+		} \
+	} \
+	if (IS_ENABLED(CONFIG_CBPRINTF_LIBC_SUBSTS)) { \
+		count += _n; \
+	} \
+} while (false)
+
 #define PAD_ZERO	BIT(0)
 #define PAD_TAIL	BIT(1)
 
@@ -79,21 +101,26 @@ int z_cbvprintf_impl(cbprintf_cb out, void *ctx, const char *fmt,
 	size_t count = 0;
 	char buf[DIGITS_BUFLEN];
 	char *prefix, *data;
+	const char *literal;
 	int min_width, precision, data_len;
 	char padding_mode, length_mod, special;
 
 	const bool tagged_ap = (flags & Z_CBVPRINTF_PROCESS_FLAG_TAGGED_ARGS)
 			       == Z_CBVPRINTF_PROCESS_FLAG_TAGGED_ARGS;
+	const bool str_out = (flags & Z_CBVPRINTF_PROCESS_FLAG_STR_OUT)
+			     == Z_CBVPRINTF_PROCESS_FLAG_STR_OUT;
 
 	/* we pre-increment in the loop  afterwards */
 	fmt--;
 
 start:
-	while (*++fmt != '%') {
-		if (*fmt == '\0') {
-			return count;
-		}
-		OUTC(*fmt);
+	literal = ++fmt;
+	while (*fmt != '%' && *fmt != '\0') {
+		fmt++;
+	}
+	OUTS(literal, fmt - literal);
+	if (*fmt == '\0') {
+		return count;
 	}
 
 	min_width = -1;
@@ -343,9 +370,7 @@ start:
 		while (--precision >= 0) {
 			OUTC('0');
 		}
-		while (--data_len >= 0) {
-			OUTC(*data++);
-		}
+		OUTS(data, data_len);
 		while (--min_width >= 0) {
 			OUTC(' ');
 		}
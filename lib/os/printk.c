@@ -15,6 +15,7 @@
 #include <zephyr/kernel.h>
 #include <zephyr/sys/printk.h>
 #include <stdarg.h>
+#include <string.h>
 #include <zephyr/toolchain.h>
 #include <zephyr/linker/sections.h>
 #include <zephyr/syscall_handler.h>
@@ -52,6 +53,7 @@ __attribute__((weak)) int arch_printk_char_out(int c)
 /* LCOV_EXCL_STOP */
 
 int (*_char_out)(int c) = arch_printk_char_out;
+static int (*_str_out)(const char *str, size_t len);
 
 /**
  * @brief Install the character output routine for printk
@@ -63,6 +65,35 @@ int (*_char_out)(int c) = arch_printk_char_out;
 void __printk_hook_install(int (*fn)(int c))
 {
 	_char_out = fn;
+	_str_out = NULL;
+}
+
+/**
+ * @brief Install the string output routine for printk
+ *
+ * Optional. To be called by a console driver that can write a string at
+ * once, after it has installed its character output routine. The routine
+ * must give the same output as the character routine called for each
+ * character. Installing a character output routine removes it.
+ * @param fn string output routine to install
+ */
+void __printk_str_hook_install(int (*fn)(const char *str, size_t len))
+{
+	_str_out = fn;
+}
+
+static void console_str_out(const char *str, size_t len)
+{
+	size_t i;
+
+	if (_str_out != NULL) {
+		_str_out(str, len);
+		return;
+	}
+
+	for (i = 0; i < len; i++) {
+		_char_out(str[i]);
+	}
 }
 
 /**
@@ -90,29 +121,38 @@ static void buf_flush(struct buf_out_context *ctx)
 	ctx->buf_count = 0U;
 }
 
-static int buf_char_out(int c, void *ctx_p)
+static int buf_char_out(const char *str, size_t len, void *ctx_p)
 {
 	struct buf_out_context *ctx = ctx_p;
-
-	ctx->count++;
-	ctx->buf[ctx->buf_count++] = c;
-	if (ctx->buf_count == CONFIG_PRINTK_BUFFER_SIZE) {
-		buf_flush(ctx);
+	size_t n;
+
+	ctx->count += len;
+	while (len > 0) {
+		n = MIN(len, CONFIG_PRINTK_BUFFER_SIZE - ctx->buf_count);
+		memcpy(&ctx->buf[ctx->buf_count], str, n);
+		ctx->buf_count += n;
+		if (ctx->buf_count == CONFIG_PRINTK_BUFFER_SIZE) {
+			buf_flush(ctx);
+		}
+		str += n;
+		len -= n;
 	}
 
-	return c;
+	return 0;
 }
 
 struct out_context {
 	int count;
 };
 
-static int char_out(int c, void *ctx_p)
+static int char_out(const char *str, size_t len, void *ctx_p)
 {
 	struct out_context *ctx = ctx_p;
 
-	ctx->count++;
-	return _char_out(c);
+	ctx->count += len;
+	console_str_out(str, len);
+
+	return 0;
 }
 
 void vprintk(const char *fmt, va_list ap)
@@ -122,10 +162,16 @@ void vprintk(const char *fmt, va_list ap)
 		return;
 	}
 
-	if (k_is_user_context()) {
+	/* Nothing to format, write the string as it is */
+	if (strchr(fmt, '%') == NULL) {
+		k_str_out((char *)fmt, strlen(fmt));
+		return;
+	}
+
+	if (k_is_user_context() || IS_ENABLED(CONFIG_PRINTK_BUFFERED)) {
 		struct buf_out_context ctx = { 0 };
 
-		cbvprintf(buf_char_out, &ctx, fmt, ap);
+		cbvprintf_str(buf_char_out, &ctx, fmt, ap);
 
 		if (ctx.buf_count) {
 			buf_flush(&ctx);
@@ -136,7 +182,7 @@ void vprintk(const char *fmt, va_list ap)
 		k_spinlock_key_t key = k_spin_lock(&lock);
 #endif
 
-		cbvprintf(char_out, &ctx, fmt, ap);
+		cbvprintf_str(char_out, &ctx, fmt, ap);
 
 #ifdef CONFIG_PRINTK_SYNC
 		k_spin_unlock(&lock, key);
@@ -146,14 +192,11 @@ void vprintk(const char *fmt, va_list ap)
 
 void z_impl_k_str_out(char *c, size_t n)
 {
-	size_t i;
 #ifdef CONFIG_PRINTK_SYNC
 	k_spinlock_key_t key = k_spin_lock(&lock);
 #endif
 
-	for (i = 0; i < n; i++) {
-		_char_out(c[i]);
-	}
+	console_str_out(c, n);
 
 #ifdef CONFIG_PRINTK_SYNC
 	k_spin_unlock(&lock, key);
@@ -208,20 +251,25 @@ struct str_context {
 	int count;
 };
 
-static int str_out(int c, struct str_context *ctx)
+static int str_out(const char *str, size_t len, void *ctx_p)
 {
+	struct str_context *ctx = ctx_p;
+	size_t room;
+
 	if (ctx->str == NULL || ctx->count >= ctx->max) {
-		ctx->count++;
-		return c;
+		ctx->count += len;
+		return 0;
 	}
 
-	if (ctx->count == ctx->max - 1) {
-		ctx->str[ctx->count++] = '\0';
-	} else {
-		ctx->str[ctx->count++] = c;
+	/* Keep the last byte for the terminating null character */
+	room = ctx->max - 1 - ctx->count;
+	memcpy(&ctx->str[ctx->count], str, MIN(len, room));
+	if (len > room) {
+		ctx->str[ctx->max - 1] = '\0';
 	}
+	ctx->count += len;
 
-	return c;
+	return 0;
 }
 
 int snprintk(char *str, size_t size, const char *fmt, ...)
@@ -240,7 +288,7 @@ int vsnprintk(char *str, size_t size, const char *fmt, va_list ap)
 {
 	struct str_context ctx = { str, size, 0 };
 
-	cbvprintf(str_out, &ctx, fmt, ap);
+	cbvprintf_str(str_out, &ctx, fmt, ap);
 
 	if (ctx.count < ctx.max) {
 		str[ctx.count] = '\0';
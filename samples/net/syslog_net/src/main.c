@@ -10,6 +10,7 @@ LOG_MODULE_REGISTER(net_syslog, LOG_LEVEL_DBG);
 #include <zephyr/zephyr.h>
 
 #include <zephyr/logging/log_backend.h>
+#include <zephyr/logging/log_backend_net.h>
 
 #include <stdlib.h>
 
@@ -17,10 +18,6 @@ BUILD_ASSERT(IS_ENABLED(CONFIG_LOG_BACKEND_NET), "syslog backend not enabled");
 
 #define SLEEP_BETWEEN_PRINTS 3
 
-#if IS_ENABLED(CONFIG_LOG_BACKEND_NET)
-extern const struct log_backend *log_backend_net_get(void);
-#endif
-
 void main(void)
 {
 	int i, count, sleep;
@@ -7,6 +7,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <zephyr/logging/log_backend.h>
+#include <zephyr/logging/log_backend_fs.h>
 #include <zephyr/logging/log_output_dict.h>
 #include <zephyr/logging/log_backend_std.h>
 #include <assert.h>
@@ -27,6 +28,9 @@ enum backend_fs_state {
 static struct fs_file_t file;
 static enum backend_fs_state backend_state = BACKEND_FS_NOT_INITIALIZED;
 static int file_ctr, newest, oldest;
+static size_t file_size;
+static bool unsynced;
+static struct log_backend_fs_stats stats;
 
 static int allocate_new_file(struct fs_file_t *file);
 static int del_oldest_log(void);
@@ -146,7 +150,7 @@ close_dir:
 	return rc;
 }
 
-int write_log_to_file(uint8_t *data, size_t length, void *ctx)
+static int file_write(uint8_t *data, size_t length, bool sync)
 {
 	int rc;
 	struct fs_file_t *f = &file;
@@ -167,13 +171,7 @@ int write_log_to_file(uint8_t *data, size_t length, void *ctx)
 		/* Check if new data overwrites max file size.
 		 * If so, create new log file.
 		 */
-		int size = fs_tell(f);
-
-		if (size < 0) {
-			backend_state = BACKEND_FS_CORRUPTED;
-
-			return length;
-		} else if ((size + length) > CONFIG_LOG_BACKEND_FS_FILE_SIZE) {
+		if ((file_size + length) > CONFIG_LOG_BACKEND_FS_FILE_SIZE) {
 			rc = allocate_new_file(f);
 
 			if (rc < 0) {
@@ -183,6 +181,11 @@ int write_log_to_file(uint8_t *data, size_t length, void *ctx)
 
 		rc = fs_write(f, data, length);
 		if (rc >= 0) {
+			file_size += rc;
+			stats.bytes += rc;
+			stats.writes++;
+			unsynced = true;
+
 			if (IS_ENABLED(CONFIG_LOG_BACKEND_FS_OVERWRITE) &&
 			    (rc != length)) {
 				del_oldest_log();
@@ -211,10 +214,14 @@ int write_log_to_file(uint8_t *data, size_t length, void *ctx)
 			length = 0;
 		}
 
-		rc = fs_sync(f);
-		if (rc < 0) {
-			/* Something is wrong */
-			goto on_error;
+		if (sync) {
+			rc = fs_sync(f);
+			stats.syncs++;
+			unsynced = false;
+			if (rc < 0) {
+				/* Something is wrong */
+				goto on_error;
+			}
 		}
 	}
 
@@ -225,6 +232,134 @@ on_error:
 	return length;
 }
 
+#if defined(CONFIG_LOG_BACKEND_FS_BUFFERED)
+static uint8_t stage_buf[CONFIG_LOG_BACKEND_FS_BUFFER_SIZE];
+static size_t staged;
+static K_MUTEX_DEFINE(stage_lock);
+
+static void write_staged(void)
+{
+	size_t offset = 0;
+	bool retry = true;
+
+	while (offset < staged) {
+		int rc = file_write(&stage_buf[offset], staged - offset,
+				    false);
+
+		if (rc == 0) {
+			/* Space was freed by removing the oldest log */
+			if (!retry) {
+				break;
+			}
+			retry = false;
+		}
+
+		offset += rc;
+	}
+
+	staged = 0;
+}
+
+static int stage_flush(void)
+{
+	int rc = 0;
+
+	write_staged();
+
+	if (unsynced && backend_state == BACKEND_FS_OK) {
+		rc = fs_sync(&file);
+		stats.syncs++;
+		if (rc < 0) {
+			backend_state = BACKEND_FS_CORRUPTED;
+		}
+	}
+
+	unsynced = false;
+
+	return rc;
+}
+
+static void flush_work_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	(void)log_backend_fs_sync();
+}
+
+static K_WORK_DELAYABLE_DEFINE(flush_work, flush_work_handler);
+
+static int stage_write(uint8_t *data, size_t length)
+{
+	int rc = length;
+
+	/* Output is discarded as long as the file system is not usable */
+	if (backend_state == BACKEND_FS_CORRUPTED ||
+	    (backend_state == BACKEND_FS_NOT_INITIALIZED &&
+	     check_log_volumen_available())) {
+		return length;
+	}
+
+	k_mutex_lock(&stage_lock, K_FOREVER);
+
+	/* Commit the buffer when it is full. The data is also written when
+	 * the next chunk would not fit into the current file so that files
+	 * are changed on chunk boundaries as without buffering.
+	 */
+	if ((staged + length) > sizeof(stage_buf)) {
+		(void)stage_flush();
+	} else if ((file_size + staged + length) >
+		   CONFIG_LOG_BACKEND_FS_FILE_SIZE) {
+		write_staged();
+	}
+
+	if (length > sizeof(stage_buf) ||
+	    (file_size + length) > CONFIG_LOG_BACKEND_FS_FILE_SIZE) {
+		rc = file_write(data, length, false);
+	} else {
+		memcpy(&stage_buf[staged], data, length);
+		staged += length;
+	}
+
+	if (staged || unsynced) {
+		k_work_schedule(&flush_work,
+				K_MSEC(CONFIG_LOG_BACKEND_FS_SYNC_INTERVAL));
+	}
+
+	k_mutex_unlock(&stage_lock);
+
+	return rc;
+}
+#endif /* CONFIG_LOG_BACKEND_FS_BUFFERED */
+
+int write_log_to_file(uint8_t *data, size_t length, void *ctx)
+{
+#if defined(CONFIG_LOG_BACKEND_FS_BUFFERED)
+	return stage_write(data, length);
+#else
+	return file_write(data, length, true);
+#endif
+}
+
+int log_backend_fs_sync(void)
+{
+#if defined(CONFIG_LOG_BACKEND_FS_BUFFERED)
+	int rc;
+
+	k_mutex_lock(&stage_lock, K_FOREVER);
+	rc = stage_flush();
+	k_mutex_unlock(&stage_lock);
+
+	return rc;
+#else
+	return 0;
+#endif
+}
+
+void log_backend_fs_get_stats(struct log_backend_fs_stats *out)
+{
+	*out = stats;
+}
+
 static int get_log_file_id(struct fs_dirent *ent)
 {
 	size_t len;
@@ -392,6 +527,7 @@ static int allocate_new_file(struct fs_file_t *file)
 	}
 	++file_ctr;
 	newest = curr_file_num;
+	file_size = 0;
 
 out:
 	return rc;
@@ -440,6 +576,14 @@ static void log_backend_fs_init(const struct log_backend *const backend)
 
 static void panic(struct log_backend const *const backend)
 {
+#if defined(CONFIG_LOG_BACKEND_FS_BUFFERED)
+	/* Commit what was already logged before giving up. Nothing else
+	 * runs anymore so the buffer is accessed without locking.
+	 */
+	(void)k_work_cancel_delayable(&flush_work);
+	(void)stage_flush();
+#endif
+
 	/* In case of panic deinitialize backend. It is better to keep
 	 * current data rather than log new and risk of failure.
 	 */
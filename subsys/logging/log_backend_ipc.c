@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log_backend.h>
+#include <zephyr/logging/log_core.h>
+#include <zephyr/logging/log_output.h>
+#include <zephyr/logging/log_output_dict.h>
+#include <zephyr/logging/log_backend_std.h>
+#include <zephyr/device.h>
+#include <zephyr/ipc/ipc_service.h>
+#include <zephyr/sys/atomic.h>
+#include <string.h>
+
+/* Messages are not formatted here. They are sent as in the dictionary
+ * output mode (header, cbprintf package and hexdump data) and decoded by
+ * the receiver, e.g. forwarded to the host and parsed with the dictionary
+ * log parser.
+ */
+
+static const struct device *const ipc_instance =
+	DEVICE_DT_GET(DT_CHOSEN(zephyr_log_ipc));
+static struct ipc_ept ept;
+static bool registered;
+static atomic_t bound;
+
+static uint8_t msg_buf[CONFIG_LOG_BACKEND_IPC_BUFFER_SIZE];
+static size_t msg_len;
+
+static void msg_send(void)
+{
+	if (msg_len == 0) {
+		return;
+	}
+
+	/* Output is dropped until the remote binds the endpoint. */
+	if (atomic_get(&bound)) {
+		(void)ipc_service_send(&ept, msg_buf, msg_len);
+	}
+
+	msg_len = 0;
+}
+
+static int msg_out(uint8_t *data, size_t length, void *ctx)
+{
+	size_t len = MIN(length, sizeof(msg_buf) - msg_len);
+
+	ARG_UNUSED(ctx);
+
+	memcpy(&msg_buf[msg_len], data, len);
+	msg_len += len;
+
+	if (msg_len == sizeof(msg_buf)) {
+		msg_send();
+	}
+
+	return len;
+}
+
+/* Dictionary output writes directly to the output function and does not
+ * use the log_output buffer.
+ */
+static uint8_t ipc_output_buf[1];
+LOG_OUTPUT_DEFINE(log_output_ipc, msg_out, ipc_output_buf,
+		  sizeof(ipc_output_buf));
+
+static void process(const struct log_backend *const backend,
+		    union log_msg2_generic *msg)
+{
+	log_dict_output_msg2_process(&log_output_ipc, &msg->log,
+				     log_backend_std_get_flags());
+
+	/* Whole message in one transfer if it fits */
+	msg_send();
+}
+
+static void ept_bound(void *priv)
+{
+	atomic_set(&bound, 1);
+}
+
+static void ept_recv(const void *data, size_t len, void *priv)
+{
+	/* Nothing is expected from the remote */
+}
+
+static struct ipc_ept_cfg ept_cfg = {
+	.name = "logging",
+	.cb = {
+		.bound = ept_bound,
+		.received = ept_recv,
+	},
+};
+
+static int ept_register(void)
+{
+	int err;
+
+	if (!device_is_ready(ipc_instance)) {
+		return -ENODEV;
+	}
+
+	err = ipc_service_open_instance(ipc_instance);
+	if (err < 0 && err != -EALREADY) {
+		return err;
+	}
+
+	err = ipc_service_register_endpoint(ipc_instance, &ept, &ept_cfg);
+	if (err < 0) {
+		return err;
+	}
+
+	registered = true;
+
+	return 0;
+}
+
+static void log_backend_ipc_init(struct log_backend const *const backend)
+{
+	/* Retried in is_ready() if the instance is not initialized yet. */
+	(void)ept_register();
+}
+
+static int is_ready(struct log_backend const *const backend)
+{
+	if (!registered && ept_register() < 0) {
+		return -EBUSY;
+	}
+
+	return atomic_get(&bound) ? 0 : -EBUSY;
+}
+
+static void panic(struct log_backend const *const backend)
+{
+	msg_send();
+}
+
+static void dropped(const struct log_backend *const backend, uint32_t cnt)
+{
+	ARG_UNUSED(backend);
+
+	log_dict_output_dropped_process(&log_output_ipc, cnt);
+	msg_send();
+}
+
+const struct log_backend_api log_backend_ipc_api = {
+	.process = process,
+	.panic = panic,
+	.init = log_backend_ipc_init,
+	.is_ready = is_ready,
+	.dropped = dropped,
+};
+
+LOG_BACKEND_DEFINE(log_backend_ipc, log_backend_ipc_api, true);
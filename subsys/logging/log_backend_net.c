@@ -8,6 +8,7 @@
 LOG_MODULE_REGISTER(log_backend_net, CONFIG_LOG_DEFAULT_LEVEL);
 
 #include <zephyr/logging/log_backend.h>
+#include <zephyr/logging/log_backend_net.h>
 #include <zephyr/logging/log_core.h>
 #include <zephyr/logging/log_output.h>
 #include <zephyr/net/net_pkt.h>
@@ -35,13 +36,20 @@ static bool net_init_done;
 struct sockaddr server_addr;
 static bool panic_mode;
 static uint32_t log_format_current = CONFIG_LOG_BACKEND_NET_OUTPUT_DEFAULT;
+static struct log_backend_net_stats stats;
+static K_MUTEX_DEFINE(net_lock);
 
-const struct log_backend *log_backend_net_get(void);
+#if defined(CONFIG_LOG_BACKEND_NET_BATCH)
+#define TX_BUF_SIZE MAX(CONFIG_LOG_BACKEND_NET_MAX_BUF_SIZE, \
+			CONFIG_LOG_BACKEND_NET_BATCH_SIZE)
+#else
+#define TX_BUF_SIZE CONFIG_LOG_BACKEND_NET_MAX_BUF_SIZE
+#endif
 
 NET_PKT_SLAB_DEFINE(syslog_tx_pkts, CONFIG_LOG_BACKEND_NET_MAX_BUF);
 NET_PKT_DATA_POOL_DEFINE(syslog_tx_bufs,
-			 ROUND_UP(CONFIG_LOG_BACKEND_NET_MAX_BUF_SIZE /
-				  CONFIG_NET_BUF_DATA_SIZE, 1) *
+			 ceiling_fraction(TX_BUF_SIZE,
+					  CONFIG_NET_BUF_DATA_SIZE) *
 			 CONFIG_LOG_BACKEND_NET_MAX_BUF);
 
 static struct k_mem_slab *get_tx_slab(void)
@@ -54,26 +62,150 @@ struct net_buf_pool *get_data_pool(void)
 	return &syslog_tx_bufs;
 }
 
+static int line_out(uint8_t *data, size_t length, void *output_ctx);
+
+LOG_OUTPUT_DEFINE(log_output_net, line_out, output_buf, sizeof(output_buf));
+
+#if defined(CONFIG_LOG_BACKEND_NET_BATCH)
+/* Messages are framed with octet counting (RFC 6587), "MSG-LEN SP MSG".
+ * The length of a message never exceeds four digits as the datagram is
+ * limited to 1472 bytes.
+ */
+#define FRAME_HDR_MAX_LEN sizeof("1472 ")
+
+static uint8_t msg_buf[CONFIG_LOG_BACKEND_NET_BATCH_SIZE - FRAME_HDR_MAX_LEN];
+static size_t msg_len;
+static bool msg_truncated;
+
+static uint8_t batch_buf[CONFIG_LOG_BACKEND_NET_BATCH_SIZE];
+static size_t batch_len;
+
+static void batch_timeout(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(batch_work, batch_timeout);
+
+/* Must be called with net_lock held, except on panic. */
+static int batch_send(void)
+{
+	struct net_context *ctx = log_output_net.control_block->ctx;
+	int ret;
+
+	if (stats.queued == 0U) {
+		return 0;
+	}
+
+	if (ctx == NULL) {
+		ret = -ENOTCONN;
+	} else {
+		ret = net_context_send(ctx, batch_buf, batch_len, NULL,
+				       K_NO_WAIT, NULL);
+	}
+
+	if (ret < 0) {
+		stats.dropped += stats.queued;
+	} else {
+		stats.sent += stats.queued;
+		stats.datagrams++;
+	}
+
+	stats.queued = 0U;
+	batch_len = 0;
+
+	(void)k_work_cancel_delayable(&batch_work);
+
+	return ret < 0 ? ret : 0;
+}
+
+static void batch_timeout(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	k_mutex_lock(&net_lock, K_FOREVER);
+	(void)batch_send();
+	k_mutex_unlock(&net_lock);
+}
+
+/* Move the formatted message to the datagram, sending the datagram first
+ * if the message does not fit in it anymore.
+ */
+static void batch_add(void)
+{
+	char hdr[FRAME_HDR_MAX_LEN];
+	int hdr_len;
+
+	if (msg_len == 0) {
+		return;
+	}
+
+	hdr_len = snprintk(hdr, sizeof(hdr), "%u ", (unsigned int)msg_len);
+
+	k_mutex_lock(&net_lock, K_FOREVER);
+
+	if (batch_len + hdr_len + msg_len > sizeof(batch_buf)) {
+		(void)batch_send();
+	}
+
+	memcpy(&batch_buf[batch_len], hdr, hdr_len);
+	memcpy(&batch_buf[batch_len + hdr_len], msg_buf, msg_len);
+	batch_len += hdr_len + msg_len;
+
+	if (msg_truncated) {
+		stats.truncated++;
+	}
+
+	if (stats.queued++ == 0U) {
+		(void)k_work_schedule(&batch_work,
+			K_MSEC(CONFIG_LOG_BACKEND_NET_BATCH_TIMEOUT));
+	}
+
+	k_mutex_unlock(&net_lock);
+
+	msg_len = 0;
+	msg_truncated = false;
+}
+
+static int line_out(uint8_t *data, size_t length, void *output_ctx)
+{
+	size_t len = MIN(length, sizeof(msg_buf) - msg_len);
+
+	ARG_UNUSED(output_ctx);
+
+	memcpy(&msg_buf[msg_len], data, len);
+	msg_len += len;
+
+	if (len < length) {
+		msg_truncated = true;
+	}
+
+	return length;
+}
+#else
+static bool msg_failed;
+
 static int line_out(uint8_t *data, size_t length, void *output_ctx)
 {
 	struct net_context *ctx = (struct net_context *)output_ctx;
 	int ret = -ENOMEM;
 
 	if (ctx == NULL) {
+		msg_failed = true;
 		return length;
 	}
 
 	ret = net_context_send(ctx, data, length, NULL, K_NO_WAIT, NULL);
 	if (ret < 0) {
+		msg_failed = true;
 		goto fail;
 	}
 
+	k_mutex_lock(&net_lock, K_FOREVER);
+	stats.datagrams++;
+	k_mutex_unlock(&net_lock);
+
 	DBG(data);
 fail:
 	return length;
 }
-
-LOG_OUTPUT_DEFINE(log_output_net, line_out, output_buf, sizeof(output_buf));
+#endif /* CONFIG_LOG_BACKEND_NET_BATCH */
 
 static int do_net_init(void)
 {
@@ -188,6 +320,22 @@ static void process(const struct log_backend *const backend,
 	log_format_func_t log_output_func = log_format_func_t_get(log_format_current);
 
 	log_output_func(&log_output_net, &msg->log, flags);
+
+#if defined(CONFIG_LOG_BACKEND_NET_BATCH)
+	batch_add();
+#else
+	k_mutex_lock(&net_lock, K_FOREVER);
+
+	if (msg_failed) {
+		stats.dropped++;
+	} else {
+		stats.sent++;
+	}
+
+	k_mutex_unlock(&net_lock);
+
+	msg_failed = false;
+#endif
 }
 
 static int format_set(const struct log_backend *const backend, uint32_t log_type)
@@ -216,6 +364,15 @@ static void init_net(struct log_backend const *const backend)
 
 static void panic(struct log_backend const *const backend)
 {
+#if defined(CONFIG_LOG_BACKEND_NET_BATCH)
+	/* Messages before the panic are often the most important ones, send
+	 * them now as the delayed work may never run. The lock is not taken,
+	 * nothing else is logging anymore.
+	 */
+	(void)k_work_cancel_delayable(&batch_work);
+	(void)batch_send();
+#endif
+
 	panic_mode = true;
 }
 
@@ -236,3 +393,23 @@ const struct log_backend *log_backend_net_get(void)
 {
 	return &log_backend_net;
 }
+
+int log_backend_net_flush(void)
+{
+	int ret = 0;
+
+#if defined(CONFIG_LOG_BACKEND_NET_BATCH)
+	k_mutex_lock(&net_lock, K_FOREVER);
+	ret = batch_send();
+	k_mutex_unlock(&net_lock);
+#endif
+
+	return ret;
+}
+
+void log_backend_net_get_stats(struct log_backend_net_stats *net_stats)
+{
+	k_mutex_lock(&net_lock, K_FOREVER);
+	*net_stats = stats;
+	k_mutex_unlock(&net_lock);
+}
@@ -0,0 +1,453 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log_backend.h>
+#include <zephyr/logging/log_backend_retained.h>
+#include <zephyr/logging/log_core.h>
+#include <zephyr/logging/log_ctrl.h>
+#include <zephyr/linker/section_tags.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/crc.h>
+#include <string.h>
+
+/* Messages are stored unformatted (header, cbprintf package and hexdump data)
+ * as records in a ring buffer located in RAM which is not initialized on
+ * boot. Each record has a sequence number and CRC so a record which was
+ * being written when reset occurred is detected and discarded.
+ *
+ * Only the offset of the oldest record is stored besides the records. On
+ * boot, records are walked from that offset for as long as CRC is valid and
+ * sequence numbers are consecutive. Read-only strings in packages are stored
+ * as pointers so records are only valid for the same image, see image_id().
+ */
+
+#define RETAINED_MAGIC 0x4c4f4752 /* "LOGR" */
+
+#define ALIGN Z_LOG_MSG2_ALIGNMENT
+
+struct retained_hdr {
+	uint32_t magic;
+	uint32_t id;
+	uint32_t tail;
+};
+
+struct record_hdr {
+	uint32_t crc;
+	uint32_t seq;
+	/* Message length in bytes, 0 if next record is at the beginning. */
+	uint16_t len;
+	uint16_t reserved;
+};
+
+#define RETAINED_HDR_SIZE ROUND_UP(sizeof(struct retained_hdr), ALIGN)
+#define RECORD_HDR_SIZE ROUND_UP(sizeof(struct record_hdr), ALIGN)
+#define RING_SIZE ROUND_DOWN(CONFIG_LOG_BACKEND_RETAINED_SIZE - \
+			     RETAINED_HDR_SIZE, ALIGN)
+
+BUILD_ASSERT(RING_SIZE >= 2 * (RECORD_HDR_SIZE +
+			       CONFIG_LOG_BACKEND_RETAINED_MSG_SIZE),
+	     "Buffer too small for the maximal message size");
+
+/* Not static, accessed by tests. */
+uint8_t log_backend_retained_buf[CONFIG_LOG_BACKEND_RETAINED_SIZE]
+	__noinit __aligned(ALIGN);
+
+#define RETAINED_HDR ((struct retained_hdr *)log_backend_retained_buf)
+#define RING (&log_backend_retained_buf[RETAINED_HDR_SIZE])
+
+static struct k_spinlock lock;
+static bool initialized;
+static uint32_t head;
+static uint32_t cnt;
+static uint32_t seq;
+/* Sequence number of the first record stored in this boot. */
+static uint32_t boot_seq;
+
+/* Replayed message, aligned as messages in the log buffer. */
+static uint8_t replay_buf[CONFIG_LOG_BACKEND_RETAINED_MSG_SIZE] __aligned(ALIGN);
+static atomic_t replay_busy;
+
+static inline struct record_hdr *record_get(uint32_t off)
+{
+	return (struct record_hdr *)&RING[off];
+}
+
+static inline uint32_t record_size(uint16_t len)
+{
+	return RECORD_HDR_SIZE + ROUND_UP(len, ALIGN);
+}
+
+static uint32_t record_crc(const struct record_hdr *rec)
+{
+	uint32_t crc;
+
+	crc = crc32_ieee((const uint8_t *)&rec->seq,
+			 sizeof(*rec) - offsetof(struct record_hdr, seq));
+
+	return crc32_ieee_update(crc, (const uint8_t *)rec + RECORD_HDR_SIZE,
+				 rec->len);
+}
+
+static bool record_valid(uint32_t off, uint32_t exp_seq)
+{
+	struct record_hdr *rec = record_get(off);
+
+	return (rec->seq == exp_seq) &&
+	       (off + record_size(rec->len) <= RING_SIZE) &&
+	       (rec->len <= CONFIG_LOG_BACKEND_RETAINED_MSG_SIZE) &&
+	       (rec->crc == record_crc(rec));
+}
+
+/* Offset of the record at @p off or the beginning of the ring if the record
+ * would not fit at the end of the ring.
+ */
+static uint32_t record_next(uint32_t off)
+{
+	if ((RING_SIZE - off) < RECORD_HDR_SIZE ||
+	    record_get(off)->len == 0) {
+		return 0;
+	}
+
+	return off;
+}
+
+#if defined(CONFIG_ARM) || defined(CONFIG_ARC) || defined(CONFIG_X86) || \
+	defined(CONFIG_ARM64) || defined(CONFIG_NIOS2) || \
+	defined(CONFIG_RISCV) || defined(CONFIG_SPARC) || defined(CONFIG_MIPS)
+extern char __rodata_region_start[];
+extern char __rodata_region_end[];
+#define RO_START __rodata_region_start
+#define RO_END __rodata_region_end
+#elif defined(CONFIG_SOC_ESP32) || defined(CONFIG_SOC_ESP32S2) || \
+	defined(CONFIG_SOC_NXP_IMX8) || defined(CONFIG_SOC_NXP_IMX8M) || \
+	defined(CONFIG_SOC_XTENSA_SAMPLE_CONTROLLER)
+/* Xtensa linker scripts are per SoC, only these are known to mark rodata */
+extern char _rodata_start[];
+extern char _rodata_end[];
+#define RO_START _rodata_start
+#define RO_END _rodata_end
+#endif
+
+/* Packages refer to strings in read-only data, so the image is identified
+ * by CRC of the read-only data. It takes a while on big images so it is
+ * calculated once, outside of the lock. Where read-only data cannot be
+ * located (e.g. native_posix, where RAM is not retained over a restart
+ * anyway), only the layout is checked.
+ */
+static uint32_t image_id(void)
+{
+	static uint32_t id;
+
+	if (id == 0) {
+#ifdef RO_START
+		id = crc32_ieee((const uint8_t *)RO_START, RO_END - RO_START);
+#else
+		id = (uint32_t)(uintptr_t)__log_const_start ^
+		     (log_src_cnt_get(CONFIG_LOG_DOMAIN_ID) << 16);
+#endif
+		id = (id ^ RING_SIZE) | 1;
+	}
+
+	return id;
+}
+
+static void ring_reset(void)
+{
+	memset(log_backend_retained_buf, 0, sizeof(log_backend_retained_buf));
+	RETAINED_HDR->magic = RETAINED_MAGIC;
+	RETAINED_HDR->id = image_id();
+	RETAINED_HDR->tail = 0;
+	head = 0;
+	cnt = 0;
+}
+
+/* Validate records found after reset. Must be called with the lock held. */
+static void ring_init(void)
+{
+	uint32_t off = RETAINED_HDR->tail;
+	uint32_t walked = 0;
+	struct record_hdr *rec;
+
+	initialized = true;
+
+	if (RETAINED_HDR->magic != RETAINED_MAGIC ||
+	    RETAINED_HDR->id != image_id() ||
+	    RETAINED_HDR->tail >= RING_SIZE ||
+	    (RETAINED_HDR->tail % ALIGN) != 0) {
+		ring_reset();
+		seq = 0;
+		boot_seq = 0;
+		return;
+	}
+
+	cnt = 0;
+	seq = record_get(off)->seq;
+
+	while (walked < RING_SIZE) {
+		if ((RING_SIZE - off) < RECORD_HDR_SIZE) {
+			walked += RING_SIZE - off;
+			off = 0;
+			continue;
+		}
+
+		if (!record_valid(off, seq)) {
+			break;
+		}
+
+		rec = record_get(off);
+
+		if (rec->len == 0) {
+			walked += RING_SIZE - off;
+			off = 0;
+		} else {
+			walked += record_size(rec->len);
+			off += record_size(rec->len);
+			seq++;
+			cnt++;
+		}
+	}
+
+	head = off;
+	if (cnt == 0) {
+		RETAINED_HDR->tail = head;
+	}
+
+	boot_seq = seq;
+}
+
+/* Must be called with the lock held. */
+static void drop_oldest(void)
+{
+	uint32_t tail = RETAINED_HDR->tail;
+
+	tail += record_size(record_get(tail)->len);
+	cnt--;
+
+	RETAINED_HDR->tail = (cnt == 0) ? head : record_next(tail);
+}
+
+/* Drop records which are in the area of @p len bytes at @p off. */
+static void make_room(uint32_t off, uint32_t len)
+{
+	while (cnt > 0 && RETAINED_HDR->tail >= off &&
+	       RETAINED_HDR->tail < off + len) {
+		drop_oldest();
+	}
+}
+
+/* Copy package with strings which are not read-only appended as only the
+ * image content is valid after reset.
+ */
+static int package_copy(struct log_msg2 *msg, uint8_t *buf, size_t len)
+{
+	size_t plen;
+	uint8_t *package = log_msg2_get_package(msg, &plen);
+
+	if (plen == 0) {
+		return 0;
+	}
+
+	return cbprintf_package_copy(package, plen, buf, len,
+				     CBPRINTF_PACKAGE_COPY_RW_STR, NULL, 0);
+}
+
+/* Write record at @p off. Writes a record which indicates that the next
+ * record is at the beginning of the ring if @p msg is NULL. Such record
+ * does not consume a sequence number.
+ */
+static void record_write(uint32_t off, struct log_msg2 *msg, uint16_t len)
+{
+	struct record_hdr *rec = record_get(off);
+
+	rec->seq = seq;
+	rec->len = len;
+	rec->reserved = 0;
+
+	if (msg != NULL) {
+		struct log_msg2 *out = (struct log_msg2 *)((uint8_t *)rec +
+							   RECORD_HDR_SIZE);
+		size_t dlen;
+		uint8_t *data = log_msg2_get_data(msg, &dlen);
+		int plen;
+
+		plen = package_copy(msg, out->data,
+				    len - offsetof(struct log_msg2, data));
+		__ASSERT_NO_MSG(plen >= 0);
+
+		out->hdr = msg->hdr;
+		out->hdr.desc.package_len = plen;
+		memcpy(&out->data[plen], data, dlen);
+		seq++;
+	}
+
+	rec->crc = record_crc(rec);
+}
+
+static void process(const struct log_backend *const backend,
+		    union log_msg2_generic *msg)
+{
+	struct log_msg2_desc desc = msg->log.hdr.desc;
+	k_spinlock_key_t key;
+	uint32_t size;
+	int plen;
+
+	ARG_UNUSED(backend);
+
+	plen = package_copy(&msg->log, NULL, 0);
+	if (plen < 0) {
+		return;
+	}
+
+	desc.package_len = plen;
+	size = log_msg2_get_total_wlen(desc) * sizeof(uint32_t);
+	if (size > CONFIG_LOG_BACKEND_RETAINED_MSG_SIZE) {
+		return;
+	}
+
+	(void)image_id();
+
+	key = k_spin_lock(&lock);
+
+	if (!initialized) {
+		ring_init();
+	}
+
+	if ((RING_SIZE - head) < record_size(size)) {
+		make_room(head, RING_SIZE - head);
+		if ((RING_SIZE - head) >= RECORD_HDR_SIZE) {
+			record_write(head, NULL, 0);
+		}
+
+		head = 0;
+	}
+
+	make_room(head, record_size(size));
+	record_write(head, &msg->log, size);
+	head += record_size(size);
+	cnt++;
+
+	k_spin_unlock(&lock, key);
+}
+
+static void log_backend_retained_init(struct log_backend const *const backend)
+{
+	k_spinlock_key_t key;
+
+	(void)image_id();
+
+	key = k_spin_lock(&lock);
+
+	ring_init();
+
+	k_spin_unlock(&lock, key);
+}
+
+static void panic(struct log_backend const *const backend)
+{
+	/* Messages are stored in RAM, nothing to flush. */
+	ARG_UNUSED(backend);
+}
+
+static void dropped(const struct log_backend *const backend, uint32_t cnt)
+{
+	ARG_UNUSED(backend);
+	ARG_UNUSED(cnt);
+}
+
+/* Copy record with sequence number @p rd_seq, or the oldest record if it
+ * was overwritten, to the replay buffer. Returns false if there are no more
+ * records stored before boot.
+ */
+static bool replay_get(uint32_t *rd, uint32_t *rd_seq)
+{
+	struct record_hdr *rec;
+	k_spinlock_key_t key;
+	bool ret = false;
+
+	(void)image_id();
+
+	key = k_spin_lock(&lock);
+
+	if (!initialized) {
+		ring_init();
+	}
+
+	if (cnt == 0) {
+		goto out;
+	}
+
+	rec = record_get(RETAINED_HDR->tail);
+	if (rec->seq > *rd_seq) {
+		*rd = RETAINED_HDR->tail;
+		*rd_seq = rec->seq;
+	}
+
+	*rd = record_next(*rd);
+	rec = record_get(*rd);
+
+	if (*rd_seq >= boot_seq || !record_valid(*rd, *rd_seq)) {
+		goto out;
+	}
+
+	memcpy(replay_buf, (uint8_t *)rec + RECORD_HDR_SIZE, rec->len);
+	*rd += record_size(rec->len);
+	*rd_seq += 1;
+	ret = true;
+
+out:
+	k_spin_unlock(&lock, key);
+
+	return ret;
+}
+
+int log_backend_retained_replay(const struct log_backend *backend)
+{
+	uint32_t rd = 0;
+	uint32_t rd_seq = 0;
+	int n = 0;
+
+	__ASSERT_NO_MSG(backend != NULL);
+
+	if (!atomic_cas(&replay_busy, 0, 1)) {
+		return -EBUSY;
+	}
+
+	while (replay_get(&rd, &rd_seq)) {
+		log_backend_msg2_process(backend,
+					 (union log_msg2_generic *)replay_buf);
+		n++;
+	}
+
+	atomic_clear(&replay_busy);
+
+	return n;
+}
+
+void log_backend_retained_clear(void)
+{
+	k_spinlock_key_t key;
+
+	(void)image_id();
+
+	key = k_spin_lock(&lock);
+
+	initialized = true;
+	ring_reset();
+	boot_seq = seq;
+
+	k_spin_unlock(&lock, key);
+}
+
+const struct log_backend_api log_backend_retained_api = {
+	.process = process,
+	.panic = panic,
+	.init = log_backend_retained_init,
+	.dropped = dropped,
+};
+
+LOG_BACKEND_DEFINE(log_backend_retained, log_backend_retained_api,
+		   IS_ENABLED(CONFIG_LOG_BACKEND_RETAINED_AUTOSTART));
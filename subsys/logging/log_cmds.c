@@ -387,6 +387,20 @@ static int cmd_log_mem(const struct shell *sh, size_t argc, char **argv)
 	return 0;
 }
 
+static int cmd_log_suppressed(const struct shell *sh, size_t argc, char **argv)
+{
+	uint32_t ratelimited;
+	uint32_t repeated;
+
+	(void)log_suppressed_get(&ratelimited, &repeated);
+
+	shell_print(sh, "Suppressed log messages:");
+	shell_print(sh, "\tRate limited: %u", ratelimited);
+	shell_print(sh, "\tRepeated: %u", repeated);
+
+	return 0;
+}
+
 SHELL_STATIC_SUBCMD_SET_CREATE(sub_log_backend,
 	SHELL_CMD_ARG(disable, &dsub_module_name,
 		  "'log disable <module_0> .. <module_n>' disables logs in "
@@ -437,6 +451,8 @@ SHELL_STATIC_SUBCMD_SET_CREATE(
 		       cmd_log_self_status),
 	SHELL_COND_CMD(CONFIG_LOG_MODE_DEFERRED, mem, NULL, "Logger memory usage",
 		       cmd_log_mem),
+	SHELL_COND_CMD(CONFIG_LOG_SUPPRESS, suppressed, NULL,
+		       "Number of suppressed log messages", cmd_log_suppressed),
 	SHELL_SUBCMD_SET_END);
 
 SHELL_CMD_REGISTER(log, &sub_log_stat, "Commands for controlling logger",
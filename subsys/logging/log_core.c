@@ -345,6 +345,10 @@ void z_impl_log_panic(void)
 	 */
 	(void)z_log_init(true, false);
 
+	if (IS_ENABLED(CONFIG_LOG_DEDUP)) {
+		z_log_suppress_flush();
+	}
+
 	if (IS_ENABLED(CONFIG_LOG_FRONTEND)) {
 		log_frontend_panic();
 	}
@@ -406,6 +410,8 @@ static void msg_process(union log_msg2_generic *msg)
 {
 	struct log_backend const *backend;
 
+	z_log_output_cache_reset(&msg->log);
+
 	for (int i = 0; i < log_backend_count_get(); i++) {
 		backend = log_backend_get(i);
 		if (log_backend_is_active(backend) &&
@@ -413,6 +419,8 @@ static void msg_process(union log_msg2_generic *msg)
 			log_backend_msg2_process(backend, msg);
 		}
 	}
+
+	z_log_output_cache_reset(NULL);
 }
 
 void dropped_notify(void)
@@ -614,6 +622,18 @@ int log_mem_get_max_usage(uint32_t *max)
 	return mpsc_pbuf_get_max_utilization(&log_buffer, max);
 }
 
+#ifndef CONFIG_LOG_SUPPRESS
+int log_ratelimit_set(uint32_t domain_id, int16_t source_id, uint16_t burst)
+{
+	return -ENOTSUP;
+}
+
+int log_suppressed_get(uint32_t *ratelimited, uint32_t *repeated)
+{
+	return -ENOTSUP;
+}
+#endif
+
 static void log_process_thread_timer_expiry_fn(struct k_timer *timer)
 {
 	k_sem_give(&log_process_thread_sem);
@@ -13,6 +13,7 @@
 #include <time.h>
 #include <stdio.h>
 #include <stdbool.h>
+#include <string.h>
 
 #define LOG_COLOR_CODE_DEFAULT "\x1B[0m"
 #define LOG_COLOR_CODE_RED     "\x1B[1;31m"
@@ -100,37 +101,172 @@ static int level_to_rfc5424_severity(uint32_t level)
 	return ret;
 }
 
-static int out_func(int c, void *ctx)
+static void buffer_write(log_output_func_t outf, uint8_t *buf, size_t len,
+			 void *ctx)
+{
+	int processed;
+
+	do {
+		processed = outf(buf, len, ctx);
+		len -= processed;
+		buf += processed;
+	} while (len != 0);
+}
+
+#ifdef CONFIG_LOG_OUTPUT_FORMAT_CACHE
+/* Text of the message being passed to the backends. It is filled only by
+ * the output and the thread that started the capture, so other contexts
+ * formatting at the same time (e.g. a backend formatting its own copy of
+ * the message in another thread) do not end up in the cached text.
+ */
+static struct {
+	struct log_msg2 *msg;
+	const struct log_output *output;
+	k_tid_t thread;
+	uint32_t flags;
+	size_t len;
+	bool valid;
+	bool capture;
+	uint8_t buf[CONFIG_LOG_OUTPUT_FORMAT_CACHE_SIZE];
+} format_cache;
+
+void z_log_output_cache_reset(struct log_msg2 *msg)
+{
+	format_cache.msg = msg;
+	format_cache.output = NULL;
+	format_cache.valid = false;
+	format_cache.capture = false;
+}
+
+static bool cache_owner(const struct log_output *output)
+{
+	return format_cache.capture && output == format_cache.output &&
+	       !k_is_in_isr() && k_current_get() == format_cache.thread;
+}
+
+static bool cache_output(const struct log_output *output,
+			 struct log_msg2 *msg, uint32_t flags)
+{
+	if (msg != format_cache.msg ||
+	    (flags & LOG_OUTPUT_FLAG_FORMAT_SYSLOG) ||
+	    format_cache.capture || k_is_in_isr()) {
+		return false;
+	}
+
+	if (format_cache.valid && format_cache.flags == flags) {
+		buffer_write(output->func, format_cache.buf, format_cache.len,
+			     output->control_block->ctx);
+		return true;
+	}
+
+	/* Keep the text of this formatting for the next backends */
+	format_cache.output = output;
+	format_cache.thread = k_current_get();
+	format_cache.flags = flags;
+	format_cache.len = 0;
+	format_cache.valid = false;
+	format_cache.capture = true;
+
+	return false;
+}
+
+static void cache_append(const struct log_output *output,
+			 const char *str, size_t len)
+{
+	if (!cache_owner(output)) {
+		return;
+	}
+
+	if (len > sizeof(format_cache.buf) - format_cache.len) {
+		format_cache.capture = false;
+		return;
+	}
+
+	memcpy(&format_cache.buf[format_cache.len], str, len);
+	format_cache.len += len;
+}
+
+static void cache_complete(const struct log_output *output,
+			   struct log_msg2 *msg)
+{
+	if (!cache_owner(output)) {
+		return;
+	}
+
+	/* Not valid if the formatting was interrupted by another message */
+	if (msg == format_cache.msg) {
+		format_cache.valid = true;
+	}
+
+	format_cache.capture = false;
+}
+#else
+static inline bool cache_output(const struct log_output *output,
+				struct log_msg2 *msg, uint32_t flags)
+{
+	return false;
+}
+
+static inline void cache_append(const struct log_output *output,
+				const char *str, size_t len)
+{
+}
+
+static inline void cache_complete(const struct log_output *output,
+				  struct log_msg2 *msg)
+{
+}
+#endif /* CONFIG_LOG_OUTPUT_FORMAT_CACHE */
+
+static int out_func(const char *str, size_t len, void *ctx)
 {
 	const struct log_output *out_ctx = (const struct log_output *)ctx;
+	size_t chunk;
 	int idx;
 
 	if (IS_ENABLED(CONFIG_LOG_MODE_IMMEDIATE)) {
 		/* Backend must be thread safe in synchronous operation. */
-		/* Need that step for big endian */
-		char x = (char)c;
-
-		out_ctx->func((uint8_t *)&x, 1, out_ctx->control_block->ctx);
+		buffer_write(out_ctx->func, (uint8_t *)str, len,
+			     out_ctx->control_block->ctx);
 		return 0;
 	}
 
-	if (out_ctx->control_block->offset == out_ctx->size) {
-		log_output_flush(out_ctx);
-	}
+	cache_append(out_ctx, str, len);
+
+	while (len > 0) {
+		if (out_ctx->control_block->offset == out_ctx->size) {
+			log_output_flush(out_ctx);
+		}
 
-	idx = atomic_inc(&out_ctx->control_block->offset);
-	out_ctx->buf[idx] = (uint8_t)c;
+		chunk = MIN(len, (size_t)(out_ctx->size -
+					   out_ctx->control_block->offset));
+		idx = atomic_add(&out_ctx->control_block->offset, chunk);
+		memcpy(&out_ctx->buf[idx], str, chunk);
 
-	__ASSERT_NO_MSG(out_ctx->control_block->offset <= out_ctx->size);
+		__ASSERT_NO_MSG(out_ctx->control_block->offset <= out_ctx->size);
+
+		str += chunk;
+		len -= chunk;
+	}
 
 	return 0;
 }
 
-static int cr_out_func(int c, void *ctx)
+static int cr_out_func(const char *str, size_t len, void *ctx)
 {
-	out_func(c, ctx);
-	if (c == '\n') {
-		out_func((int)'\r', ctx);
+	const char *nl;
+
+	while ((nl = memchr(str, '\n', len)) != NULL) {
+		size_t line = nl - str + 1;
+
+		out_func(str, line, ctx);
+		out_func("\r", 1, ctx);
+		str += line;
+		len -= line;
+	}
+
+	if (len > 0) {
+		out_func(str, len, ctx);
 	}
 
 	return 0;
@@ -143,25 +279,12 @@ static int print_formatted(const struct log_output *output,
 	int length = 0;
 
 	va_start(args, fmt);
-	length = cbvprintf(out_func, (void *)output, fmt, args);
+	length = cbvprintf_str(out_func, (void *)output, fmt, args);
 	va_end(args);
 
 	return length;
 }
 
-static void buffer_write(log_output_func_t outf, uint8_t *buf, size_t len,
-			 void *ctx)
-{
-	int processed;
-
-	do {
-		processed = outf(buf, len, ctx);
-		len -= processed;
-		buf += processed;
-	} while (len != 0);
-}
-
-
 void log_output_flush(const struct log_output *output)
 {
 	buffer_write(output->func, output->buf,
@@ -481,6 +604,10 @@ void log_output_msg2_process(const struct log_output *output,
 	bool raw_string = (level == LOG_LEVEL_INTERNAL_RAW_STRING);
 	uint32_t prefix_offset;
 
+	if (cache_output(output, msg, flags)) {
+		return;
+	}
+
 	if (!raw_string) {
 		void *source = (void *)log_msg2_get_source(msg);
 		uint8_t domain_id = log_msg2_get_domain(msg);
@@ -500,8 +627,8 @@ void log_output_msg2_process(const struct log_output *output,
 	uint8_t *data = log_msg2_get_package(msg, &len);
 
 	if (len) {
-		int err = cbpprintf(raw_string ? cr_out_func :  out_func,
-				    (void *)output, data);
+		int err = cbpprintf_str(raw_string ? cr_out_func : out_func,
+					(void *)output, data);
 
 		(void)err;
 		__ASSERT_NO_MSG(err >= 0);
@@ -517,6 +644,7 @@ void log_output_msg2_process(const struct log_output *output,
 	}
 
 	log_output_flush(output);
+	cache_complete(output, msg);
 }
 
 void log_output_dropped_process(const struct log_output *output, uint32_t cnt)
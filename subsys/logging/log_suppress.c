@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <zephyr/logging/log_ctrl.h>
+#include <zephyr/logging/log_internal.h>
+#include <zephyr/logging/log_core.h>
+#include <zephyr/spinlock.h>
+
+/* Rate limiting and deduplication of log messages. Both are evaluated before
+ * message is created so suppressed messages are not packaged and do not take
+ * space in the buffer. Call site is identified by the source and the format
+ * string pointer.
+ */
+
+#ifdef CONFIG_LOG_RATELIMIT
+struct ratelimit_slot {
+	const void *source;
+	const char *fmt;
+	uint32_t start;
+	uint16_t cnt;
+};
+
+struct ratelimit_source {
+	const void *source;
+	uint16_t burst;
+};
+
+static struct ratelimit_slot slots[CONFIG_LOG_RATELIMIT_SLOTS];
+static struct ratelimit_source sources[CONFIG_LOG_RATELIMIT_MODULES];
+static uint32_t ratelimited_cnt;
+#endif
+
+#ifdef CONFIG_LOG_DEDUP
+struct dedup_state {
+	const void *source;
+	const char *fmt;
+	uint32_t start;
+	uint32_t cnt;
+	uint8_t level;
+};
+
+static struct dedup_state last;
+static uint32_t repeated_cnt;
+#endif
+
+static struct k_spinlock lock;
+
+#ifdef CONFIG_LOG_RATELIMIT
+static uint32_t slot_idx(const void *source, const char *fmt)
+{
+	uintptr_t key = (uintptr_t)source ^ ((uintptr_t)fmt * 31U);
+
+	return (uint32_t)(key ^ (key >> 7) ^ (key >> 15)) %
+		CONFIG_LOG_RATELIMIT_SLOTS;
+}
+
+static uint16_t burst_get(const void *source)
+{
+	for (int i = 0; i < ARRAY_SIZE(sources); i++) {
+		if (sources[i].source == source) {
+			return sources[i].burst;
+		}
+	}
+
+	return CONFIG_LOG_RATELIMIT_BURST;
+}
+
+/* Must be called with the lock held. */
+static bool ratelimit(const void *source, const char *fmt, uint32_t now)
+{
+	struct ratelimit_slot *slot = &slots[slot_idx(source, fmt)];
+	uint16_t burst = burst_get(source);
+
+	if (burst == 0) {
+		return false;
+	}
+
+	if (slot->source != source || slot->fmt != fmt ||
+	    (now - slot->start) >= CONFIG_LOG_RATELIMIT_INTERVAL_MS) {
+		slot->source = source;
+		slot->fmt = fmt;
+		slot->start = now;
+		slot->cnt = 0;
+	}
+
+	if (slot->cnt >= burst) {
+		ratelimited_cnt++;
+		return true;
+	}
+
+	slot->cnt++;
+
+	return false;
+}
+#endif /* CONFIG_LOG_RATELIMIT */
+
+#ifdef CONFIG_LOG_DEDUP
+static void repeated_report(struct dedup_state *state)
+{
+	z_log_msg2_runtime_create(CONFIG_LOG_DOMAIN_ID, state->source,
+				  state->level, NULL, 0, 0,
+				  "Last message repeated %u times", state->cnt);
+}
+
+/* Must be called with the lock held. Returns true if message is a repetition.
+ * Otherwise, message becomes the last message and @p report is filled if
+ * repetitions of the previous one shall be reported.
+ */
+static bool dedup(const void *source, uint8_t level, const char *fmt,
+		  uint32_t now, struct dedup_state *report)
+{
+	if (last.source == source && last.fmt == fmt &&
+	    (now - last.start) < CONFIG_LOG_DEDUP_TIMEOUT_MS) {
+		last.cnt++;
+		repeated_cnt++;
+		return true;
+	}
+
+	*report = last;
+	last.source = source;
+	last.fmt = fmt;
+	last.level = level;
+	last.start = now;
+	last.cnt = 0;
+
+	return false;
+}
+#endif /* CONFIG_LOG_DEDUP */
+
+bool z_log_suppress(const void *source, uint8_t level, const char *fmt)
+{
+#ifdef CONFIG_LOG_DEDUP
+	struct dedup_state report = { .cnt = 0 };
+#endif
+	uint32_t now = k_uptime_get_32();
+	bool drop = false;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&lock);
+
+#ifdef CONFIG_LOG_DEDUP
+	drop = dedup(source, level, fmt, now, &report);
+#endif
+#ifdef CONFIG_LOG_RATELIMIT
+	drop = drop || ratelimit(source, fmt, now);
+#endif
+
+	k_spin_unlock(&lock, key);
+
+#ifdef CONFIG_LOG_DEDUP
+	if (report.cnt > 0) {
+		repeated_report(&report);
+	}
+#endif
+
+	return drop;
+}
+
+void z_log_suppress_flush(void)
+{
+#ifdef CONFIG_LOG_DEDUP
+	struct dedup_state report;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&lock);
+	report = last;
+	last.cnt = 0;
+	k_spin_unlock(&lock, key);
+
+	if (report.cnt > 0) {
+		repeated_report(&report);
+	}
+#endif
+}
+
+int log_ratelimit_set(uint32_t domain_id, int16_t source_id, uint16_t burst)
+{
+#ifdef CONFIG_LOG_RATELIMIT
+	struct ratelimit_source *entry = NULL;
+	const void *source;
+	k_spinlock_key_t key;
+	int err = 0;
+
+	if (source_id < 0 || source_id >= (int16_t)log_src_cnt_get(domain_id)) {
+		return -EINVAL;
+	}
+
+	/* Same pointer as the one passed by the logging macros. */
+	source = IS_ENABLED(CONFIG_LOG_RUNTIME_FILTERING) ?
+		(const void *)&__log_dynamic_start[source_id] :
+		(const void *)&__log_const_start[source_id];
+
+	key = k_spin_lock(&lock);
+
+	for (int i = 0; i < ARRAY_SIZE(sources); i++) {
+		if (sources[i].source == source) {
+			entry = &sources[i];
+			break;
+		} else if (entry == NULL && sources[i].source == NULL) {
+			entry = &sources[i];
+		}
+	}
+
+	if (burst == CONFIG_LOG_RATELIMIT_BURST) {
+		/* Default limit, entry not needed. */
+		if (entry != NULL && entry->source == source) {
+			entry->source = NULL;
+		}
+	} else if (entry == NULL) {
+		err = -ENOMEM;
+	} else {
+		entry->source = source;
+		entry->burst = burst;
+	}
+
+	k_spin_unlock(&lock, key);
+
+	return err;
+#else
+	return -ENOTSUP;
+#endif
+}
+
+int log_suppressed_get(uint32_t *ratelimited, uint32_t *repeated)
+{
+	__ASSERT_NO_MSG(ratelimited != NULL);
+	__ASSERT_NO_MSG(repeated != NULL);
+
+	*ratelimited = COND_CODE_1(CONFIG_LOG_RATELIMIT, (ratelimited_cnt), (0));
+	*repeated = COND_CODE_1(CONFIG_LOG_DEDUP, (repeated_cnt), (0));
+
+	return 0;
+}
@@ -1342,6 +1342,30 @@ static inline void uncompress_cid(struct net_pkt *pkt, uint8_t cid,
 }
 #endif
 
+/* Headroom of the first buffer that can be overwritten. The link layer
+ * addresses of a received pkt may still point to the link layer header
+ * there.
+ */
+static size_t uncompress_headroom(struct net_pkt *pkt)
+{
+	uint8_t *start = pkt->buffer->data - net_buf_headroom(pkt->buffer);
+	struct net_linkaddr *lladdr[] = {
+		net_pkt_lladdr_src(pkt),
+		net_pkt_lladdr_dst(pkt),
+	};
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(lladdr); i++) {
+		uint8_t *addr = lladdr[i]->addr;
+
+		if (addr && addr >= start && addr < pkt->buffer->data) {
+			start = MAX(start, addr + lladdr[i]->len);
+		}
+	}
+
+	return pkt->buffer->data - start;
+}
+
 static bool uncompress_IPHC_header(struct net_pkt *pkt)
 {
 	struct net_udp_hdr *udp = NULL;
@@ -1352,7 +1376,7 @@ static bool uncompress_IPHC_header(struct net_pkt *pkt)
 	uint16_t len;
 	uint16_t iphc;
 	int inline_size, compressed_hdr_size;
-	size_t diff;
+	size_t diff, headroom;
 	uint8_t *cursor;
 #if defined(CONFIG_NET_6LO_CONTEXT)
 	struct net_6lo_context *src = NULL;
@@ -1387,12 +1411,31 @@ static bool uncompress_IPHC_header(struct net_pkt *pkt)
 		return false;
 	}
 
-	if (net_buf_tailroom(pkt->buffer) >= diff) {
-		NET_DBG("Enough tailroom. Uncompress inplace");
+	headroom = uncompress_headroom(pkt);
+
+	if (headroom + net_buf_tailroom(pkt->buffer) >= diff) {
+		size_t head = MIN(headroom, diff);
+
+		/* The uncompressed headers are written in place starting
+		 * from the headroom, which typically is where the link
+		 * layer header was. Only the part that does not fit there
+		 * needs the payload to be moved towards the tailroom.
+		 * Each field is written after it has been read and is at
+		 * least as long uncompressed, so the compressed header is
+		 * never overwritten before it is read.
+		 */
+		NET_DBG("Enough head/tailroom (%zu/%zu). Uncompress inplace",
+			head, diff - head);
 		frag = pkt->buffer;
-		net_buf_add(frag, diff);
+
+		if (head < diff) {
+			net_buf_add(frag, diff - head);
+			memmove(frag->data + diff - head, frag->data,
+				frag->len - (diff - head));
+		}
+
+		net_buf_push(frag, head);
 		cursor = frag->data + diff;
-		memmove(cursor, frag->data, frag->len - diff);
 	} else {
 		NET_DBG("Not enough tailroom. Get new fragment");
 		cursor =  pkt->buffer->data;
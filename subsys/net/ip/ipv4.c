@@ -304,6 +304,20 @@ enum net_verdict net_ipv4_input(struct net_pkt *pkt)
 		goto drop;
 	}
 
+	if (sys_get_be16(hdr->offset) &
+	    (NET_IPV4_FRAGH_MF | NET_IPV4_FRAGH_OFFSET_MASK)) {
+		/* The packet is a fragment, it is passed up the stack
+		 * only after it has been reassembled.
+		 */
+		verdict = net_ipv4_handle_fragment_hdr(pkt, hdr);
+		if (verdict == NET_DROP) {
+			NET_DBG("DROP: fragment");
+			goto drop;
+		}
+
+		return verdict;
+	}
+
 	net_pkt_acknowledge_data(pkt, &ipv4_access);
 
 	if (opts_len) {
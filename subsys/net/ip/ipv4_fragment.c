@@ -0,0 +1,749 @@
+/** @file
+ * @brief IPv4 Fragment related functions
+ */
+
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_ipv4, CONFIG_NET_IPV4_LOG_LEVEL);
+
+#include <errno.h>
+#include <zephyr/net/net_core.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/net/net_stats.h>
+#include <zephyr/net/net_context.h>
+#include <zephyr/random/rand32.h>
+#include <zephyr/sys/byteorder.h>
+#include "net_private.h"
+#include "icmpv4.h"
+#include "ipv4.h"
+
+#define IPV4_REASSEMBLY_TIMEOUT K_SECONDS(CONFIG_NET_IPV4_FRAGMENT_TIMEOUT)
+
+#define REASSEMBLY_HASH_SIZE CONFIG_NET_IPV4_FRAGMENT_MAX_COUNT
+
+#define BUF_ALLOC_TIMEOUT K_MSEC(100)
+
+static void reassembly_timeout(struct k_work *work);
+static bool reassembly_init_done;
+
+static struct net_ipv4_reassembly
+reassembly[CONFIG_NET_IPV4_FRAGMENT_MAX_COUNT];
+
+/* Pending reassemblies hashed by source, destination, protocol and id,
+ * and the list of unused reassembly slots.
+ */
+static sys_slist_t reassembly_hash[REASSEMBLY_HASH_SIZE];
+static sys_slist_t reassembly_free;
+
+/* Amount of fragment data held by all the pending reassemblies. */
+static uint32_t reassembly_mem;
+
+/* Serializes the RX path and the reassembly timeout handler. */
+static K_MUTEX_DEFINE(reassembly_lock);
+
+static void reassembly_init(void)
+{
+	int i;
+
+	/* Static initializing does not work here because of the array
+	 * so we must do it at runtime.
+	 */
+	for (i = 0; i < CONFIG_NET_IPV4_FRAGMENT_MAX_COUNT; i++) {
+		k_work_init_delayable(&reassembly[i].timer,
+				      reassembly_timeout);
+		sys_slist_append(&reassembly_free, &reassembly[i].node);
+	}
+
+	reassembly_init_done = true;
+}
+
+static inline bool reassembly_is_used(struct net_ipv4_reassembly *reass)
+{
+	/* The fragments are kept sorted, so a slot in use always holds
+	 * a fragment in its first position.
+	 */
+	return reass->pkt[0] != NULL;
+}
+
+static uint32_t reassembly_bucket(uint16_t id, uint8_t protocol,
+				  const uint8_t *src, const uint8_t *dst)
+{
+	uint32_t hash;
+
+	hash = sys_get_be32(src) ^ sys_get_be32(dst) ^
+	       ((uint32_t)protocol << 16 | id);
+	hash ^= hash >> 16;
+	hash ^= hash >> 8;
+
+	return hash % REASSEMBLY_HASH_SIZE;
+}
+
+static struct net_ipv4_reassembly *reassembly_find(struct net_ipv4_hdr *hdr,
+						   uint16_t id,
+						   uint32_t bucket)
+{
+	struct net_ipv4_reassembly *reass;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&reassembly_hash[bucket], reass, node) {
+		if (reass->id == id &&
+		    reass->protocol == hdr->proto &&
+		    net_ipv4_addr_cmp_raw((uint8_t *)&reass->src, hdr->src) &&
+		    net_ipv4_addr_cmp_raw((uint8_t *)&reass->dst, hdr->dst)) {
+			return reass;
+		}
+	}
+
+	return NULL;
+}
+
+static void reassembly_info(char *str, struct net_ipv4_reassembly *reass)
+{
+	NET_DBG("%s id 0x%x src %s dst %s remain %d ms", str, reass->id,
+		log_strdup(net_sprint_ipv4_addr(&reass->src)),
+		log_strdup(net_sprint_ipv4_addr(&reass->dst)),
+		k_ticks_to_ms_ceil32(
+			k_work_delayable_remaining_get(&reass->timer)));
+}
+
+static void reassembly_release(struct net_ipv4_reassembly *reass)
+{
+	uint32_t bucket;
+	int i;
+
+	k_work_cancel_delayable(&reass->timer);
+
+	for (i = 0; i < CONFIG_NET_IPV4_FRAGMENT_MAX_PKT; i++) {
+		if (!reass->pkt[i]) {
+			continue;
+		}
+
+		NET_DBG("[%d] IPv4 reassembly pkt %p %zd bytes data",
+			i, reass->pkt[i], net_pkt_get_len(reass->pkt[i]));
+
+		net_pkt_unref(reass->pkt[i]);
+		reass->pkt[i] = NULL;
+	}
+
+	reassembly_mem -= reass->len;
+	reass->len = 0U;
+
+	bucket = reassembly_bucket(reass->id, reass->protocol,
+				   (uint8_t *)&reass->src,
+				   (uint8_t *)&reass->dst);
+
+	sys_slist_find_and_remove(&reassembly_hash[bucket], &reass->node);
+	sys_slist_append(&reassembly_free, &reass->node);
+}
+
+/* Find the pending reassembly that will time out first, i.e. the one that
+ * was started first.
+ */
+static struct net_ipv4_reassembly *reassembly_oldest(
+					struct net_ipv4_reassembly *skip)
+{
+	struct net_ipv4_reassembly *oldest = NULL;
+	k_ticks_t oldest_remaining = 0;
+	int i;
+
+	for (i = 0; i < CONFIG_NET_IPV4_FRAGMENT_MAX_COUNT; i++) {
+		k_ticks_t remaining;
+
+		if (&reassembly[i] == skip || !reassembly_is_used(&reassembly[i])) {
+			continue;
+		}
+
+		remaining = k_work_delayable_remaining_get(&reassembly[i].timer);
+		if (!oldest || remaining < oldest_remaining) {
+			oldest = &reassembly[i];
+			oldest_remaining = remaining;
+		}
+	}
+
+	return oldest;
+}
+
+static struct net_ipv4_reassembly *reassembly_get(struct net_ipv4_hdr *hdr,
+						  uint16_t id)
+{
+	struct net_ipv4_reassembly *reass;
+	uint32_t bucket;
+	sys_snode_t *node;
+
+	bucket = reassembly_bucket(id, hdr->proto, hdr->src, hdr->dst);
+
+	reass = reassembly_find(hdr, id, bucket);
+	if (reass) {
+		return reass;
+	}
+
+	node = sys_slist_get(&reassembly_free);
+	if (!node) {
+		/* All slots are in use, make room for the new packet by
+		 * discarding the one that has been waiting the longest.
+		 */
+		reass = reassembly_oldest(NULL);
+		if (!reass) {
+			return NULL;
+		}
+
+		reassembly_info("Reassembly evicted", reass);
+		reassembly_release(reass);
+
+		node = sys_slist_get(&reassembly_free);
+	}
+
+	reass = CONTAINER_OF(node, struct net_ipv4_reassembly, node);
+
+	net_ipv4_addr_copy_raw((uint8_t *)&reass->src, hdr->src);
+	net_ipv4_addr_copy_raw((uint8_t *)&reass->dst, hdr->dst);
+	reass->protocol = hdr->proto;
+	reass->id = id;
+	reass->len = 0U;
+
+	sys_slist_prepend(&reassembly_hash[bucket], &reass->node);
+
+	k_work_reschedule(&reass->timer, IPV4_REASSEMBLY_TIMEOUT);
+
+	return reass;
+}
+
+/* Keep the fragment data held by all the reassemblies within the memory
+ * budget, discarding the oldest reassemblies if needed.
+ */
+static bool reassembly_reserve(struct net_ipv4_reassembly *reass, size_t len)
+{
+	struct net_ipv4_reassembly *oldest;
+
+	if (CONFIG_NET_IPV4_FRAGMENT_MAX_MEM == 0) {
+		return true;
+	}
+
+	while (reassembly_mem + len > CONFIG_NET_IPV4_FRAGMENT_MAX_MEM) {
+		oldest = reassembly_oldest(reass);
+		if (!oldest) {
+			return false;
+		}
+
+		reassembly_info("Reassembly over memory limit", oldest);
+		reassembly_release(oldest);
+	}
+
+	return true;
+}
+
+static void reassembly_timeout(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct net_ipv4_reassembly *reass =
+		CONTAINER_OF(dwork, struct net_ipv4_reassembly, timer);
+
+	k_mutex_lock(&reassembly_lock, K_FOREVER);
+
+	/* The slot might have been released or reused while we were
+	 * waiting for the lock.
+	 */
+	if (!reassembly_is_used(reass) ||
+	    (k_work_delayable_busy_get(&reass->timer) &
+	     (K_WORK_DELAYED | K_WORK_QUEUED))) {
+		goto out;
+	}
+
+	reassembly_info("Reassembly cancelled", reass);
+
+	/* Send a ICMPv4 Time Exceeded only if we received the first
+	 * fragment (RFC 792)
+	 */
+	if (net_pkt_ipv4_fragment_offset(reass->pkt[0]) == 0) {
+		net_icmpv4_send_error(reass->pkt[0], NET_ICMPV4_TIME_EXCEEDED, 1);
+	}
+
+	reassembly_release(reass);
+
+out:
+	k_mutex_unlock(&reassembly_lock);
+}
+
+static inline size_t fragment_hdr_len(struct net_pkt *pkt)
+{
+	return net_pkt_ip_hdr_len(pkt) + net_pkt_ipv4_opts_len(pkt);
+}
+
+static inline size_t fragment_payload_len(struct net_pkt *pkt)
+{
+	return net_pkt_get_len(pkt) - fragment_hdr_len(pkt);
+}
+
+static void reassemble_packet(struct net_ipv4_reassembly *reass)
+{
+	NET_PKT_DATA_ACCESS_CONTIGUOUS_DEFINE(ipv4_access, struct net_ipv4_hdr);
+	struct net_ipv4_hdr *hdr;
+	struct net_pkt *pkt;
+	struct net_buf *last;
+	int i;
+
+	pkt = reass->pkt[0];
+	last = net_buf_frag_last(pkt->buffer);
+
+	/* We start from 2nd packet which is then appended to
+	 * the first one.
+	 */
+	for (i = 1; i < CONFIG_NET_IPV4_FRAGMENT_MAX_PKT; i++) {
+		struct net_pkt *frag = reass->pkt[i];
+
+		if (!frag) {
+			break;
+		}
+
+		net_pkt_cursor_init(frag);
+
+		/* Get rid of the IPv4 header which is at the beginning
+		 * of the fragment.
+		 */
+		if (net_pkt_pull(frag, fragment_hdr_len(frag))) {
+			NET_ERR("Failed to pull headers");
+			reassembly_release(reass);
+			return;
+		}
+
+		/* Attach the data to previous pkt */
+		last->frags = frag->buffer;
+		last = net_buf_frag_last(frag->buffer);
+
+		frag->buffer = NULL;
+		net_pkt_unref(frag);
+		reass->pkt[i] = NULL;
+	}
+
+	/* The first packet is now owned by us, the slot can be reused. */
+	reass->pkt[0] = NULL;
+	reassembly_release(reass);
+
+	net_pkt_cursor_init(pkt);
+	net_pkt_set_overwrite(pkt, true);
+
+	hdr = (struct net_ipv4_hdr *)net_pkt_get_data(pkt, &ipv4_access);
+	if (!hdr) {
+		goto error;
+	}
+
+	hdr->len = htons(net_pkt_get_len(pkt));
+	hdr->offset[0] = 0U;
+	hdr->offset[1] = 0U;
+	hdr->chksum = 0U;
+
+	if (net_pkt_set_data(pkt, &ipv4_access)) {
+		goto error;
+	}
+
+	hdr->chksum = net_calc_chksum_ipv4(pkt);
+
+	net_pkt_set_ipv4_fragment_flags(pkt, 0U);
+	net_pkt_set_ipv4_reassembled(pkt, true);
+
+	NET_DBG("New pkt %p IPv4 len is %zd bytes", pkt, net_pkt_get_len(pkt));
+
+	/* We need to use the queue when feeding the packet back into the
+	 * IP stack as we might run out of stack if we call processing_data()
+	 * directly. As the packet does not contain link layer header, we
+	 * MUST NOT pass it to L2 so there will be a special check for that
+	 * in process_data() when handling the packet.
+	 */
+	if (net_recv_data(net_pkt_iface(pkt), pkt) >= 0) {
+		return;
+	}
+error:
+	net_pkt_unref(pkt);
+}
+
+void net_ipv4_frag_foreach(net_ipv4_frag_cb_t cb, void *user_data)
+{
+	int i;
+
+	k_mutex_lock(&reassembly_lock, K_FOREVER);
+
+	for (i = 0; reassembly_init_done &&
+		     i < CONFIG_NET_IPV4_FRAGMENT_MAX_COUNT; i++) {
+		if (!reassembly_is_used(&reassembly[i])) {
+			continue;
+		}
+
+		cb(&reassembly[i], user_data);
+	}
+
+	k_mutex_unlock(&reassembly_lock);
+}
+
+/* Verify that we have all the fragments received.
+ * Return:
+ * - a negative value if the fragments are erroneous and must be dropped
+ * - zero if we are expecting more fragments
+ * - a positive value if we can proceed with the reassembly
+ */
+static int fragments_are_ready(struct net_ipv4_reassembly *reass)
+{
+	unsigned int expected_offset = 0;
+	int i;
+
+	/* The fragments are kept sorted by offset and do not overlap, so
+	 * we only need to check that there are no holes between them and
+	 * that the last one has the More Fragments flag unset.
+	 */
+	for (i = 0; i < CONFIG_NET_IPV4_FRAGMENT_MAX_PKT; i++) {
+		struct net_pkt *pkt = reass->pkt[i];
+
+		if (!pkt) {
+			break;
+		}
+
+		if (net_pkt_ipv4_fragment_offset(pkt) != expected_offset) {
+			/* Not contiguous, let's wait for fragments */
+			return 0;
+		}
+
+		expected_offset += fragment_payload_len(pkt);
+
+		if (!net_pkt_ipv4_fragment_more(pkt)) {
+			/* Nothing can follow the last fragment */
+			if (i + 1 < CONFIG_NET_IPV4_FRAGMENT_MAX_PKT &&
+			    reass->pkt[i + 1]) {
+				return -EBADMSG;
+			}
+
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+/* Find the position of the fragment in the reassembly chain.
+ * Return:
+ * - the position where to store the fragment
+ * - -EALREADY if the fragment is a duplicate of an already stored one
+ * - -EBADMSG if the fragment overlaps with the stored ones
+ * - -ENOMEM if there is no room left for the fragment
+ */
+static int fragment_position(struct net_ipv4_reassembly *reass,
+			     struct net_pkt *pkt)
+{
+	uint16_t offset = net_pkt_ipv4_fragment_offset(pkt);
+	size_t len = fragment_payload_len(pkt);
+	struct net_pkt *prev = NULL;
+	int i;
+
+	for (i = 0; i < CONFIG_NET_IPV4_FRAGMENT_MAX_PKT; i++) {
+		if (!reass->pkt[i] ||
+		    net_pkt_ipv4_fragment_offset(reass->pkt[i]) >= offset) {
+			break;
+		}
+
+		prev = reass->pkt[i];
+	}
+
+	if (i < CONFIG_NET_IPV4_FRAGMENT_MAX_PKT && reass->pkt[i]) {
+		struct net_pkt *next = reass->pkt[i];
+
+		if (net_pkt_ipv4_fragment_offset(next) == offset &&
+		    fragment_payload_len(next) == len) {
+			return -EALREADY;
+		}
+
+		if (offset + len > net_pkt_ipv4_fragment_offset(next)) {
+			return -EBADMSG;
+		}
+	}
+
+	if (prev && net_pkt_ipv4_fragment_offset(prev) +
+		    fragment_payload_len(prev) > offset) {
+		return -EBADMSG;
+	}
+
+	if (reass->pkt[CONFIG_NET_IPV4_FRAGMENT_MAX_PKT - 1]) {
+		return -ENOMEM;
+	}
+
+	return i;
+}
+
+enum net_verdict net_ipv4_handle_fragment_hdr(struct net_pkt *pkt,
+					      struct net_ipv4_hdr *hdr)
+{
+	struct net_ipv4_reassembly *reass;
+	enum net_verdict verdict = NET_DROP;
+	uint16_t flags;
+	uint16_t id;
+	size_t len;
+	int ret;
+	int i;
+
+	flags = sys_get_be16(hdr->offset);
+	id = sys_get_be16(hdr->id);
+
+	net_pkt_set_ipv4_fragment_flags(pkt, flags);
+
+	len = fragment_payload_len(pkt);
+
+	if (net_pkt_ipv4_fragment_more(pkt) && (len == 0U || len % 8)) {
+		/* Fragment length is not multiple of 8 */
+		NET_DBG("DROP: invalid fragment length %zd", len);
+		return NET_DROP;
+	}
+
+	if (fragment_hdr_len(pkt) + net_pkt_ipv4_fragment_offset(pkt) + len >
+	    UINT16_MAX) {
+		NET_DBG("DROP: reassembled packet too large");
+		return NET_DROP;
+	}
+
+	k_mutex_lock(&reassembly_lock, K_FOREVER);
+
+	if (!reassembly_init_done) {
+		reassembly_init();
+	}
+
+	reass = reassembly_get(hdr, id);
+	if (!reass) {
+		NET_DBG("Cannot get reassembly slot, dropping pkt %p", pkt);
+		goto out;
+	}
+
+	/* The fragments might come in wrong order so place them
+	 * in reassembly chain in correct order.
+	 */
+	i = fragment_position(reass, pkt);
+	if (i == -EALREADY) {
+		NET_DBG("Duplicate fragment offset %d for 0x%x",
+			net_pkt_ipv4_fragment_offset(pkt), reass->id);
+		goto out;
+	} else if (i < 0) {
+		NET_DBG("Cannot store fragment (%d), dropping id 0x%x",
+			i, reass->id);
+		goto cancel;
+	}
+
+	if (!reassembly_reserve(reass, net_pkt_get_len(pkt))) {
+		NET_DBG("No memory for id 0x%x", reass->id);
+		goto cancel;
+	}
+
+	NET_DBG("Storing pkt %p to slot %d offset %d",
+		pkt, i, net_pkt_ipv4_fragment_offset(pkt));
+
+	memmove(&reass->pkt[i + 1], &reass->pkt[i],
+		sizeof(void *) * (CONFIG_NET_IPV4_FRAGMENT_MAX_PKT - i - 1));
+	reass->pkt[i] = pkt;
+
+	reass->len += net_pkt_get_len(pkt);
+	reassembly_mem += net_pkt_get_len(pkt);
+
+	/* From now on the packet belongs to the reassembly. */
+	verdict = NET_OK;
+
+	ret = fragments_are_ready(reass);
+	if (ret < 0) {
+		NET_DBG("Reassembled IPv4 verify failed, dropping id 0x%x",
+			reass->id);
+		goto cancel;
+	} else if (ret == 0) {
+		reassembly_info("Reassembly nth pkt", reass);
+		goto out;
+	}
+
+	reassembly_info("Reassembly last pkt", reass);
+
+	/* The last fragment received, reassemble the packet */
+	reassemble_packet(reass);
+	goto out;
+
+cancel:
+	/* Discard the whole packet, including this fragment if it
+	 * was already stored.
+	 */
+	reassembly_release(reass);
+
+out:
+	k_mutex_unlock(&reassembly_lock);
+
+	return verdict;
+}
+
+static int send_ipv4_fragment(struct net_pkt *pkt, uint16_t hdr_len,
+			      uint16_t fit_len, uint16_t frag_offset,
+			      uint16_t id, bool final)
+{
+	NET_PKT_DATA_ACCESS_CONTIGUOUS_DEFINE(ipv4_access, struct net_ipv4_hdr);
+	struct net_ipv4_hdr *ipv4_hdr;
+	struct net_pkt *frag_pkt;
+	uint16_t flags;
+	int ret = -ENOBUFS;
+
+	frag_pkt = net_pkt_alloc_with_buffer(net_pkt_iface(pkt),
+					     hdr_len + fit_len,
+					     AF_INET, 0, BUF_ALLOC_TIMEOUT);
+	if (!frag_pkt) {
+		return -ENOMEM;
+	}
+
+	net_pkt_cursor_init(pkt);
+
+	/* Copy the original IPv4 header and options, and then the payload
+	 * part of this fragment from the original packet.
+	 */
+	if (net_pkt_copy(frag_pkt, pkt, hdr_len) ||
+	    net_pkt_skip(pkt, frag_offset) ||
+	    net_pkt_copy(frag_pkt, pkt, fit_len)) {
+		goto fail;
+	}
+
+	net_pkt_set_ip_hdr_len(frag_pkt, net_pkt_ip_hdr_len(pkt));
+	net_pkt_set_ipv4_opts_len(frag_pkt, net_pkt_ipv4_opts_len(pkt));
+	net_pkt_set_ipv4_ttl(frag_pkt, net_pkt_ipv4_ttl(pkt));
+	net_pkt_set_priority(frag_pkt, net_pkt_priority(pkt));
+
+	net_pkt_cursor_init(frag_pkt);
+	net_pkt_set_overwrite(frag_pkt, true);
+
+	ipv4_hdr = (struct net_ipv4_hdr *)net_pkt_get_data(frag_pkt,
+							   &ipv4_access);
+	if (!ipv4_hdr) {
+		goto fail;
+	}
+
+	flags = frag_offset / 8U;
+	if (!final) {
+		flags |= NET_IPV4_FRAGH_MF;
+	}
+
+	ipv4_hdr->len = htons(hdr_len + fit_len);
+	sys_put_be16(id, ipv4_hdr->id);
+	sys_put_be16(flags, ipv4_hdr->offset);
+	ipv4_hdr->chksum = 0U;
+
+	if (net_pkt_set_data(frag_pkt, &ipv4_access)) {
+		goto fail;
+	}
+
+	if (net_if_need_calc_tx_checksum(net_pkt_iface(frag_pkt))) {
+		ipv4_hdr->chksum = net_calc_chksum_ipv4(frag_pkt);
+	}
+
+	net_pkt_set_ipv4_fragment_flags(frag_pkt, flags);
+
+	ret = net_send_data(frag_pkt);
+	if (ret < 0) {
+		goto fail;
+	}
+
+	return 0;
+
+fail:
+	NET_DBG("Cannot send fragment (%d)", ret);
+	net_pkt_unref(frag_pkt);
+
+	return ret;
+}
+
+static int send_fragmented_pkt(struct net_pkt *pkt, uint16_t mtu)
+{
+	uint16_t hdr_len = fragment_hdr_len(pkt);
+	uint16_t frag_offset;
+	size_t length;
+	uint16_t id;
+	int fit_len;
+	int ret;
+
+	/* The Maximum payload can fit into each fragment after IPv4 header
+	 * and options, rounded down to the 8 byte fragment offset unit.
+	 */
+	fit_len = ((int)mtu - hdr_len) & ~7;
+	if (fit_len <= 0) {
+		NET_DBG("No room for IPv4 payload MTU %d hdr_len %d",
+			mtu, hdr_len);
+		return -EINVAL;
+	}
+
+	id = sys_rand32_get();
+	frag_offset = 0U;
+
+	length = net_pkt_get_len(pkt) - hdr_len;
+	while (length) {
+		bool final = false;
+
+		if (fit_len >= length) {
+			final = true;
+			fit_len = length;
+		}
+
+		ret = send_ipv4_fragment(pkt, hdr_len, fit_len, frag_offset,
+					 id, final);
+		if (ret < 0) {
+			return ret;
+		}
+
+		length -= fit_len;
+		frag_offset += fit_len;
+	}
+
+	return 0;
+}
+
+enum net_verdict net_ipv4_prepare_for_send(struct net_pkt *pkt)
+{
+	NET_PKT_DATA_ACCESS_CONTIGUOUS_DEFINE(ipv4_access, struct net_ipv4_hdr);
+	struct net_ipv4_hdr *ip_hdr;
+	uint16_t mtu;
+	int ret;
+
+	NET_ASSERT(pkt && pkt->buffer);
+
+	mtu = net_if_get_mtu(net_pkt_iface(pkt));
+	if (mtu == 0U || net_pkt_get_len(pkt) <= mtu) {
+		return NET_OK;
+	}
+
+	net_pkt_cursor_init(pkt);
+	net_pkt_set_overwrite(pkt, true);
+
+	ip_hdr = (struct net_ipv4_hdr *)net_pkt_get_data(pkt, &ipv4_access);
+	if (!ip_hdr) {
+		return NET_DROP;
+	}
+
+	if (sys_get_be16(ip_hdr->offset) & (NET_IPV4_DF << 13)) {
+		NET_DBG("DROP: pkt %p len %zd over MTU %d and DF set", pkt,
+			net_pkt_get_len(pkt), mtu);
+		return NET_DROP;
+	}
+
+	ret = send_fragmented_pkt(pkt, mtu);
+	if (ret < 0) {
+		NET_DBG("Cannot fragment IPv4 pkt (%d)", ret);
+		return NET_DROP;
+	}
+
+	/* We "fake" the sending of the packet here so that
+	 * tcp.c:tcp_retry_expired() will increase the ref
+	 * count when re-sending the packet. This is crucial
+	 * thing to do here and will cause free memory access
+	 * if not done.
+	 */
+	if (IS_ENABLED(CONFIG_NET_TCP)) {
+		net_pkt_set_sent(pkt, true);
+	}
+
+	/* We need to unref here because we simulate the packet
+	 * sending.
+	 */
+	net_pkt_unref(pkt);
+
+	/* No need to continue with the sending as the packet
+	 * is now split and its fragments will be sent
+	 * separately to network.
+	 */
+	return NET_CONTINUE;
+}
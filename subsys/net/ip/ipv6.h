@@ -86,6 +86,9 @@ struct net_ipv6_nbr_data {
 	/** IPv6 address. */
 	struct in6_addr addr;
 
+	/** Next neighbor in the same neighbor cache hash bucket. */
+	struct net_nbr *hash_next;
+
 	/** Reachable timer. */
 	int64_t reachable;
 
@@ -271,6 +274,20 @@ static inline struct net_nbr *net_ipv6_nbr_lookup(struct net_if *iface,
 }
 #endif
 
+/**
+ * @brief Get the neighbor cache lookup statistics.
+ *
+ * @return Statistics of the lookups done with net_ipv6_nbr_lookup().
+ */
+#if defined(CONFIG_NET_IPV6_NBR_CACHE) && defined(CONFIG_NET_NATIVE_IPV6)
+const struct net_nbr_lookup_stats *net_ipv6_nbr_lookup_stats(void);
+#else
+static inline const struct net_nbr_lookup_stats *net_ipv6_nbr_lookup_stats(void)
+{
+	return NULL;
+}
+#endif
+
 /**
  * @brief Get neighbor from its index.
  *
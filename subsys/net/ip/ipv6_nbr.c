@@ -97,6 +97,16 @@ NET_NBR_TABLE_INIT(NET_NBR_GLOBAL,
 		   net_neighbor_pool,
 		   net_neighbor_table_clear);
 
+/* The neighbors in use are also in a hash table keyed by the address, so
+ * that the lookup done for every sent packet does not depend on the number
+ * of neighbors. The chains are only changed by adding to the head or by
+ * unlinking an entry, and the entries are never freed, so a lookup running
+ * at the same time sees either the old or the new chain.
+ */
+static struct net_nbr *nbr_hash[CONFIG_NET_IPV6_MAX_NEIGHBORS];
+
+static struct net_nbr_lookup_stats nbr_lookup_stats;
+
 const char *net_ipv6_nbr_state2str(enum net_ipv6_nbr_state state)
 {
 	switch (state) {
@@ -255,14 +265,55 @@ void nbr_print(void)
 #define nbr_print(...)
 #endif
 
+static inline struct net_nbr **nbr_hash_bucket(const struct in6_addr *addr)
+{
+	uint32_t hash;
+
+	/* The interface identifier differs even for link local addresses */
+	hash = UNALIGNED_GET(&addr->s6_addr32[2]) ^
+		UNALIGNED_GET(&addr->s6_addr32[3]);
+	hash ^= hash >> 16;
+	hash ^= hash >> 8;
+
+	return &nbr_hash[hash % CONFIG_NET_IPV6_MAX_NEIGHBORS];
+}
+
+static void nbr_hash_add(struct net_nbr *nbr)
+{
+	struct net_nbr **bucket =
+		nbr_hash_bucket(&net_ipv6_nbr_data(nbr)->addr);
+
+	net_ipv6_nbr_data(nbr)->hash_next = *bucket;
+
+	/* Make the entry complete before it can be seen by a lookup */
+	compiler_barrier();
+
+	*bucket = nbr;
+}
+
+static void nbr_hash_remove(struct net_nbr *nbr)
+{
+	struct net_nbr **prev;
+
+	for (prev = nbr_hash_bucket(&net_ipv6_nbr_data(nbr)->addr); *prev;
+	     prev = &net_ipv6_nbr_data(*prev)->hash_next) {
+		if (*prev == nbr) {
+			*prev = net_ipv6_nbr_data(nbr)->hash_next;
+			break;
+		}
+	}
+}
+
 static struct net_nbr *nbr_lookup(struct net_nbr_table *table,
 				  struct net_if *iface,
 				  const struct in6_addr *addr)
 {
-	int i;
+	struct net_nbr *nbr;
+	uint32_t depth = 0U;
 
-	for (i = 0; i < CONFIG_NET_IPV6_MAX_NEIGHBORS; i++) {
-		struct net_nbr *nbr = get_nbr(i);
+	for (nbr = *nbr_hash_bucket(addr); nbr;
+	     nbr = net_ipv6_nbr_data(nbr)->hash_next) {
+		depth++;
 
 		if (!nbr->ref) {
 			continue;
@@ -273,10 +324,14 @@ static struct net_nbr *nbr_lookup(struct net_nbr_table *table,
 		}
 
 		if (net_ipv6_addr_cmp(&net_ipv6_nbr_data(nbr)->addr, addr)) {
+			net_nbr_lookup_stats_update(&nbr_lookup_stats, depth,
+						    true);
 			return nbr;
 		}
 	}
 
+	net_nbr_lookup_stats_update(&nbr_lookup_stats, depth, false);
+
 	return NULL;
 }
 
@@ -430,6 +485,7 @@ static struct net_nbr *nbr_new(struct net_if *iface,
 	}
 
 	nbr_init(nbr, iface, addr, is_router, state);
+	nbr_hash_add(nbr);
 
 	NET_DBG("nbr %p iface %p/%d state %d IPv6 %s",
 		nbr, iface, net_if_get_by_iface(iface), state,
@@ -653,7 +709,7 @@ void net_neighbor_data_remove(struct net_nbr *nbr)
 {
 	NET_DBG("Neighbor %p removed", nbr);
 
-	return;
+	nbr_hash_remove(nbr);
 }
 
 void net_neighbor_table_clear(struct net_nbr_table *table)
@@ -964,6 +1020,11 @@ try_send:
 #endif /* CONFIG_NET_IPV6_ND */
 }
 
+const struct net_nbr_lookup_stats *net_ipv6_nbr_lookup_stats(void)
+{
+	return &nbr_lookup_stats;
+}
+
 struct net_nbr *net_ipv6_nbr_lookup(struct net_if *iface,
 				    struct in6_addr *addr)
 {
@@ -115,6 +115,41 @@ struct net_nbr_table {
 		}							\
 	}
 
+/** Neighbor cache lookup statistics. */
+struct net_nbr_lookup_stats {
+	/** Number of lookups done */
+	uint32_t lookups;
+
+	/** Number of lookups that did not find the neighbor */
+	uint32_t misses;
+
+	/** Number of entries compared in all the lookups */
+	uint32_t depth;
+
+	/** Largest number of entries compared in a lookup */
+	uint32_t max_depth;
+};
+
+static inline void net_nbr_lookup_stats_update(
+				struct net_nbr_lookup_stats *stats,
+				uint32_t depth, bool found)
+{
+	if (!IS_ENABLED(CONFIG_NET_STATISTICS)) {
+		return;
+	}
+
+	stats->lookups++;
+	stats->depth += depth;
+
+	if (!found) {
+		stats->misses++;
+	}
+
+	if (depth > stats->max_depth) {
+		stats->max_depth = depth;
+	}
+}
+
 /**
  *  @brief Get a pointer to the extra data of a neighbor entry.
  *
@@ -144,6 +144,9 @@ int net_context_get(sa_family_t family,
 		    struct net_context **context)
 {
 	int i, ret = -ENOENT;
+#if defined(CONFIG_NET_PKT_BUDGET)
+	uint16_t budget_used;
+#endif
 
 	if (IS_ENABLED(CONFIG_NET_CONTEXT_CHECK)) {
 		if (!IS_ENABLED(CONFIG_NET_IPV4) && family == AF_INET) {
@@ -255,7 +258,20 @@ int net_context_get(sa_family_t family,
 			continue;
 		}
 
+#if defined(CONFIG_NET_PKT_BUDGET)
+		/* Packets sent earlier via this context may still be
+		 * holding buffers, keep counting them.
+		 */
+		budget_used = contexts[i].tx_budget.used;
+#endif
+
 		memset(&contexts[i], 0, sizeof(contexts[i]));
+
+#if defined(CONFIG_NET_PKT_BUDGET)
+		contexts[i].tx_budget.used = budget_used;
+		contexts[i].tx_budget.limit =
+			CONFIG_NET_PKT_BUDGET_CONTEXT_LIMIT;
+#endif
 	/* FIXME - Figure out a way to get the correct network interface
 	 * as it is not known at this point yet.
 	 */
@@ -379,6 +395,11 @@ int net_context_unref(struct net_context *context)
 
 	net_context_set_state(context, NET_CONTEXT_UNCONNECTED);
 
+#if defined(CONFIG_NET_PKT_BUDGET)
+	/* Give the reservation back to the shared buffers */
+	(void)net_pkt_budget_set(&context->tx_budget, true, 0, 0);
+#endif
+
 	context->flags &= ~NET_CONTEXT_IN_USE;
 
 	NET_DBG("Context %p released", context);
@@ -423,6 +444,12 @@ unlock:
 	return ret;
 }
 
+#if defined(CONFIG_NET_UDP_FAST_PATH)
+#define udp_cache_clear(context) ((context)->udp_cache.hdr_len = 0U)
+#else
+#define udp_cache_clear(...)
+#endif
+
 /* If local address is not bound, bind it to INADDR_ANY and random port. */
 static int bind_default(struct net_context *context)
 {
@@ -527,6 +554,8 @@ int net_context_bind(struct net_context *context, const struct sockaddr *addr,
 		return -EISCONN;
 	}
 
+	udp_cache_clear(context);
+
 	if (IS_ENABLED(CONFIG_NET_IPV6) && addr->sa_family == AF_INET6) {
 		struct net_if *iface = NULL;
 		struct in6_addr *ptr;
@@ -950,6 +979,8 @@ int net_context_connect(struct net_context *context,
 
 	k_mutex_lock(&context->lock, K_FOREVER);
 
+	udp_cache_clear(context);
+
 	if (!net_context_is_used(context)) {
 		ret = -EBADF;
 		goto unlock;
@@ -1380,35 +1411,48 @@ static void context_finalize_packet(struct net_context *context,
 static struct net_pkt *context_alloc_pkt(struct net_context *context,
 					 size_t len, k_timeout_t timeout)
 {
+	struct net_if *iface = net_context_get_iface(context);
+	uint64_t end = sys_clock_timeout_end_calc(timeout);
 	struct net_pkt *pkt;
 
 #if defined(CONFIG_NET_CONTEXT_NET_PKT_POOL)
 	if (context->tx_slab) {
 		pkt = net_pkt_alloc_from_slab(context->tx_slab(), timeout);
-		if (!pkt) {
-			return NULL;
+		if (pkt) {
+			net_pkt_set_iface(pkt, iface);
 		}
+	} else {
+		pkt = net_pkt_alloc_on_iface(iface, timeout);
+	}
+#else
+	pkt = net_pkt_alloc_on_iface(iface, timeout);
+#endif
+	if (!pkt) {
+		return NULL;
+	}
 
-		net_pkt_set_iface(pkt, net_context_get_iface(context));
-		net_pkt_set_family(pkt, net_context_get_family(context));
-		net_pkt_set_context(pkt, context);
+	/* The context is needed when the buffer is allocated, so that the
+	 * right data pool and budget are used.
+	 */
+	net_pkt_set_family(pkt, net_context_get_family(context));
+	net_pkt_set_context(pkt, context);
 
-		if (net_pkt_alloc_buffer(pkt, len,
-					 net_context_get_ip_proto(context),
-					 timeout)) {
-			net_pkt_unref(pkt);
-			return NULL;
-		}
+	/* The buffer gets only what is left of the timeout */
+	if (!K_TIMEOUT_EQ(timeout, K_NO_WAIT) &&
+	    !K_TIMEOUT_EQ(timeout, K_FOREVER)) {
+		int64_t remaining = end - sys_clock_tick_get();
 
-		return pkt;
+		if (remaining <= 0) {
+			timeout = K_NO_WAIT;
+		} else {
+			timeout = Z_TIMEOUT_TICKS(remaining);
+		}
 	}
-#endif
-	pkt = net_pkt_alloc_with_buffer(net_context_get_iface(context), len,
-					net_context_get_family(context),
-					net_context_get_ip_proto(context),
-					timeout);
-	if (pkt) {
-		net_pkt_set_context(pkt, context);
+
+	if (net_pkt_alloc_buffer(pkt, len, net_context_get_ip_proto(context),
+				 timeout)) {
+		net_pkt_unref(pkt);
+		return NULL;
 	}
 
 	return pkt;
@@ -1431,6 +1475,234 @@ static void set_pkt_txtime(struct net_pkt *pkt, const struct msghdr *msghdr)
 	}
 }
 
+#if defined(CONFIG_NET_UDP_FAST_PATH)
+static inline uint16_t chksum_add(uint16_t sum, uint16_t val)
+{
+	sum += val;
+
+	return sum < val ? sum + 1U : sum;
+}
+
+/* Same final step as in net_calc_chksum() */
+static inline uint16_t chksum_fold(uint16_t sum)
+{
+	sum = (sum == 0U) ? 0xffff : htons(sum);
+
+	return ~sum;
+}
+
+/* Keep the headers of a packet sent to the connected peer, without the
+ * lengths, the TTL and the checksums. The partial checksums cover
+ * everything else in the headers and in the pseudo header.
+ */
+static void udp_cache_update(struct net_context *context, struct net_pkt *pkt)
+{
+	struct net_if *iface = net_pkt_iface(pkt);
+	uint8_t *hdr = context->udp_cache.hdr;
+	size_t ip_len = net_pkt_ip_hdr_len(pkt);
+	struct net_if_addr *ifaddr = NULL;
+	struct net_udp_hdr *udp_hdr;
+	uint16_t sum = IPPROTO_UDP;
+
+	udp_cache_clear(context);
+
+	if (net_pkt_ip_opts_len(pkt) ||
+	    ip_len + NET_UDPH_LEN > sizeof(context->udp_cache.hdr)) {
+		return;
+	}
+
+	net_pkt_cursor_init(pkt);
+
+	if (net_pkt_read(pkt, hdr, ip_len + NET_UDPH_LEN)) {
+		return;
+	}
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(pkt) == AF_INET) {
+		struct net_ipv4_hdr *ipv4_hdr = (struct net_ipv4_hdr *)hdr;
+
+		ipv4_hdr->len = 0U;
+		ipv4_hdr->ttl = 0U;
+		ipv4_hdr->chksum = 0U;
+
+		ifaddr = net_if_ipv4_addr_lookup(
+				(struct in_addr *)ipv4_hdr->src, NULL);
+
+		context->udp_cache.ip_sum =
+			net_calc_chksum_partial(0, hdr, ip_len);
+
+		/* Source and destination follow each other */
+		sum = net_calc_chksum_partial(sum, ipv4_hdr->src,
+					      2 * sizeof(struct in_addr));
+	} else if (IS_ENABLED(CONFIG_NET_IPV6) &&
+		   net_pkt_family(pkt) == AF_INET6) {
+		struct net_ipv6_hdr *ipv6_hdr = (struct net_ipv6_hdr *)hdr;
+
+		ipv6_hdr->len = 0U;
+		ipv6_hdr->hop_limit = 0U;
+
+		ifaddr = net_if_ipv6_addr_lookup_by_iface(
+				iface, (struct in6_addr *)ipv6_hdr->src);
+
+		sum = net_calc_chksum_partial(sum, ipv6_hdr->src,
+					      2 * sizeof(struct in6_addr));
+	}
+
+	if (!ifaddr) {
+		return;
+	}
+
+	udp_hdr = (struct net_udp_hdr *)(hdr + ip_len);
+	udp_hdr->len = 0U;
+	udp_hdr->chksum = 0U;
+
+	context->udp_cache.udp_sum =
+		net_calc_chksum_partial(sum, (uint8_t *)udp_hdr, NET_UDPH_LEN);
+	context->udp_cache.iface = iface;
+	context->udp_cache.ifaddr = ifaddr;
+	context->udp_cache.chksum = net_if_need_calc_tx_checksum(iface);
+	context->udp_cache.hdr_len = ip_len + NET_UDPH_LEN;
+}
+
+/* Everything the cached headers were built from must still hold. The
+ * destination and the ports only change via connect() and bind(), which
+ * clear the cache.
+ */
+static bool udp_cache_valid(struct net_context *context)
+{
+	struct net_if_addr *ifaddr = context->udp_cache.ifaddr;
+	struct net_if *iface = context->udp_cache.iface;
+	const uint8_t *hdr = context->udp_cache.hdr;
+
+	if (!context->udp_cache.hdr_len ||
+	    iface != net_context_get_iface(context) || !net_if_is_up(iface) ||
+	    !ifaddr->is_used || ifaddr->addr_state != NET_ADDR_PREFERRED) {
+		return false;
+	}
+
+	/* The address entry may have been reused for another address */
+	if (IS_ENABLED(CONFIG_NET_IPV4) &&
+	    net_context_get_family(context) == AF_INET) {
+		return net_ipv4_addr_cmp_raw(((struct net_ipv4_hdr *)hdr)->src,
+					     ifaddr->address.in_addr.s4_addr);
+	}
+
+	return net_ipv6_addr_cmp_raw(((struct net_ipv6_hdr *)hdr)->src,
+				     ifaddr->address.in6_addr.s6_addr);
+}
+
+static int context_udp_fast_send(struct net_context *context,
+				 const void *buf, size_t len,
+				 net_context_send_cb_t cb, void *user_data)
+{
+	uint8_t hdr_len = context->udp_cache.hdr_len;
+	uint8_t ip_len = hdr_len - NET_UDPH_LEN;
+	uint16_t udp_len = NET_UDPH_LEN + len;
+	uint8_t hdr[NET_IPV6UDPH_LEN] __aligned(4);
+	struct net_udp_hdr *udp_hdr;
+	struct net_pkt *pkt;
+	int ret;
+
+	pkt = context_alloc_pkt(context, len, PKT_WAIT_TIME);
+	if (!pkt) {
+		NET_ERR("Failed to allocate net_pkt");
+		return -ENOBUFS;
+	}
+
+	if (net_pkt_available_payload_buffer(pkt, IPPROTO_UDP) < len) {
+		NET_ERR("Available payload buffer is not enough for "
+			"requested DGRAM (%zu)", len);
+		ret = -ENOMEM;
+		goto fail;
+	}
+
+	context->send_cb = cb;
+	context->user_data = user_data;
+
+	if (IS_ENABLED(CONFIG_NET_CONTEXT_PRIORITY)) {
+		uint8_t priority;
+
+		get_context_priority(context, &priority, NULL);
+		net_pkt_set_priority(pkt, priority);
+	}
+
+	memcpy(hdr, context->udp_cache.hdr, hdr_len);
+
+	udp_hdr = (struct net_udp_hdr *)(hdr + ip_len);
+	udp_hdr->len = htons(udp_len);
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) &&
+	    net_context_get_family(context) == AF_INET) {
+		struct net_ipv4_hdr *ipv4_hdr = (struct net_ipv4_hdr *)hdr;
+		uint8_t ttl = net_context_get_ipv4_ttl(context);
+
+		if (ttl == 0U) {
+			ttl = net_if_ipv4_get_ttl(context->udp_cache.iface);
+		}
+
+		ipv4_hdr->len = htons(ip_len + udp_len);
+		ipv4_hdr->ttl = ttl;
+
+		/* The TTL is the upper byte of its 16-bit word */
+		if (context->udp_cache.chksum) {
+			ipv4_hdr->chksum = chksum_fold(
+				chksum_add(chksum_add(context->udp_cache.ip_sum,
+						      ip_len + udp_len),
+					   ttl << 8));
+		}
+
+		net_pkt_set_ipv4_ttl(pkt, ttl);
+	} else if (IS_ENABLED(CONFIG_NET_IPV6)) {
+		struct net_ipv6_hdr *ipv6_hdr = (struct net_ipv6_hdr *)hdr;
+		uint8_t hop_limit = net_context_get_ipv6_hop_limit(context);
+
+		if (hop_limit == 0U) {
+			hop_limit = net_if_ipv6_get_hop_limit(
+					context->udp_cache.iface);
+		}
+
+		ipv6_hdr->len = htons(udp_len);
+		ipv6_hdr->hop_limit = hop_limit;
+
+		net_pkt_set_ipv6_ext_len(pkt, 0);
+		net_pkt_set_ipv6_hop_limit(pkt, hop_limit);
+	}
+
+	/* The length is both in the pseudo header and in the UDP header */
+	if (context->udp_cache.chksum) {
+		uint16_t sum = context->udp_cache.udp_sum;
+
+		sum = chksum_add(chksum_add(sum, udp_len), udp_len);
+		sum = net_calc_chksum_partial(sum, buf, len);
+
+		udp_hdr->chksum = chksum_fold(sum);
+	}
+
+	net_pkt_set_ip_hdr_len(pkt, ip_len);
+
+	if (net_pkt_write(pkt, hdr, hdr_len) || net_pkt_write(pkt, buf, len)) {
+		ret = -ENOBUFS;
+		goto fail;
+	}
+
+	/* As after net_ipv4_finalize() and net_ipv6_finalize() */
+	net_pkt_set_overwrite(pkt, true);
+
+	ret = net_send_data(pkt);
+	if (ret < 0) {
+		goto fail;
+	}
+
+	return len;
+
+fail:
+	net_pkt_unref(pkt);
+
+	return ret;
+}
+#else
+#define udp_cache_update(...)
+#endif /* CONFIG_NET_UDP_FAST_PATH */
+
 static int context_sendto(struct net_context *context,
 			  const void *buf,
 			  size_t len,
@@ -1720,6 +1992,11 @@ static int context_sendto(struct net_context *context,
 
 		context_finalize_packet(context, pkt);
 
+		/* Connected, the next packets can use the same headers */
+		if (!sendto && !msghdr) {
+			udp_cache_update(context, pkt);
+		}
+
 		ret = net_send_data(pkt);
 	} else if (IS_ENABLED(CONFIG_NET_TCP) &&
 		   net_context_get_ip_proto(context) == IPPROTO_TCP) {
@@ -1814,6 +2091,14 @@ int net_context_send(struct net_context *context,
 		addrlen = 0;
 	}
 
+#if defined(CONFIG_NET_UDP_FAST_PATH)
+	if (net_context_get_ip_proto(context) == IPPROTO_UDP &&
+	    net_context_is_used(context) && udp_cache_valid(context)) {
+		ret = context_udp_fast_send(context, buf, len, cb, user_data);
+		goto unlock;
+	}
+#endif
+
 	ret = context_sendto(context, buf, len, &context->remote,
 			     addrlen, cb, timeout, user_data, false);
 unlock:
@@ -2400,6 +2685,20 @@ void net_context_foreach(net_context_cb_t cb, void *user_data)
 	k_sem_give(&contexts_lock);
 }
 
+#if defined(CONFIG_NET_PKT_BUDGET)
+int net_context_set_buf_budget(struct net_context *context,
+			       uint16_t reserved, uint16_t limit)
+{
+	NET_ASSERT(PART_OF_ARRAY(contexts, context));
+
+	if (!net_context_is_used(context)) {
+		return -EBADF;
+	}
+
+	return net_pkt_budget_set(&context->tx_budget, true, reserved, limit);
+}
+#endif /* CONFIG_NET_PKT_BUDGET */
+
 const char *net_context_state(struct net_context *context)
 {
 	switch (net_context_get_state(context)) {
@@ -81,6 +81,13 @@ static inline enum net_verdict process_data(struct net_pkt *pkt,
 	}
 #endif
 
+#if defined(CONFIG_NET_IPV4_FRAGMENT)
+	/* Same as above but for a reassembled IPv4 packet. */
+	if (net_pkt_ipv4_reassembled(pkt)) {
+		locally_routed = true;
+	}
+#endif
+
 	/* If there is no data, then drop the packet. */
 	if (!pkt->frags) {
 		NET_DBG("Corrupted packet (frags %p)", pkt->frags);
@@ -409,6 +416,12 @@ static void net_queue_rx(struct net_if *iface, struct net_pkt *pkt)
 
 	if (NET_TC_RX_COUNT == 0) {
 		net_process_rx_packet(pkt);
+	} else if (IS_ENABLED(CONFIG_NET_GPTP_RX_FAST_PATH) &&
+		   !k_is_in_isr() && net_gptp_is_frame(iface, pkt)) {
+		/* Timing messages are not delayed behind the other traffic.
+		 * They are handled on the caller's stack, so never from ISR.
+		 */
+		net_process_rx_packet(pkt);
 	} else {
 		net_tc_submit_to_rx_queue(tc, pkt);
 	}
@@ -24,6 +24,7 @@ LOG_MODULE_REGISTER(net_if, CONFIG_NET_IF_LOG_LEVEL);
 
 #include "net_private.h"
 #include "ipv6.h"
+#include "ipv4.h"
 #include "ipv4_autoconf_internal.h"
 
 #include "net_stats.h"
@@ -404,6 +405,27 @@ void net_if_stats_reset_all(void)
 #endif
 }
 
+#if defined(CONFIG_NET_PKT_BUDGET)
+int net_if_set_buf_budget(struct net_if *iface, bool tx,
+			  uint16_t reserved, uint16_t limit)
+{
+	return net_pkt_budget_set(tx ? &iface->tx_budget : &iface->rx_budget,
+				  tx, reserved, limit);
+}
+
+static void init_iface_budget(struct net_if *iface)
+{
+	if (net_if_set_buf_budget(iface, false,
+				  CONFIG_NET_PKT_BUDGET_IFACE_RX_RESERVED, 0) ||
+	    net_if_set_buf_budget(iface, true,
+				  CONFIG_NET_PKT_BUDGET_IFACE_TX_RESERVED, 0)) {
+		NET_WARN("Iface %p buffer reservation does not fit", iface);
+	}
+}
+#else
+#define init_iface_budget(...)
+#endif /* CONFIG_NET_PKT_BUDGET */
+
 static inline void init_iface(struct net_if *iface)
 {
 	const struct net_if_api *api = net_if_get_device(iface)->api;
@@ -423,6 +445,7 @@ static inline void init_iface(struct net_if *iface)
 	net_if_flag_set(iface, NET_IF_IPV6);
 #endif
 	net_virtual_init(iface);
+	init_iface_budget(iface);
 
 	NET_DBG("On iface %p", iface);
 
@@ -484,6 +507,11 @@ enum net_verdict net_if_send_data(struct net_if *iface, struct net_pkt *pkt)
 		verdict = net_ipv6_prepare_for_send(pkt);
 	}
 
+	/* Fragment the packet if it does not fit into the MTU. */
+	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(pkt) == AF_INET) {
+		verdict = net_ipv4_prepare_for_send(pkt);
+	}
+
 done:
 	/*   NET_OK in which case packet has checked successfully. In this case
 	 *   the net_context callback is called after successful delivery in
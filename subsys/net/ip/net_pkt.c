@@ -497,6 +497,214 @@ static inline struct net_buf_pool *get_data_pool(struct net_context *context)
 #define get_data_pool(...) NULL
 #endif /* CONFIG_NET_CONTEXT_NET_PKT_POOL */
 
+#if defined(CONFIG_NET_PKT_BUDGET)
+/* Budgets reserve buffers of the global data pools. Buffers that are
+ * reserved but not used cannot be given to anybody else, the rest of the
+ * pool is shared. The accounting is done per packet: the buffers charged
+ * when the data is allocated are returned when the packet is freed.
+ */
+struct budget_pool {
+	uint16_t total;
+	uint16_t used;
+	uint16_t unused_reserved;
+	uint16_t peak;
+	uint32_t denied;
+};
+
+static struct budget_pool rx_budget = { .total = CONFIG_NET_BUF_RX_COUNT };
+static struct budget_pool tx_budget = { .total = CONFIG_NET_BUF_TX_COUNT };
+static struct k_spinlock budget_lock;
+
+static inline uint16_t budget_unused(struct net_buf_budget *budget,
+				     uint16_t reserved)
+{
+	return budget->used < reserved ? reserved - budget->used : 0U;
+}
+
+static bool budget_charge(struct budget_pool *pool,
+			  struct net_buf_budget *budget, uint16_t count)
+{
+	k_spinlock_key_t key = k_spin_lock(&budget_lock);
+	uint16_t guaranteed = 0U;
+	uint16_t others;
+
+	if (budget) {
+		if (budget->limit && budget->used + count > budget->limit) {
+			goto denied;
+		}
+
+		guaranteed = MIN(count, budget_unused(budget,
+						      budget->reserved));
+	}
+
+	/* The rest comes from the shared buffers. If others hold
+	 * reservations, fail now instead of waiting for the pool to
+	 * run dry.
+	 */
+	others = pool->unused_reserved - guaranteed;
+	if (others > 0 &&
+	    pool->used + pool->unused_reserved + count - guaranteed >
+	    pool->total) {
+		goto denied;
+	}
+
+	pool->used += count;
+	pool->unused_reserved -= guaranteed;
+	pool->peak = MAX(pool->peak, pool->used);
+
+	if (budget) {
+		budget->used += count;
+		budget->peak = MAX(budget->peak, budget->used);
+	}
+
+	k_spin_unlock(&budget_lock, key);
+
+	return true;
+
+denied:
+	pool->denied++;
+
+	if (budget) {
+		budget->denied++;
+	}
+
+	k_spin_unlock(&budget_lock, key);
+
+	return false;
+}
+
+static void budget_uncharge(struct budget_pool *pool,
+			    struct net_buf_budget *budget, uint16_t count)
+{
+	k_spinlock_key_t key = k_spin_lock(&budget_lock);
+
+	if (budget) {
+		uint16_t unused = budget_unused(budget, budget->reserved);
+
+		budget->used -= count;
+		pool->unused_reserved += budget_unused(budget,
+						       budget->reserved) -
+					 unused;
+	}
+
+	pool->used -= count;
+
+	k_spin_unlock(&budget_lock, key);
+}
+
+int net_pkt_budget_set(struct net_buf_budget *budget, bool tx,
+		       uint16_t reserved, uint16_t limit)
+{
+	struct budget_pool *pool = tx ? &tx_budget : &rx_budget;
+	uint16_t unused, new_unused;
+	k_spinlock_key_t key;
+	int ret = 0;
+
+	if (limit && reserved > limit) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&budget_lock);
+
+	unused = budget_unused(budget, budget->reserved);
+	new_unused = budget_unused(budget, reserved);
+
+	if (new_unused > unused &&
+	    pool->used + pool->unused_reserved + new_unused - unused >
+	    pool->total) {
+		ret = -ENOMEM;
+		goto out;
+	}
+
+	pool->unused_reserved = pool->unused_reserved - unused + new_unused;
+	budget->reserved = reserved;
+	budget->limit = limit;
+
+out:
+	k_spin_unlock(&budget_lock, key);
+
+	return ret;
+}
+
+void net_pkt_budget_get_info(bool tx, struct net_pkt_budget_info *info)
+{
+	struct budget_pool *pool = tx ? &tx_budget : &rx_budget;
+	k_spinlock_key_t key = k_spin_lock(&budget_lock);
+
+	info->total = pool->total;
+	info->used = pool->used;
+	info->unused_reserved = pool->unused_reserved;
+	info->peak = pool->peak;
+	info->denied = pool->denied;
+
+	k_spin_unlock(&budget_lock, key);
+}
+
+/* Returns the number of buffers charged, or -ENOBUFS if the allocation
+ * does not fit the budget. Buffers from the custom data pools of a
+ * context are not accounted.
+ */
+static int pkt_budget_charge(struct net_pkt *pkt, struct net_buf_pool *pool,
+			     size_t size)
+{
+	uint16_t count = ceiling_fraction(size, CONFIG_NET_BUF_DATA_SIZE);
+
+	if (pool != &tx_bufs && pool != &rx_bufs) {
+		return 0;
+	}
+
+	if (!pkt->budget_bufs) {
+		pkt->budget_tx = pool == &tx_bufs;
+
+		if (pkt->budget_tx && pkt->context) {
+			pkt->budget = &pkt->context->tx_budget;
+		} else if (pkt->iface) {
+			pkt->budget = pkt->budget_tx ? &pkt->iface->tx_budget :
+						       &pkt->iface->rx_budget;
+		} else {
+			pkt->budget = NULL;
+		}
+	}
+
+	if (!budget_charge(pkt->budget_tx ? &tx_budget : &rx_budget,
+			   pkt->budget, count)) {
+		return -ENOBUFS;
+	}
+
+	pkt->budget_bufs += count;
+
+	return count;
+}
+
+static void pkt_budget_uncharge(struct net_pkt *pkt, uint16_t count)
+{
+	if (!count) {
+		return;
+	}
+
+	budget_uncharge(pkt->budget_tx ? &tx_budget : &rx_budget,
+			pkt->budget, count);
+
+	pkt->budget_bufs -= count;
+}
+
+/* Give back what was charged but not allocated */
+static void pkt_budget_settle(struct net_pkt *pkt, int charged,
+			      struct net_buf *buf)
+{
+	while (buf && charged > 0) {
+		charged--;
+		buf = buf->frags;
+	}
+
+	pkt_budget_uncharge(pkt, charged);
+}
+#else
+#define pkt_budget_charge(...) 0
+#define pkt_budget_uncharge(...)
+#define pkt_budget_settle(...)
+#endif /* CONFIG_NET_PKT_BUDGET */
+
 #if NET_LOG_LEVEL >= LOG_LEVEL_DBG
 void net_pkt_unref_debug(struct net_pkt *pkt, const char *caller, int line)
 {
@@ -590,6 +798,8 @@ done:
 		net_pkt_frag_unref(pkt->frags);
 	}
 
+	pkt_budget_uncharge(pkt, pkt->budget_bufs);
+
 	if (IS_ENABLED(CONFIG_NET_DEBUG_NET_PKT_NON_FRAGILE_ACCESS)) {
 		pkt->buffer = NULL;
 		net_pkt_cursor_init(pkt);
@@ -972,6 +1182,13 @@ static size_t pkt_buffer_length(struct net_pkt *pkt,
 
 		max_len = MAX(max_len, NET_IPV6_MTU);
 	} else if (IS_ENABLED(CONFIG_NET_IPV4) && family == AF_INET) {
+		if (IS_ENABLED(CONFIG_NET_IPV4_FRAGMENT) && (size > max_len)) {
+			/* We support larger packets if IPv4 fragmentation is
+			 * enabled.
+			 */
+			max_len = size;
+		}
+
 		max_len = MAX(max_len, NET_IPV4_MTU);
 	} else { /* family == AF_UNSPEC */
 #if defined (CONFIG_NET_L2_ETHERNET)
@@ -1142,6 +1359,7 @@ int net_pkt_alloc_buffer(struct net_pkt *pkt,
 	size_t alloc_len = 0;
 	size_t hdr_len = 0;
 	struct net_buf *buf;
+	int charged;
 
 	if (!size && proto == 0 && net_pkt_family(pkt) == AF_UNSPEC) {
 		return 0;
@@ -1176,6 +1394,12 @@ int net_pkt_alloc_buffer(struct net_pkt *pkt,
 		pool = pkt->slab == &tx_pkts ? &tx_bufs : &rx_bufs;
 	}
 
+	charged = pkt_budget_charge(pkt, pool, alloc_len);
+	if (charged < 0) {
+		NET_DBG("Data buffer (%zd) allocation over budget", alloc_len);
+		return charged;
+	}
+
 	if (!K_TIMEOUT_EQ(timeout, K_NO_WAIT) &&
 	    !K_TIMEOUT_EQ(timeout, K_FOREVER)) {
 		int64_t remaining = end - sys_clock_tick_get();
@@ -1193,6 +1417,8 @@ int net_pkt_alloc_buffer(struct net_pkt *pkt,
 	buf = pkt_alloc_buffer(pool, alloc_len, timeout);
 #endif
 
+	pkt_budget_settle(pkt, charged, buf);
+
 	if (!buf) {
 #if NET_LOG_LEVEL >= LOG_LEVEL_DBG
 		NET_ERR("Data buffer (%zd) allocation failed (%s:%d)",
@@ -1642,7 +1868,7 @@ static int net_pkt_cursor_operate(struct net_pkt *pkt,
 	return 0;
 }
 
-int net_pkt_skip(struct net_pkt *pkt, size_t skip)
+int net_pkt_cursor_skip(struct net_pkt *pkt, size_t skip)
 {
 	NET_DBG("pkt %p skip %zu", pkt, skip);
 
@@ -1656,55 +1882,20 @@ int net_pkt_memset(struct net_pkt *pkt, int byte, size_t amount)
 	return net_pkt_cursor_operate(pkt, &byte, amount, false, true);
 }
 
-int net_pkt_read(struct net_pkt *pkt, void *data, size_t length)
+int net_pkt_cursor_read(struct net_pkt *pkt, void *data, size_t length)
 {
 	NET_DBG("pkt %p data %p length %zu", pkt, data, length);
 
 	return net_pkt_cursor_operate(pkt, data, length, true, false);
 }
 
-int net_pkt_read_be16(struct net_pkt *pkt, uint16_t *data)
-{
-	uint8_t d16[2];
-	int ret;
-
-	ret = net_pkt_read(pkt, d16, sizeof(uint16_t));
-
-	*data = d16[0] << 8 | d16[1];
-
-	return ret;
-}
-
-int net_pkt_read_le16(struct net_pkt *pkt, uint16_t *data)
-{
-	uint8_t d16[2];
-	int ret;
-
-	ret = net_pkt_read(pkt, d16, sizeof(uint16_t));
-
-	*data = d16[1] << 8 | d16[0];
-
-	return ret;
-}
-
-int net_pkt_read_be32(struct net_pkt *pkt, uint32_t *data)
-{
-	uint8_t d32[4];
-	int ret;
-
-	ret = net_pkt_read(pkt, d32, sizeof(uint32_t));
-
-	*data = d32[0] << 24 | d32[1] << 16 | d32[2] << 8 | d32[3];
-
-	return ret;
-}
-
-int net_pkt_write(struct net_pkt *pkt, const void *data, size_t length)
+int net_pkt_cursor_write(struct net_pkt *pkt, const void *data,
+			 size_t length)
 {
 	NET_DBG("pkt %p data %p length %zu", pkt, data, length);
 
 	if (data == pkt->cursor.pos && net_pkt_is_contiguous(pkt, length)) {
-		return net_pkt_skip(pkt, length);
+		return net_pkt_cursor_skip(pkt, length);
 	}
 
 	return net_pkt_cursor_operate(pkt, (void *)data, length, true, true);
@@ -2046,8 +2237,8 @@ size_t net_pkt_get_contiguous_len(struct net_pkt *pkt)
 	return 0;
 }
 
-void *net_pkt_get_data(struct net_pkt *pkt,
-		       struct net_pkt_data_access *access)
+void *net_pkt_cursor_get_data(struct net_pkt *pkt,
+			      struct net_pkt_data_access *access)
 {
 	if (IS_ENABLED(CONFIG_NET_HEADERS_ALWAYS_CONTIGUOUS)) {
 		if (!net_pkt_is_contiguous(pkt, access->size)) {
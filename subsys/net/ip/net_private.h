@@ -128,9 +128,20 @@ void net_gptp_init(void);
  * @return Return the policy for network buffer.
  */
 enum net_verdict net_gptp_recv(struct net_if *iface, struct net_pkt *pkt);
+
+/**
+ * @brief Check if a received frame is a gPTP message.
+ *
+ * @param iface Network interface the frame was received on.
+ * @param pkt Received frame, starting with the link layer header.
+ *
+ * @return True if this is an Ethernet frame with the PTP Ethernet type.
+ */
+bool net_gptp_is_frame(struct net_if *iface, struct net_pkt *pkt);
 #else
 #define net_gptp_init()
 #define net_gptp_recv(iface, pkt) NET_DROP
+#define net_gptp_is_frame(iface, pkt) false
 #endif /* CONFIG_NET_GPTP */
 
 #if defined(CONFIG_NET_IPV6_FRAGMENT)
@@ -138,11 +149,29 @@ int net_ipv6_send_fragmented_pkt(struct net_if *iface, struct net_pkt *pkt,
 				 uint16_t pkt_len);
 #endif
 
+#if defined(CONFIG_NET_PKT_BUDGET)
+/* Data pool usage as seen by the buffer budgets */
+struct net_pkt_budget_info {
+	uint16_t total;
+	uint16_t used;
+	uint16_t unused_reserved;
+	uint16_t peak;
+	uint32_t denied;
+};
+
+extern int net_pkt_budget_set(struct net_buf_budget *budget, bool tx,
+			      uint16_t reserved, uint16_t limit);
+extern void net_pkt_budget_get_info(bool tx,
+				    struct net_pkt_budget_info *info);
+#endif /* CONFIG_NET_PKT_BUDGET */
+
 extern const char *net_proto2str(int family, int proto);
 extern char *net_byte_to_hex(char *ptr, uint8_t byte, char base, bool pad);
 extern char *net_sprint_ll_addr_buf(const uint8_t *ll, uint8_t ll_len,
 				    char *buf, int buflen);
 extern uint16_t net_calc_chksum(struct net_pkt *pkt, uint8_t proto);
+extern uint16_t net_calc_chksum_partial(uint16_t sum, const uint8_t *data,
+					size_t len);
 
 /**
  * @brief Deliver the incoming packet through the recv_cb of the net_context
@@ -39,6 +39,7 @@ LOG_MODULE_REGISTER(net_shell, LOG_LEVEL_DBG);
 #endif
 
 #include "ipv6.h"
+#include "ipv4.h"
 
 #if defined(CONFIG_NET_ARP)
 #include "ethernet/arp.h"
@@ -62,6 +63,10 @@ LOG_MODULE_REGISTER(net_shell, LOG_LEVEL_DBG);
 
 #include <zephyr/net/capture.h>
 
+#if defined(CONFIG_NET_CAPTURE_RING) && defined(CONFIG_FILE_SYSTEM)
+#include <zephyr/fs/fs.h>
+#endif
+
 #if defined(CONFIG_NET_GPTP)
 #include <zephyr/net/gptp.h>
 #include "ethernet/gptp/gptp_messages.h"
@@ -1600,6 +1605,38 @@ static void ipv6_frag_cb(struct net_ipv6_reassembly *reass,
 }
 #endif /* CONFIG_NET_IPV6_FRAGMENT */
 
+#if defined(CONFIG_NET_IPV4_FRAGMENT)
+static void ipv4_frag_cb(struct net_ipv4_reassembly *reass,
+			 void *user_data)
+{
+	struct net_shell_user_data *data = user_data;
+	const struct shell *shell = data->shell;
+	int *count = data->user_data;
+	char src[ADDR_LEN];
+	int i;
+
+	if (!*count) {
+		PR("\nIPv4 reassembly Id     Remain Bytes  "
+		   "Src             \tDst\n");
+	}
+
+	snprintk(src, ADDR_LEN, "%s", net_sprint_ipv4_addr(&reass->src));
+
+	PR("%p      0x%04x  %5d %5u %16s\t%16s\n", reass, reass->id,
+	   k_ticks_to_ms_ceil32(k_work_delayable_remaining_get(&reass->timer)),
+	   reass->len, src, net_sprint_ipv4_addr(&reass->dst));
+
+	for (i = 0; i < CONFIG_NET_IPV4_FRAGMENT_MAX_PKT; i++) {
+		if (reass->pkt[i]) {
+			PR("[%d] pkt %p offset %u\n", i, reass->pkt[i],
+			   net_pkt_ipv4_fragment_offset(reass->pkt[i]));
+		}
+	}
+
+	(*count)++;
+}
+#endif /* CONFIG_NET_IPV4_FRAGMENT */
+
 #if defined(CONFIG_NET_DEBUG_NET_PKT_ALLOC)
 static void allocs_cb(struct net_pkt *pkt,
 		      struct net_buf *buf,
@@ -1687,6 +1724,22 @@ static int cmd_net_allocs(const struct shell *shell, size_t argc, char *argv[])
 	return 0;
 }
 
+#if (defined(CONFIG_NET_ARP) && defined(CONFIG_NET_NATIVE)) || \
+	defined(CONFIG_NET_IPV6)
+static void print_nbr_lookup_stats(const struct shell *shell,
+				   const struct net_nbr_lookup_stats *stats)
+{
+	if (!IS_ENABLED(CONFIG_NET_STATISTICS) || !stats ||
+	    stats->lookups == 0U) {
+		return;
+	}
+
+	PR("\nLookups %u, misses %u, average depth %u, max depth %u\n",
+	   stats->lookups, stats->misses, stats->depth / stats->lookups,
+	   stats->max_depth);
+}
+#endif
+
 #if defined(CONFIG_NET_ARP) && defined(CONFIG_NET_NATIVE)
 static void arp_cb(struct arp_entry *entry, void *user_data)
 {
@@ -1707,7 +1760,7 @@ static void arp_cb(struct arp_entry *entry, void *user_data)
 }
 #endif /* CONFIG_NET_ARP */
 
-#if !defined(CONFIG_NET_ARP)
+#if !defined(CONFIG_NET_ARP) || !defined(CONFIG_NET_NATIVE)
 static void print_arp_error(const struct shell *shell)
 {
 	PR_INFO("Set %s to enable %s support.\n",
@@ -1718,14 +1771,14 @@ static void print_arp_error(const struct shell *shell)
 
 static int cmd_net_arp(const struct shell *shell, size_t argc, char *argv[])
 {
-#if defined(CONFIG_NET_ARP)
+#if defined(CONFIG_NET_ARP) && defined(CONFIG_NET_NATIVE)
 	struct net_shell_user_data user_data;
 	int arg = 1;
 #endif
 
 	ARG_UNUSED(argc);
 
-#if defined(CONFIG_NET_ARP)
+#if defined(CONFIG_NET_ARP) && defined(CONFIG_NET_NATIVE)
 	if (!argv[arg]) {
 		/* ARP cache content */
 		int count = 0;
@@ -1736,6 +1789,8 @@ static int cmd_net_arp(const struct shell *shell, size_t argc, char *argv[])
 		if (net_arp_foreach(arp_cb, &user_data) == 0) {
 			PR("ARP cache is empty.\n");
 		}
+
+		print_nbr_lookup_stats(shell, net_arp_lookup_stats());
 	}
 #else
 	print_arp_error(shell);
@@ -1995,6 +2050,246 @@ static int cmd_net_capture_disable(const struct shell *shell, size_t argc,
 	return 0;
 }
 
+static int cmd_net_capture_ring_enable(const struct shell *shell,
+				       size_t argc, char *argv[])
+{
+#if defined(CONFIG_NET_CAPTURE_RING)
+	struct net_if *iface = NULL;
+	int ret, if_index;
+
+	if (argc > 1) {
+		if_index = atoi(argv[1]);
+
+		iface = net_if_get_by_index(if_index);
+		if (iface == NULL) {
+			PR_WARNING("No such interface with index %d\n",
+				   if_index);
+			return -ENOEXEC;
+		}
+	}
+
+	ret = net_capture_ring_enable(iface);
+	if (ret < 0) {
+		PR_WARNING("Capture %s failed (%d)\n", "enable", ret);
+		return -ENOEXEC;
+	}
+#else
+	PR_INFO("Set %s to enable %s support.\n",
+		"CONFIG_NET_CAPTURE_RING", "network packet capture ring");
+#endif
+
+	return 0;
+}
+
+static int cmd_net_capture_ring_disable(const struct shell *shell,
+					size_t argc, char *argv[])
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+#if defined(CONFIG_NET_CAPTURE_RING)
+	net_capture_ring_disable();
+#else
+	PR_INFO("Set %s to enable %s support.\n",
+		"CONFIG_NET_CAPTURE_RING", "network packet capture ring");
+#endif
+
+	return 0;
+}
+
+static int cmd_net_capture_ring(const struct shell *shell, size_t argc,
+				char *argv[])
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+#if defined(CONFIG_NET_CAPTURE_RING)
+	struct net_capture_ring_stats stats;
+	struct net_if *iface;
+
+	net_capture_ring_get_stats(&stats);
+
+	if (net_capture_ring_is_enabled(&iface)) {
+		if (iface != NULL) {
+			PR("Capturing interface %d\n",
+			   net_if_get_by_iface(iface));
+		} else {
+			PR("Capturing all interfaces\n");
+		}
+	} else {
+		PR("Capture ring disabled\n");
+	}
+
+	PR("Captured %u, dropped %u, filtered %u\n", stats.captured,
+	   stats.dropped, stats.filtered);
+#else
+	PR_INFO("Set %s to enable %s support.\n",
+		"CONFIG_NET_CAPTURE_RING", "network packet capture ring");
+#endif
+
+	return 0;
+}
+
+#if defined(CONFIG_NET_CAPTURE_RING)
+struct capture_dump {
+	const struct shell *shell;
+	char line[64 + 1];
+	size_t pos;
+};
+
+static int capture_dump_cb(const void *data, size_t len, void *user_data)
+{
+	struct capture_dump *dump = user_data;
+	const struct shell *shell = dump->shell;
+	const uint8_t *ptr = data;
+
+	while (len--) {
+		dump->pos += bin2hex(ptr++, 1, &dump->line[dump->pos],
+				     sizeof(dump->line) - dump->pos);
+
+		if (dump->pos == sizeof(dump->line) - 1) {
+			PR("%s\n", dump->line);
+			dump->pos = 0;
+		}
+	}
+
+	return 0;
+}
+#endif
+
+static int cmd_net_capture_ring_dump(const struct shell *shell, size_t argc,
+				     char *argv[])
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+#if defined(CONFIG_NET_CAPTURE_RING)
+	struct capture_dump dump = {
+		.shell = shell,
+	};
+	int ret;
+
+	/* Hex output, "xxd -r -p" turns it back into a pcapng file */
+	ret = net_capture_ring_export(capture_dump_cb, &dump);
+	if (dump.pos > 0) {
+		PR("%s\n", dump.line);
+	}
+
+	if (ret < 0) {
+		PR_WARNING("Capture %s failed (%d)\n", "dump", ret);
+		return -ENOEXEC;
+	}
+#else
+	PR_INFO("Set %s to enable %s support.\n",
+		"CONFIG_NET_CAPTURE_RING", "network packet capture ring");
+#endif
+
+	return 0;
+}
+
+#if defined(CONFIG_NET_CAPTURE_RING) && defined(CONFIG_FILE_SYSTEM)
+static int capture_save_cb(const void *data, size_t len, void *user_data)
+{
+	ssize_t ret;
+
+	ret = fs_write(user_data, data, len);
+	if (ret < 0) {
+		return ret;
+	}
+
+	return (size_t)ret == len ? 0 : -ENOSPC;
+}
+#endif
+
+static int cmd_net_capture_ring_save(const struct shell *shell, size_t argc,
+				     char *argv[])
+{
+#if defined(CONFIG_NET_CAPTURE_RING) && defined(CONFIG_FILE_SYSTEM)
+	struct fs_file_t file;
+	int ret;
+
+	if (argc < 2) {
+		PR_WARNING("File name is missing.\n");
+		return -ENOEXEC;
+	}
+
+	fs_file_t_init(&file);
+
+	ret = fs_open(&file, argv[1], FS_O_CREATE | FS_O_WRITE);
+	if (ret < 0) {
+		PR_WARNING("Cannot open %s (%d)\n", argv[1], ret);
+		return -ENOEXEC;
+	}
+
+	ret = fs_truncate(&file, 0);
+	if (ret == 0) {
+		ret = net_capture_ring_export(capture_save_cb, &file);
+	}
+
+	fs_close(&file);
+
+	if (ret < 0) {
+		PR_WARNING("Capture %s failed (%d)\n", "save", ret);
+		return -ENOEXEC;
+	}
+
+	PR("%d packets saved to %s\n", ret, argv[1]);
+#else
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	PR_INFO("Set %s and %s to enable %s support.\n",
+		"CONFIG_NET_CAPTURE_RING", "CONFIG_FILE_SYSTEM",
+		"saving captured packets");
+#endif
+
+	return 0;
+}
+
+static int cmd_net_capture_filter(const struct shell *shell, size_t argc,
+				  char *argv[])
+{
+#if defined(CONFIG_NET_CAPTURE_FILTER)
+	struct net_capture_filter_insn prog[CONFIG_NET_CAPTURE_FILTER_MAX_LEN];
+	size_t len = 0;
+	int ret, i;
+
+	/* Each instruction is given as "code jt jf k", the same as the
+	 * output of "tcpdump -ddd" without the instruction count.
+	 */
+	if ((argc - 1) % 4 != 0 || (argc - 1) / 4 > ARRAY_SIZE(prog)) {
+		PR_WARNING("Invalid filter program\n");
+		return -ENOEXEC;
+	}
+
+	for (i = 1; i < argc; i += 4) {
+		prog[len].code = strtoul(argv[i], NULL, 0);
+		prog[len].jt = strtoul(argv[i + 1], NULL, 0);
+		prog[len].jf = strtoul(argv[i + 2], NULL, 0);
+		prog[len].k = strtoul(argv[i + 3], NULL, 0);
+		len++;
+	}
+
+	ret = net_capture_filter_set(prog, len);
+	if (ret < 0) {
+		PR_WARNING("Capture %s failed (%d)\n", "filter", ret);
+		return -ENOEXEC;
+	}
+
+	if (len == 0) {
+		PR("Capture filter cleared\n");
+	}
+#else
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	PR_INFO("Set %s to enable %s support.\n",
+		"CONFIG_NET_CAPTURE_FILTER", "network packet capture filter");
+#endif
+
+	return 0;
+}
+
 static int cmd_net_conn(const struct shell *shell, size_t argc, char *argv[])
 {
 	ARG_UNUSED(argc);
@@ -2074,6 +2369,12 @@ static int cmd_net_conn(const struct shell *shell, size_t argc, char *argv[])
 	/* Do not print anything if no fragments are pending atm */
 #endif
 
+#if defined(CONFIG_NET_IPV4_FRAGMENT)
+	count = 0;
+
+	net_ipv4_frag_foreach(ipv4_frag_cb, &user_data);
+#endif
+
 #else
 	PR_INFO("Set %s to enable %s support.\n",
 		"CONFIG_NET_OFFLOAD or CONFIG_NET_NATIVE",
@@ -2945,6 +3246,31 @@ static const char *selected_role_str(int port)
 	return "<unknown>";
 }
 
+#if defined(CONFIG_NET_GPTP_STATISTICS)
+static void gptp_print_hist(const struct shell *shell, const char *name,
+			    const uint32_t *hist)
+{
+	int i;
+
+	PR("%s:\n", name);
+
+	for (i = 0; i < GPTP_STATS_HIST_SIZE; i++) {
+		uint32_t low = i ? BIT(2 * i) : 0U;
+
+		if (!hist[i]) {
+			continue;
+		}
+
+		if (i == GPTP_STATS_HIST_SIZE - 1) {
+			PR("\t>= %u : %u\n", low, hist[i]);
+		} else {
+			PR("\t%u - %u : %u\n", low, (uint32_t)(BIT(2 * (i + 1)) - 1),
+			   hist[i]);
+		}
+	}
+}
+#endif /* CONFIG_NET_GPTP_STATISTICS */
+
 static void gptp_print_port_info(const struct shell *shell, int port)
 {
 	struct gptp_port_bmca_data *port_bmca_data;
@@ -3220,6 +3546,22 @@ static void gptp_print_port_info(const struct shell *shell, int port)
 	   "messages", "sent", port_param_ds->tx_pdelay_resp_fup_count);
 	PR("Announce %s %s                 : %u\n",
 	   "messages", "sent", port_param_ds->tx_announce_count);
+	PR("Offset from master (ns)            : %lld\n",
+	   port_param_ds->offset);
+	PR("Servo state                        : %s\n",
+	   port_param_ds->servo_locked ? "locked" : "unlocked");
+	PR("Local clock steps                  : %u\n",
+	   port_param_ds->clock_step_count);
+	PR("Servo lock lost                    : %u\n",
+	   port_param_ds->servo_unlock_count);
+	gptp_print_hist(shell, "Offset from master (ns)",
+			port_param_ds->offset_hist);
+	gptp_print_hist(shell, "Path delay (ns)",
+			port_param_ds->path_delay_hist);
+	gptp_print_hist(shell, "RX handling latency (ns)",
+			port_param_ds->rx_latency_hist);
+	gptp_print_hist(shell, "Clock updates until locked",
+			port_param_ds->servo_lock_hist);
 #endif /* CONFIG_NET_GPTP_STATISTICS */
 }
 #endif /* CONFIG_NET_GPTP */
@@ -3646,6 +3988,63 @@ static void context_info(struct net_context *context, void *user_data)
 }
 #endif /* CONFIG_NET_OFFLOAD || CONFIG_NET_NATIVE */
 
+#if defined(CONFIG_NET_PKT_BUDGET)
+static void print_budget(const struct shell *shell, const char *name,
+			 struct net_buf_budget *budget)
+{
+	PR("%s\t%u\t%u\t%u\t%u\t%u\n", name, budget->used, budget->peak,
+	   budget->reserved, budget->limit, budget->denied);
+}
+
+static void iface_budget_cb(struct net_if *iface, void *user_data)
+{
+	struct net_shell_user_data *data = user_data;
+	const struct shell *shell = data->shell;
+	char name[sizeof("TX iface 255")];
+	int idx = net_if_get_by_iface(iface);
+
+	snprintk(name, sizeof(name), "RX iface %d", idx);
+	print_budget(shell, name, &iface->rx_budget);
+
+	snprintk(name, sizeof(name), "TX iface %d", idx);
+	print_budget(shell, name, &iface->tx_budget);
+}
+
+static void context_budget_cb(struct net_context *context, void *user_data)
+{
+	struct net_shell_user_data *data = user_data;
+	const struct shell *shell = data->shell;
+	char name[sizeof("TX 0x") + 2 * sizeof(void *)];
+
+	snprintk(name, sizeof(name), "TX %p", context);
+	print_budget(shell, name, &context->tx_budget);
+}
+
+static void print_budgets(const struct shell *shell)
+{
+	struct net_shell_user_data user_data;
+	struct net_pkt_budget_info rx, tx;
+
+	net_pkt_budget_get_info(false, &rx);
+	net_pkt_budget_get_info(true, &tx);
+
+	PR("\nData buffer budgets:\n");
+	PR("Pool\tTotal\tUsed\tPeak\tShared\tDenied\n");
+	PR("RX\t%u\t%u\t%u\t%u\t%u\n", rx.total, rx.used, rx.peak,
+	   rx.total - rx.used - rx.unused_reserved, rx.denied);
+	PR("TX\t%u\t%u\t%u\t%u\t%u\n", tx.total, tx.used, tx.peak,
+	   tx.total - tx.used - tx.unused_reserved, tx.denied);
+
+	PR("\nBudget\t\tUsed\tPeak\tResvd\tLimit\tDenied\n");
+
+	user_data.shell = shell;
+	user_data.user_data = NULL;
+
+	net_if_foreach(iface_budget_cb, &user_data);
+	net_context_foreach(context_budget_cb, &user_data);
+}
+#endif /* CONFIG_NET_PKT_BUDGET */
+
 static int cmd_net_mem(const struct shell *shell, size_t argc, char *argv[])
 {
 	ARG_UNUSED(argc);
@@ -3701,6 +4100,10 @@ static int cmd_net_mem(const struct shell *shell, size_t argc, char *argv[])
 			PR("No external memory pools found.\n");
 		}
 	}
+
+#if defined(CONFIG_NET_PKT_BUDGET)
+	print_budgets(shell);
+#endif
 #else
 	PR_INFO("Set %s to enable %s support.\n",
 		"CONFIG_NET_OFFLOAD or CONFIG_NET_NATIVE", "memory usage");
@@ -3709,6 +4112,72 @@ static int cmd_net_mem(const struct shell *shell, size_t argc, char *argv[])
 	return 0;
 }
 
+static int cmd_net_mem_budget(const struct shell *shell, size_t argc,
+			      char *argv[])
+{
+#if defined(CONFIG_NET_PKT_BUDGET)
+	struct net_if *iface;
+	unsigned long reserved, limit = 0UL;
+	char *endptr;
+	bool tx;
+	int idx, ret;
+
+	if (argc < 4) {
+		PR_WARNING("Missing arguments.\n");
+		return -ENOEXEC;
+	}
+
+	idx = get_iface_idx(shell, argv[1]);
+	if (idx < 0) {
+		return -ENOEXEC;
+	}
+
+	iface = net_if_get_by_index(idx);
+	if (!iface) {
+		PR_WARNING("No such interface in index %d\n", idx);
+		return -ENOEXEC;
+	}
+
+	if (!strcmp(argv[2], "tx")) {
+		tx = true;
+	} else if (!strcmp(argv[2], "rx")) {
+		tx = false;
+	} else {
+		PR_WARNING("Unknown direction %s\n", argv[2]);
+		return -ENOEXEC;
+	}
+
+	reserved = strtoul(argv[3], &endptr, 10);
+	if (*endptr != '\0' || reserved > UINT16_MAX) {
+		PR_WARNING("Invalid reservation %s\n", argv[3]);
+		return -ENOEXEC;
+	}
+
+	if (argc > 4) {
+		limit = strtoul(argv[4], &endptr, 10);
+		if (*endptr != '\0' || limit > UINT16_MAX) {
+			PR_WARNING("Invalid limit %s\n", argv[4]);
+			return -ENOEXEC;
+		}
+	}
+
+	ret = net_if_set_buf_budget(iface, tx, reserved, limit);
+	if (ret < 0) {
+		PR_WARNING("Cannot set %s budget of interface %d (%d)\n",
+			   argv[2], idx, ret);
+		return -ENOEXEC;
+	}
+#else
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	PR_INFO("Set %s to enable %s support.\n",
+		"CONFIG_NET_PKT_BUDGET", "buffer budget");
+#endif /* CONFIG_NET_PKT_BUDGET */
+
+	return 0;
+}
+
 static int cmd_net_nbr_rm(const struct shell *shell, size_t argc,
 			  char *argv[])
 {
@@ -3828,6 +4297,8 @@ static int cmd_net_nbr(const struct shell *shell, size_t argc, char *argv[])
 	if (count == 0) {
 		PR("No neighbors.\n");
 	}
+
+	print_nbr_lookup_stats(shell, net_ipv6_nbr_lookup_stats());
 #else
 	PR_INFO("IPv6 not enabled.\n");
 #endif /* CONFIG_NET_IPV6 */
@@ -5669,6 +6140,23 @@ SHELL_STATIC_SUBCMD_SET_CREATE(net_cmd_arp,
 	SHELL_SUBCMD_SET_END
 );
 
+SHELL_STATIC_SUBCMD_SET_CREATE(net_cmd_capture_ring,
+	SHELL_CMD(enable, NULL, "Start capturing to the ring.\n"
+		  "'net capture ring enable [<interface index>]'\n"
+		  "Without an index all interfaces are captured.",
+		  cmd_net_capture_ring_enable),
+	SHELL_CMD(disable, NULL, "Stop capturing to the ring.",
+		  cmd_net_capture_ring_disable),
+	SHELL_CMD(dump, NULL, "Print the captured packets as hex encoded "
+		  "pcapng and empty the ring.",
+		  cmd_net_capture_ring_dump),
+	SHELL_CMD(save, NULL, "Save the captured packets to a pcapng file "
+		  "and empty the ring.\n"
+		  "'net capture ring save <file>'",
+		  cmd_net_capture_ring_save),
+	SHELL_SUBCMD_SET_END
+);
+
 SHELL_STATIC_SUBCMD_SET_CREATE(net_cmd_capture,
 	SHELL_CMD(setup, NULL, "Setup network packet capture.\n"
 		  "'net capture setup <remote-ip-addr> <local-addr> <peer-addr>'\n"
@@ -5686,6 +6174,15 @@ SHELL_STATIC_SUBCMD_SET_CREATE(net_cmd_capture,
 		  cmd_net_capture_enable),
 	SHELL_CMD(disable, NULL, "Disable network packet capture.",
 		  cmd_net_capture_disable),
+	SHELL_CMD(ring, &net_cmd_capture_ring,
+		  "Capture network packets to a memory ring.",
+		  cmd_net_capture_ring),
+	SHELL_CMD(filter, NULL, "Set the network packet capture filter.\n"
+		  "'net capture filter [<code> <jt> <jf> <k>]...'\n"
+		  "The instructions are the same as printed by "
+		  "'tcpdump -ddd', without the count.\n"
+		  "Without instructions the filter is cleared.",
+		  cmd_net_capture_filter),
 	SHELL_SUBCMD_SET_END
 );
 
@@ -5914,6 +6411,14 @@ static void nbr_address_get(size_t idx, struct shell_static_entry *entry)
 #define NBR_ADDRESS_CMD NULL
 #endif /* CONFIG_NET_IPV6 && CONFIG_NET_SHELL_DYN_CMD_COMPLETION */
 
+SHELL_STATIC_SUBCMD_SET_CREATE(net_cmd_mem,
+	SHELL_CMD(budget, NULL,
+		  "'net mem budget <index> <rx|tx> <reserved> [<limit>]' "
+		  "sets the data buffer budget of a network interface.",
+		  cmd_net_mem_budget),
+	SHELL_SUBCMD_SET_END
+);
+
 SHELL_STATIC_SUBCMD_SET_CREATE(net_cmd_nbr,
 	SHELL_CMD(rm, NBR_ADDRESS_CMD,
 		  "'net nbr rm <address>' removes neighbor from cache.",
@@ -6021,8 +6526,8 @@ SHELL_STATIC_SUBCMD_SET_CREATE(net_commands,
 		  "Print information about IPv6 specific information and "
 		  "configuration.",
 		  cmd_net_ipv6),
-	SHELL_CMD(mem, NULL, "Print information about network memory usage.",
-		  cmd_net_mem),
+	SHELL_CMD(mem, &net_cmd_mem, "Print information about network memory "
+		  "usage.", cmd_net_mem),
 	SHELL_CMD(nbr, &net_cmd_nbr, "Print neighbor information.",
 		  cmd_net_nbr),
 	SHELL_CMD(ping, &net_cmd_ping, "Ping a network host.", cmd_net_ping),
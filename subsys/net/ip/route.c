@@ -16,6 +16,8 @@ LOG_MODULE_REGISTER(net_route, CONFIG_NET_ROUTE_LOG_LEVEL);
 #include <limits.h>
 #include <zephyr/types.h>
 #include <zephyr/sys/slist.h>
+#include <zephyr/sys/dlist.h>
+#include <zephyr/sys/math_extras.h>
 
 #include <zephyr/net/net_pkt.h>
 #include <zephyr/net/net_core.h>
@@ -36,7 +38,7 @@ LOG_MODULE_REGISTER(net_route, CONFIG_NET_ROUTE_LOG_LEVEL);
 /* We keep track of the routes in a separate list so that we can remove
  * the oldest routes (at tail) if needed.
  */
-static sys_slist_t routes;
+static sys_dlist_t routes = SYS_DLIST_STATIC_INIT(&routes);
 
 /* Track currently active route lifetime timers */
 static sys_slist_t active_route_lifetime_timers;
@@ -135,32 +137,32 @@ static inline struct net_route_entry *net_route_data(struct net_nbr *nbr)
 
 struct net_nbr *net_route_get_nbr(struct net_route_entry *route)
 {
-	int i;
+	struct net_nbr *nbr = NULL;
+	size_t idx;
 
 	NET_ASSERT(route);
 
-	k_mutex_lock(&lock, K_FOREVER);
-
-	for (i = 0; i < CONFIG_NET_MAX_ROUTES; i++) {
-		struct net_nbr *nbr = get_nbr(i);
+	if ((uint8_t *)route < (uint8_t *)net_route_entries_pool) {
+		return NULL;
+	}
 
-		if (!nbr->ref) {
-			continue;
-		}
+	/* The route data is stored in the pool right after its neighbor
+	 * entry, so the entry can be found without searching.
+	 */
+	idx = ((uint8_t *)route - (uint8_t *)net_route_entries_pool) /
+		sizeof(net_route_entries_pool[0]);
+	if (idx >= CONFIG_NET_MAX_ROUTES) {
+		return NULL;
+	}
 
-		if (nbr->data == (uint8_t *)route) {
-			if (!nbr->ref) {
-				k_mutex_unlock(&lock);
-				return NULL;
-			}
+	k_mutex_lock(&lock, K_FOREVER);
 
-			k_mutex_unlock(&lock);
-			return nbr;
-		}
+	if (get_nbr(idx)->ref && get_nbr(idx)->data == (uint8_t *)route) {
+		nbr = get_nbr(idx);
 	}
 
 	k_mutex_unlock(&lock);
-	return NULL;
+	return nbr;
 }
 
 void net_routes_print(void)
@@ -277,19 +279,261 @@ static int nbr_nexthop_put(struct net_nbr *nbr)
 /* Route was accessed, so place it in front of the routes list */
 static inline void update_route_access(struct net_route_entry *route)
 {
-	sys_slist_find_and_remove(&routes, &route->node);
-	sys_slist_prepend(&routes, &route->node);
+	sys_dlist_remove(&route->node);
+	sys_dlist_prepend(&routes, &route->node);
 }
 
-struct net_route_entry *net_route_lookup(struct net_if *iface,
-					 struct in6_addr *dst)
+#if defined(CONFIG_NET_ROUTE_TRIE)
+/* The routes are kept in a path compressed binary trie keyed by the
+ * route prefix. A node holds the routes having exactly its prefix, and
+ * a node without routes always has two children. So a trie of N prefixes
+ * has at most 2 * N - 1 nodes.
+ */
+struct route_trie_node {
+	struct route_trie_node *parent;
+	struct route_trie_node *child[2];
+
+	/** Routes with this prefix, linked through trie_next */
+	struct net_route_entry *routes;
+
+	struct in6_addr prefix;
+	uint8_t prefix_len;
+};
+
+static struct route_trie_node trie_nodes[2 * CONFIG_NET_MAX_ROUTES];
+static struct route_trie_node *trie_free;
+static struct route_trie_node *trie_root;
+
+static inline int addr_bit(const struct in6_addr *addr, uint8_t bit)
+{
+	return (addr->s6_addr[bit / 8U] >> (7 - (bit % 8U))) & 1;
+}
+
+/* Return the number of leading bits, up to max_len, that are the same
+ * in both addresses.
+ */
+static uint8_t common_prefix_len(const struct in6_addr *a,
+				 const struct in6_addr *b,
+				 uint8_t max_len)
+{
+	uint8_t len = 0U;
+	uint8_t diff;
+	int i;
+
+	for (i = 0; i < sizeof(a->s6_addr) && len < max_len; i++) {
+		diff = a->s6_addr[i] ^ b->s6_addr[i];
+		if (diff) {
+			len += u32_count_leading_zeros(diff) - 24;
+			break;
+		}
+
+		len += 8U;
+	}
+
+	return MIN(len, max_len);
+}
+
+static struct route_trie_node *trie_node_alloc(const struct in6_addr *prefix,
+					       uint8_t prefix_len)
+{
+	struct route_trie_node *node = trie_free;
+
+	/* Cannot run out as there are two nodes for each route. */
+	NET_ASSERT(node);
+
+	trie_free = node->child[0];
+
+	memset(node, 0, sizeof(*node));
+	net_ipaddr_copy(&node->prefix, prefix);
+	node->prefix_len = prefix_len;
+
+	return node;
+}
+
+static void trie_node_free(struct route_trie_node *node)
+{
+	node->child[0] = trie_free;
+	trie_free = node;
+}
+
+static void trie_init(void)
+{
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(trie_nodes); i++) {
+		trie_node_free(&trie_nodes[i]);
+	}
+}
+
+static void route_table_add(struct net_route_entry *route)
+{
+	struct route_trie_node **link = &trie_root;
+	struct route_trie_node *parent = NULL;
+	struct route_trie_node *node, *leaf, *branch;
+	uint8_t len = route->prefix_len;
+	uint8_t common = 0U;
+
+	while ((node = *link) != NULL) {
+		common = common_prefix_len(&node->prefix, &route->addr,
+					   MIN(node->prefix_len, len));
+		if (common < node->prefix_len) {
+			break;
+		}
+
+		if (node->prefix_len == len) {
+			goto add;
+		}
+
+		parent = node;
+		link = &node->child[addr_bit(&route->addr, node->prefix_len)];
+	}
+
+	leaf = trie_node_alloc(&route->addr, len);
+	leaf->parent = parent;
+
+	if (node == NULL) {
+		*link = leaf;
+	} else if (common == len) {
+		/* The new prefix covers the prefix of the node */
+		leaf->child[addr_bit(&node->prefix, len)] = node;
+		node->parent = leaf;
+		*link = leaf;
+	} else {
+		/* Branch where the prefixes start to differ */
+		branch = trie_node_alloc(&route->addr, common);
+		branch->parent = parent;
+		branch->child[addr_bit(&route->addr, common)] = leaf;
+		branch->child[addr_bit(&node->prefix, common)] = node;
+		leaf->parent = branch;
+		node->parent = branch;
+		*link = branch;
+	}
+
+	node = leaf;
+
+add:
+	route->trie_next = node->routes;
+	node->routes = route;
+}
+
+static void route_table_remove(struct net_route_entry *route)
+{
+	struct route_trie_node *node = trie_root;
+	struct route_trie_node *parent, *child;
+	struct net_route_entry **prev;
+
+	while (node && node->prefix_len < route->prefix_len) {
+		node = node->child[addr_bit(&route->addr, node->prefix_len)];
+	}
+
+	if (!node || node->prefix_len != route->prefix_len) {
+		return;
+	}
+
+	for (prev = &node->routes; *prev; prev = &(*prev)->trie_next) {
+		if (*prev == route) {
+			*prev = route->trie_next;
+			break;
+		}
+	}
+
+	/* Drop the nodes that are not needed anymore */
+	while (!node->routes && (!node->child[0] || !node->child[1])) {
+		child = node->child[0] ? node->child[0] : node->child[1];
+		parent = node->parent;
+
+		if (parent) {
+			parent->child[parent->child[1] == node] = child;
+		} else {
+			trie_root = child;
+		}
+
+		if (child) {
+			child->parent = parent;
+		}
+
+		trie_node_free(node);
+
+		if (child || !parent) {
+			break;
+		}
+
+		node = parent;
+	}
+}
+
+static struct net_route_entry *route_table_lookup(struct net_if *iface,
+						  struct in6_addr *dst)
+{
+	struct route_trie_node *node = trie_root;
+	struct net_route_entry *route, *found = NULL;
+
+	while (node && net_ipv6_is_prefix(dst->s6_addr, node->prefix.s6_addr,
+					  node->prefix_len)) {
+		for (route = node->routes; route; route = route->trie_next) {
+			if (!iface || route->iface == iface) {
+				found = route;
+				break;
+			}
+		}
+
+		if (node->prefix_len == 128) {
+			break;
+		}
+
+		node = node->child[addr_bit(dst, node->prefix_len)];
+	}
+
+	return found;
+}
+
+static struct net_route_entry *route_table_find(struct net_if *iface,
+						struct in6_addr *addr,
+						uint8_t prefix_len)
+{
+	struct route_trie_node *node = trie_root;
+	struct net_route_entry *route;
+
+	while (node && node->prefix_len < prefix_len) {
+		node = node->child[addr_bit(addr, node->prefix_len)];
+	}
+
+	if (!node || node->prefix_len != prefix_len ||
+	    !net_ipv6_is_prefix(addr->s6_addr, node->prefix.s6_addr,
+				prefix_len)) {
+		return NULL;
+	}
+
+	for (route = node->routes; route; route = route->trie_next) {
+		if (route->iface == iface) {
+			return route;
+		}
+	}
+
+	return NULL;
+}
+#else
+static inline void trie_init(void)
+{
+}
+
+static inline void route_table_add(struct net_route_entry *route)
+{
+	ARG_UNUSED(route);
+}
+
+static inline void route_table_remove(struct net_route_entry *route)
+{
+	ARG_UNUSED(route);
+}
+
+static struct net_route_entry *route_table_lookup(struct net_if *iface,
+						  struct in6_addr *dst)
 {
 	struct net_route_entry *route, *found = NULL;
 	uint8_t longest_match = 0U;
 	int i;
 
-	k_mutex_lock(&lock, K_FOREVER);
-
 	for (i = 0; i < CONFIG_NET_MAX_ROUTES && longest_match < 128; i++) {
 		struct net_nbr *nbr = get_nbr(i);
 
@@ -312,6 +556,119 @@ struct net_route_entry *net_route_lookup(struct net_if *iface,
 		}
 	}
 
+	return found;
+}
+
+static struct net_route_entry *route_table_find(struct net_if *iface,
+						struct in6_addr *addr,
+						uint8_t prefix_len)
+{
+	struct net_route_entry *route;
+	int i;
+
+	for (i = 0; i < CONFIG_NET_MAX_ROUTES; i++) {
+		struct net_nbr *nbr = get_nbr(i);
+
+		if (!nbr->ref || nbr->iface != iface) {
+			continue;
+		}
+
+		route = net_route_data(nbr);
+
+		if (route->prefix_len == prefix_len &&
+		    net_ipv6_is_prefix(addr->s6_addr, route->addr.s6_addr,
+				       prefix_len)) {
+			return route;
+		}
+	}
+
+	return NULL;
+}
+#endif /* CONFIG_NET_ROUTE_TRIE */
+
+#if CONFIG_NET_ROUTE_CACHE_SIZE > 0
+struct route_cache_entry {
+	struct in6_addr dst;
+	struct net_if *iface;
+	struct net_route_entry *route;
+};
+
+static struct route_cache_entry route_cache[CONFIG_NET_ROUTE_CACHE_SIZE];
+
+static struct route_cache_entry *route_cache_slot(struct net_if *iface,
+						  struct in6_addr *dst)
+{
+	uint32_t hash;
+
+	/* The interface identifier part varies the most */
+	hash = UNALIGNED_GET(&dst->s6_addr32[2]) ^
+		UNALIGNED_GET(&dst->s6_addr32[3]) ^
+		(uint32_t)(uintptr_t)iface;
+	hash ^= hash >> 16;
+	hash ^= hash >> 8;
+
+	return &route_cache[hash % CONFIG_NET_ROUTE_CACHE_SIZE];
+}
+
+static struct net_route_entry *route_cache_get(struct net_if *iface,
+					       struct in6_addr *dst)
+{
+	struct route_cache_entry *entry = route_cache_slot(iface, dst);
+
+	if (entry->route && entry->iface == iface &&
+	    net_ipv6_addr_cmp(&entry->dst, dst)) {
+		return entry->route;
+	}
+
+	return NULL;
+}
+
+static void route_cache_put(struct net_if *iface, struct in6_addr *dst,
+			    struct net_route_entry *route)
+{
+	struct route_cache_entry *entry = route_cache_slot(iface, dst);
+
+	net_ipaddr_copy(&entry->dst, dst);
+	entry->iface = iface;
+	entry->route = route;
+}
+
+static void route_cache_flush(void)
+{
+	memset(route_cache, 0, sizeof(route_cache));
+}
+#else
+static inline struct net_route_entry *route_cache_get(struct net_if *iface,
+						      struct in6_addr *dst)
+{
+	return NULL;
+}
+
+static inline void route_cache_put(struct net_if *iface, struct in6_addr *dst,
+				   struct net_route_entry *route)
+{
+}
+
+static inline void route_cache_flush(void)
+{
+}
+#endif /* CONFIG_NET_ROUTE_CACHE_SIZE > 0 */
+
+struct net_route_entry *net_route_lookup(struct net_if *iface,
+					 struct in6_addr *dst)
+{
+	struct net_route_entry *found;
+
+	k_mutex_lock(&lock, K_FOREVER);
+
+	found = route_cache_get(iface, dst);
+	if (!found) {
+		found = route_table_lookup(iface, dst);
+		if (found) {
+			route_cache_put(iface, dst, found);
+		}
+	}
+
 	if (found) {
 		net_route_info("Found", found, dst);
 
@@ -377,7 +734,7 @@ struct net_route_entry *net_route_add(struct net_if *iface,
 		log_strdup(net_sprint_ll_addr(nexthop_lladdr->addr,
 					      nexthop_lladdr->len)));
 
-	route = net_route_lookup(iface, addr);
+	route = route_table_find(iface, addr, prefix_len);
 	if (route) {
 		/* Update nexthop if not the same */
 		struct in6_addr *nexthop_addr;
@@ -409,9 +766,7 @@ struct net_route_entry *net_route_add(struct net_if *iface,
 	nbr = nbr_new(iface, addr, prefix_len);
 	if (!nbr) {
 		/* Remove the oldest route and try again */
-		sys_snode_t *last = sys_slist_peek_tail(&routes);
-
-		sys_slist_find_and_remove(&routes, last);
+		sys_dnode_t *last = sys_dlist_peek_tail(&routes);
 
 		route = CONTAINER_OF(last,
 				     struct net_route_entry,
@@ -462,7 +817,10 @@ struct net_route_entry *net_route_add(struct net_if *iface,
 
 	net_route_update_lifetime(route, lifetime);
 
-	sys_slist_prepend(&routes, &route->node);
+	sys_dlist_prepend(&routes, &route->node);
+
+	route_table_add(route);
+	route_cache_flush();
 
 	tmp = nbr_nexthop_get(iface, nexthop);
 
@@ -604,7 +962,9 @@ int net_route_del(struct net_route_entry *route)
 		}
 	}
 
-	sys_slist_find_and_remove(&routes, &route->node);
+	if (sys_dnode_is_linked(&route->node)) {
+		sys_dlist_remove(&route->node);
+	}
 
 	nbr = net_route_get_nbr(route);
 	if (!nbr) {
@@ -612,6 +972,9 @@ int net_route_del(struct net_route_entry *route)
 		return -ENOENT;
 	}
 
+	route_table_remove(route);
+	route_cache_flush();
+
 	net_route_info("Deleted", route, &route->addr);
 
 	SYS_SLIST_FOR_EACH_CONTAINER(&route->nexthop, nexthop_route, node) {
@@ -1111,4 +1474,6 @@ void net_route_init(void)
 		CONFIG_NET_MAX_NEXTHOPS, sizeof(net_route_nexthop_pool));
 
 	k_work_init_delayable(&route_lifetime_timer, route_lifetime_timeout);
+
+	trie_init();
 }
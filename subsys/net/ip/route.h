@@ -15,6 +15,7 @@
 
 #include <zephyr/kernel.h>
 #include <zephyr/sys/slist.h>
+#include <zephyr/sys/dlist.h>
 
 #include <zephyr/net/net_ip.h>
 #include <zephyr/net/net_timeout.h>
@@ -47,7 +48,7 @@ struct net_route_entry {
 	 * we can remove it if we run out of available routes.
 	 * The oldest one is the last entry in the list.
 	 */
-	sys_snode_t node;
+	sys_dnode_t node;
 
 	/** List of neighbors that the routes go through. */
 	sys_slist_t nexthop;
@@ -58,6 +59,11 @@ struct net_route_entry {
 	/** Route lifetime timer. */
 	struct net_timeout lifetime;
 
+#if defined(CONFIG_NET_ROUTE_TRIE)
+	/** Next route with the same prefix in the route trie. */
+	struct net_route_entry *trie_next;
+#endif
+
 	/** IPv6 address/prefix of the route. */
 	struct in6_addr addr;
 
@@ -514,6 +514,12 @@ static uint16_t calc_chksum(uint16_t sum, const uint8_t *data, size_t len)
 	return sum;
 }
 
+/* Ones' complement sum of the data, to be continued or folded by the caller */
+uint16_t net_calc_chksum_partial(uint16_t sum, const uint8_t *data, size_t len)
+{
+	return calc_chksum(sum, data, len);
+}
+
 static inline uint16_t pkt_calc_chksum(struct net_pkt *pkt, uint16_t sum)
 {
 	struct net_pkt_cursor *cur = &pkt->cursor;
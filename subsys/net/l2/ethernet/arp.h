@@ -10,6 +10,7 @@
 #if defined(CONFIG_NET_ARP) && defined(CONFIG_NET_NATIVE)
 
 #include <zephyr/sys/slist.h>
+#include <zephyr/sys/dlist.h>
 #include <zephyr/net/ethernet.h>
 
 #ifdef __cplusplus
@@ -50,7 +51,8 @@ enum net_verdict net_arp_input(struct net_pkt *pkt,
 			       struct net_eth_hdr *eth_hdr);
 
 struct arp_entry {
-	sys_snode_t node;
+	sys_dnode_t node;
+	sys_snode_t hash_node;
 	uint32_t req_start;
 	struct net_if *iface;
 	struct in_addr ip;
@@ -64,6 +66,9 @@ typedef void (*net_arp_cb_t)(struct arp_entry *entry,
 			     void *user_data);
 int net_arp_foreach(net_arp_cb_t cb, void *user_data);
 
+struct net_nbr_lookup_stats;
+const struct net_nbr_lookup_stats *net_arp_lookup_stats(void);
+
 void net_arp_clear_cache(struct net_if *iface);
 void net_arp_init(void);
 
@@ -80,6 +85,7 @@ void net_arp_init(void);
 #define net_arp_input(...) NET_OK
 #define net_arp_clear_cache(...)
 #define net_arp_foreach(...) 0
+#define net_arp_lookup_stats(...) NULL
 #define net_arp_init(...)
 
 #endif /* CONFIG_NET_ARP */
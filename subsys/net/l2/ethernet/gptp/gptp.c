@@ -93,6 +93,71 @@ static void gptp_compute_clock_identity(int port)
 		ntohs(hdr->sequence_id), pkt)			\
 
 
+#if defined(CONFIG_NET_GPTP_STATISTICS)
+void gptp_stats_hist_add(uint32_t *hist, uint64_t value)
+{
+	int i = 0;
+
+	while (value >= 4U && i < GPTP_STATS_HIST_SIZE - 1) {
+		value >>= 2;
+		i++;
+	}
+
+	hist[i]++;
+}
+
+void gptp_stats_servo_update(int port, int64_t offset, bool step)
+{
+	struct gptp_port_param_ds *port_param_ds = GPTP_PORT_PARAM_DS(port);
+	uint64_t abs_offset = offset < 0 ? -offset : offset;
+
+	port_param_ds->offset = offset;
+	port_param_ds->servo_updates++;
+
+	gptp_stats_hist_add(port_param_ds->offset_hist, abs_offset);
+
+	if (step) {
+		port_param_ds->clock_step_count++;
+	}
+
+	if (abs_offset <= CONFIG_NET_GPTP_SERVO_LOCK_THRESHOLD) {
+		if (!port_param_ds->servo_locked) {
+			port_param_ds->servo_locked = true;
+			gptp_stats_hist_add(port_param_ds->servo_lock_hist,
+					    port_param_ds->servo_updates);
+		}
+	} else if (port_param_ds->servo_locked) {
+		port_param_ds->servo_locked = false;
+		port_param_ds->servo_unlock_count++;
+		port_param_ds->servo_updates = 0U;
+	}
+}
+
+void gptp_stats_rx_latency(int port, struct net_pkt *pkt)
+{
+	const struct device *clk;
+	struct net_ptp_time tm;
+	uint64_t rx_ns, now_ns;
+
+	rx_ns = gptp_timestamp_to_nsec(net_pkt_timestamp(pkt));
+	if (rx_ns == 0U) {
+		return;
+	}
+
+	clk = net_eth_get_ptp_clock(GPTP_PORT_IFACE(port));
+	if (!clk || ptp_clock_get(clk, &tm) < 0) {
+		return;
+	}
+
+	now_ns = gptp_timestamp_to_nsec(&tm);
+	if (now_ns < rx_ns) {
+		return;
+	}
+
+	GPTP_STATS_HIST_ADD(port, rx_latency_hist, now_ns - rx_ns);
+}
+#endif /* CONFIG_NET_GPTP_STATISTICS */
+
 static bool gptp_handle_critical_msg(struct net_if *iface, struct net_pkt *pkt)
 {
 	struct gptp_hdr *hdr = GPTP_HDR(pkt);
@@ -118,6 +183,8 @@ static bool gptp_handle_critical_msg(struct net_if *iface, struct net_pkt *pkt)
 			return handled;
 		}
 
+		gptp_stats_rx_latency(port, pkt);
+
 		if (GPTP_PORT_STATE(port)->pdelay_resp.state !=
 						GPTP_PDELAY_RESP_NOT_ENABLED) {
 			gptp_handle_pdelay_req(port, pkt);
@@ -148,6 +215,8 @@ static void gptp_handle_msg(struct net_pkt *pkt)
 		return;
 	}
 
+	gptp_stats_rx_latency(port, pkt);
+
 	pdelay_req_state = &GPTP_PORT_STATE(port)->pdelay_req;
 	sync_rcv_state = &GPTP_PORT_STATE(port)->sync_rcv;
 
@@ -326,6 +395,30 @@ static void gptp_handle_msg(struct net_pkt *pkt)
 	}
 }
 
+bool net_gptp_is_frame(struct net_if *iface, struct net_pkt *pkt)
+{
+	struct net_eth_hdr *hdr;
+	uint16_t type;
+
+	if (net_if_l2(iface) != &NET_L2_GET_NAME(ETHERNET) ||
+	    pkt->buffer->len < sizeof(struct net_eth_hdr)) {
+		return false;
+	}
+
+	hdr = NET_ETH_HDR(pkt);
+	type = ntohs(hdr->type);
+
+	if (type == NET_ETH_PTYPE_VLAN) {
+		if (pkt->buffer->len < sizeof(struct net_eth_vlan_hdr)) {
+			return false;
+		}
+
+		type = ntohs(((struct net_eth_vlan_hdr *)hdr)->type);
+	}
+
+	return type == NET_ETH_PTYPE_PTP;
+}
+
 enum net_verdict net_gptp_recv(struct net_if *iface, struct net_pkt *pkt)
 {
 	struct gptp_hdr *hdr = GPTP_HDR(pkt);
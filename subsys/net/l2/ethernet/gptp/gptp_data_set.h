@@ -63,6 +63,12 @@ extern "C" {
 	(&gptp_domain.port_param_ds[port - GPTP_PORT_START])
 #endif
 
+/* Number of histogram buckets in the statistics. Bucket 0 counts the values
+ * below 4 and bucket n the values in [4^n, 4^(n + 1)), the last one
+ * counting everything above.
+ */
+#define GPTP_STATS_HIST_SIZE 16
+
 #define CLEAR_RESELECT(global_ds, port) \
 	(global_ds->reselect_array &= (~(1 << (port - 1))))
 #define SET_RESELECT(global_ds, port) \
@@ -526,6 +532,33 @@ struct gptp_port_param_ds {
 
 	/** Neighbor propagation delay threshold exceeded. */
 	uint32_t neighbor_prop_delay_exceeded;
+
+	/** Offset from the master (ns) measured at the last clock update. */
+	int64_t offset;
+
+	/** Histogram of the absolute offsets from the master (ns). */
+	uint32_t offset_hist[GPTP_STATS_HIST_SIZE];
+
+	/** Histogram of the neighbor propagation delays (ns). */
+	uint32_t path_delay_hist[GPTP_STATS_HIST_SIZE];
+
+	/** Histogram of the time from RX timestamp to message handling (ns). */
+	uint32_t rx_latency_hist[GPTP_STATS_HIST_SIZE];
+
+	/** Histogram of the number of clock updates needed to lock. */
+	uint32_t servo_lock_hist[GPTP_STATS_HIST_SIZE];
+
+	/** Number of clock updates since the servo was last unlocked. */
+	uint32_t servo_updates;
+
+	/** Number of times the local clock was stepped. */
+	uint32_t clock_step_count;
+
+	/** Number of times the servo lost the lock. */
+	uint32_t servo_unlock_count;
+
+	/** Whether the offset is within CONFIG_NET_GPTP_SERVO_LOCK_THRESHOLD. */
+	bool servo_locked;
 };
 
 /**
@@ -348,6 +348,9 @@ static void gptp_md_compute_prop_time(int port)
 	prop_time /= 2;
 
 	port_ds->neighbor_prop_delay = prop_time;
+
+	GPTP_STATS_HIST_ADD(port, path_delay_hist,
+			    prop_time > 0 ? (uint64_t)prop_time : 0U);
 }
 
 static void gptp_md_pdelay_compute(int port)
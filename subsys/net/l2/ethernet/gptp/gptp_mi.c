@@ -744,6 +744,7 @@ static void gptp_update_local_port_clock(void)
 	int64_t second_diff;
 	const struct device *clk;
 	struct net_ptp_time tm;
+	bool step;
 	int key;
 
 	state = &GPTP_STATE()->clk_slave_sync;
@@ -783,12 +784,17 @@ static void gptp_update_local_port_clock(void)
 
 	ptp_clock_rate_adjust(clk, port_ds->neighbor_rate_ratio);
 
+	step = second_diff || nanosecond_diff < -5000 ||
+		nanosecond_diff > 5000;
+
+	gptp_stats_servo_update(port,
+				second_diff * NSEC_PER_SEC + nanosecond_diff,
+				step);
+
 	/* If time difference is too high, set the clock value.
 	 * Otherwise, adjust it.
 	 */
-	if (second_diff || (second_diff == 0 &&
-			    (nanosecond_diff < -5000 ||
-			     nanosecond_diff > 5000))) {
+	if (step) {
 		bool underflow = false;
 
 		key = irq_lock();
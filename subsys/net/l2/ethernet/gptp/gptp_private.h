@@ -26,8 +26,11 @@ extern "C" {
 
 #if defined(CONFIG_NET_GPTP_STATISTICS)
 #define GPTP_STATS_INC(port, var) (GPTP_PORT_PARAM_DS(port)->var++)
+#define GPTP_STATS_HIST_ADD(port, var, value)				\
+	gptp_stats_hist_add(GPTP_PORT_PARAM_DS(port)->var, value)
 #else
 #define GPTP_STATS_INC(port, var)
+#define GPTP_STATS_HIST_ADD(port, var, value)
 #endif
 
 /**
@@ -150,6 +153,37 @@ void gptp_change_pa_info_state_debug(
 	const char *caller, int line);
 #endif
 
+#if defined(CONFIG_NET_GPTP_STATISTICS)
+/**
+ * @brief Add a value to a statistics histogram.
+ *
+ * @param hist Histogram of GPTP_STATS_HIST_SIZE buckets.
+ * @param value Value to add.
+ */
+void gptp_stats_hist_add(uint32_t *hist, uint64_t value);
+
+/**
+ * @brief Update the servo statistics after a local clock update.
+ *
+ * @param port Port number.
+ * @param offset Offset from the master (ns) before the update.
+ * @param step Whether the clock was stepped instead of adjusted.
+ */
+void gptp_stats_servo_update(int port, int64_t offset, bool step);
+
+/**
+ * @brief Record the time between the RX timestamp of a message and its
+ * handling.
+ *
+ * @param port Port number.
+ * @param pkt Received message.
+ */
+void gptp_stats_rx_latency(int port, struct net_pkt *pkt);
+#else
+#define gptp_stats_servo_update(port, offset, step)
+#define gptp_stats_rx_latency(port, pkt)
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -171,6 +171,26 @@ static bool ieeee802154_check_dst_addr(struct net_if *iface,
 	return true;
 }
 
+#ifdef CONFIG_NET_L2_IEEE802154_RX_STATS
+/* Account the cycles since start to the given stage and start the next one */
+static inline void rx_stage_done(struct net_if *iface,
+				 enum ieee802154_rx_stage stage,
+				 uint32_t *start)
+{
+	struct ieee802154_context *ctx = net_if_l2_data(iface);
+	uint32_t now = k_cycle_get_32();
+
+	ctx->rx_stats.cycles[stage] += now - *start;
+	*start = now;
+
+	if (stage == IEEE802154_RX_STAGE_UNCOMPRESS) {
+		ctx->rx_stats.frames++;
+	}
+}
+#else
+#define rx_stage_done(...)
+#endif /* CONFIG_NET_L2_IEEE802154_RX_STATS */
+
 #ifdef CONFIG_NET_6LO
 static inline
 enum net_verdict ieee802154_manage_recv_packet(struct net_if *iface,
@@ -221,7 +241,11 @@ static enum net_verdict ieee802154_recv(struct net_if *iface,
 	const struct ieee802154_radio_api *radio =
 		net_if_get_device(iface)->api;
 	struct ieee802154_mpdu mpdu;
+	enum net_verdict verdict;
 	size_t hdr_len;
+#ifdef CONFIG_NET_L2_IEEE802154_RX_STATS
+	uint32_t start = k_cycle_get_32();
+#endif
 
 	if (!ieee802154_validate_frame(net_pkt_data(pkt),
 				       net_pkt_get_len(pkt), &mpdu)) {
@@ -261,17 +285,28 @@ static enum net_verdict ieee802154_recv(struct net_if *iface,
 	set_pkt_ll_addr(net_pkt_lladdr_dst(pkt), false,
 			mpdu.mhr.fs->fc.dst_addr_mode, mpdu.mhr.dst_addr);
 
+	rx_stage_done(iface, IEEE802154_RX_STAGE_PARSE, &start);
+
 	if (!ieee802154_decipher_data_frame(iface, pkt, &mpdu)) {
 		return NET_DROP;
 	}
 
+	rx_stage_done(iface, IEEE802154_RX_STAGE_DECIPHER, &start);
+
 	pkt_hexdump(RX_PKT_TITLE " (with ll)", pkt, true);
 
+	/* The MAC header is left as headroom, 6LoWPAN uncompresses the
+	 * IPv6 header in place there as far as the link layer addresses
+	 * allow.
+	 */
 	hdr_len = (uint8_t *)mpdu.payload - net_pkt_data(pkt);
 	net_buf_pull(pkt->buffer, hdr_len);
 
-	return ieee802154_manage_recv_packet(iface, pkt, hdr_len);
+	verdict = ieee802154_manage_recv_packet(iface, pkt, hdr_len);
+
+	rx_stage_done(iface, IEEE802154_RX_STAGE_UNCOMPRESS, &start);
 
+	return verdict;
 }
 
 static int ieee802154_send(struct net_if *iface, struct net_pkt *pkt)
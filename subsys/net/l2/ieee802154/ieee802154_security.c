@@ -41,6 +41,23 @@ int ieee802154_security_setup_session(struct ieee802154_security_ctx *sec_ctx,
 		tag_size = level_2_tag_size[level];
 	}
 
+	/* Setting up a session expands the key in the crypto driver, so
+	 * keep the existing sessions if nothing changed.
+	 */
+	if (sec_ctx->session_ready && sec_ctx->level == level &&
+	    (level == IEEE802154_SECURITY_LEVEL_NONE ||
+	     (sec_ctx->key_mode == key_mode && sec_ctx->key_len == key_len &&
+	      !memcmp(sec_ctx->key, key, key_len)))) {
+		NET_DBG("Reusing the security sessions");
+		return 0;
+	}
+
+	if (sec_ctx->session_ready) {
+		cipher_free_session(sec_ctx->enc.device, &sec_ctx->enc);
+		cipher_free_session(sec_ctx->dec.device, &sec_ctx->dec);
+		sec_ctx->session_ready = false;
+	}
+
 	sec_ctx->level = level;
 
 	if (level > IEEE802154_SECURITY_LEVEL_NONE) {
@@ -79,6 +96,8 @@ int ieee802154_security_setup_session(struct ieee802154_security_ctx *sec_ctx,
 		return ret;
 	}
 
+	sec_ctx->session_ready = true;
+
 	return 0;
 }
 
@@ -177,6 +196,7 @@ int ieee802154_security_init(struct ieee802154_security_ctx *sec_ctx)
 
 	(void)memset(&sec_ctx->enc, 0, sizeof(struct cipher_ctx));
 	(void)memset(&sec_ctx->dec, 0, sizeof(struct cipher_ctx));
+	sec_ctx->session_ready = false;
 
 	dev = device_get_binding(
 		CONFIG_NET_L2_IEEE802154_SECURITY_CRYPTO_DEV_NAME);
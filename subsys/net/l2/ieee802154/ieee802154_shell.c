@@ -590,6 +590,47 @@ static int cmd_ieee802154_get_tx_power(const struct shell *shell,
 	return 0;
 }
 
+#ifdef CONFIG_NET_L2_IEEE802154_RX_STATS
+static int cmd_ieee802154_rx_stats(const struct shell *shell,
+				   size_t argc, char *argv[])
+{
+	static const char * const stage[] = {
+		[IEEE802154_RX_STAGE_PARSE] = "parse",
+		[IEEE802154_RX_STAGE_DECIPHER] = "decipher",
+		[IEEE802154_RX_STAGE_UNCOMPRESS] = "uncompress",
+	};
+	struct net_if *iface = net_if_get_ieee802154();
+	struct ieee802154_context *ctx;
+	uint64_t cycles;
+	int i;
+
+	if (!iface) {
+		shell_fprintf(shell, SHELL_INFO,
+			      "No IEEE 802.15.4 interface found.\n");
+		return -ENOEXEC;
+	}
+
+	ctx = net_if_l2_data(iface);
+
+	shell_fprintf(shell, SHELL_NORMAL, "Data frames received %u\n",
+		      ctx->rx_stats.frames);
+
+	if (!ctx->rx_stats.frames) {
+		return 0;
+	}
+
+	for (i = 0; i < IEEE802154_RX_STAGE_COUNT; i++) {
+		cycles = ctx->rx_stats.cycles[i] / ctx->rx_stats.frames;
+
+		shell_fprintf(shell, SHELL_NORMAL,
+			      "%-10s %llu cycles (%llu ns) per frame\n",
+			      stage[i], cycles, k_cyc_to_ns_floor64(cycles));
+	}
+
+	return 0;
+}
+#endif
+
 SHELL_STATIC_SUBCMD_SET_CREATE(ieee802154_commands,
 	SHELL_CMD(ack, NULL,
 		  "<set/1 | unset/0> Set auto-ack flag",
@@ -615,6 +656,11 @@ SHELL_STATIC_SUBCMD_SET_CREATE(ieee802154_commands,
 	SHELL_CMD(get_tx_power,	NULL,
 		  "Get currently used TX power",
 		  cmd_ieee802154_get_tx_power),
+#ifdef CONFIG_NET_L2_IEEE802154_RX_STATS
+	SHELL_CMD(rx_stats, NULL,
+		  "Show the cycles spent per received data frame",
+		  cmd_ieee802154_rx_stats),
+#endif
 	SHELL_CMD(scan,	NULL,
 		  "<passive|active> <channels set n[:m:...]:x|all>"
 		  " <per-channel duration in ms>",
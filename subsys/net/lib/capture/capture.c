@@ -47,6 +47,9 @@ NET_BUF_POOL_VAR_DEFINE(capture_bufs, CONFIG_NET_CAPTURE_BUF_COUNT,
 
 static sys_slist_t net_capture_devlist;
 
+/* Number of capture devices that currently tunnel packets out */
+static atomic_t tunnels_enabled;
+
 struct net_capture {
 	sys_snode_t node;
 
@@ -483,6 +486,7 @@ static int capture_enable(const struct device *dev, struct net_if *iface)
 
 	ctx->capture_iface = iface;
 	ctx->is_enabled = true;
+	atomic_inc(&tunnels_enabled);
 
 	net_if_up(ctx->tunnel_iface);
 
@@ -493,6 +497,10 @@ static int capture_disable(const struct device *dev)
 {
 	struct net_capture *ctx = dev->data;
 
+	if (ctx->is_enabled) {
+		atomic_dec(&tunnels_enabled);
+	}
+
 	ctx->capture_iface = NULL;
 	ctx->is_enabled = false;
 
@@ -501,11 +509,27 @@ static int capture_disable(const struct device *dev)
 	return 0;
 }
 
+static bool ring_is_capturing(struct net_if *iface)
+{
+#if defined(CONFIG_NET_CAPTURE_RING)
+	struct net_if *ring_iface;
+
+	if (net_capture_ring_is_enabled(&ring_iface)) {
+		return ring_iface == NULL || ring_iface == iface;
+	}
+#else
+	ARG_UNUSED(iface);
+#endif
+
+	return false;
+}
+
 void net_capture_pkt(struct net_if *iface, struct net_pkt *pkt)
 {
 	struct k_mem_slab *orig_slab;
 	struct net_pkt *captured;
 	sys_snode_t *sn, *sns;
+	uint32_t snaplen;
 
 	/* We must prevent to capture network packet that is already captured
 	 * in order to avoid recursion.
@@ -514,8 +538,24 @@ void net_capture_pkt(struct net_if *iface, struct net_pkt *pkt)
 		return;
 	}
 
+	/* Nothing to do unless the ring or a tunnel is capturing. This is
+	 * checked without the lock, both consumers check again below.
+	 */
+	if (atomic_get(&tunnels_enabled) == 0 && !ring_is_capturing(iface)) {
+		return;
+	}
+
 	k_mutex_lock(&lock, K_FOREVER);
 
+	/* Filter before anything is copied or cloned */
+	snaplen = net_capture_filter_run(pkt);
+
+	net_capture_ring_add(iface, pkt, snaplen);
+
+	if (snaplen == 0U) {
+		goto out;
+	}
+
 	SYS_SLIST_FOR_EACH_NODE_SAFE(&net_capture_devlist, sn, sns) {
 		struct net_capture *ctx = CONTAINER_OF(sn, struct net_capture,
 						       node);
@@ -0,0 +1,408 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ *
+ * Capture filter. The filter programs use the classic BPF instruction
+ * encoding so that filters compiled by tcpdump or libpcap can be used as
+ * is. The program is checked when it is set, so running it only needs to
+ * check the packet boundaries.
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_capture, CONFIG_NET_CAPTURE_LOG_LEVEL);
+
+#include <zephyr/zephyr.h>
+#include <errno.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/net/capture.h>
+
+/* Instruction classes */
+#define BPF_CLASS(code) ((code) & 0x07)
+#define BPF_LD   0x00
+#define BPF_LDX  0x01
+#define BPF_ST   0x02
+#define BPF_STX  0x03
+#define BPF_ALU  0x04
+#define BPF_JMP  0x05
+#define BPF_RET  0x06
+#define BPF_MISC 0x07
+
+/* Load size */
+#define BPF_SIZE(code) ((code) & 0x18)
+#define BPF_W 0x00
+#define BPF_H 0x08
+#define BPF_B 0x10
+
+/* Load mode */
+#define BPF_MODE(code) ((code) & 0xe0)
+#define BPF_IMM 0x00
+#define BPF_ABS 0x20
+#define BPF_IND 0x40
+#define BPF_MEM 0x60
+#define BPF_LEN 0x80
+#define BPF_MSH 0xa0
+
+/* ALU and jump operations */
+#define BPF_OP(code) ((code) & 0xf0)
+#define BPF_ADD  0x00
+#define BPF_SUB  0x10
+#define BPF_MUL  0x20
+#define BPF_DIV  0x30
+#define BPF_OR   0x40
+#define BPF_AND  0x50
+#define BPF_LSH  0x60
+#define BPF_RSH  0x70
+#define BPF_NEG  0x80
+#define BPF_MOD  0x90
+#define BPF_XOR  0xa0
+
+#define BPF_JA   0x00
+#define BPF_JEQ  0x10
+#define BPF_JGT  0x20
+#define BPF_JGE  0x30
+#define BPF_JSET 0x40
+
+/* Operand source */
+#define BPF_SRC(code) ((code) & 0x08)
+#define BPF_K 0x00
+#define BPF_X 0x08
+
+/* Return value */
+#define BPF_RVAL(code) ((code) & 0x18)
+#define BPF_A 0x10
+
+/* Register transfers */
+#define BPF_MISCOP(code) ((code) & 0xf8)
+#define BPF_TAX 0x00
+#define BPF_TXA 0x80
+
+#define BPF_MEMWORDS 16
+
+static K_MUTEX_DEFINE(filter_lock);
+
+static struct net_capture_filter_insn filter[CONFIG_NET_CAPTURE_FILTER_MAX_LEN];
+static size_t filter_len;
+
+static bool check_load(const struct net_capture_filter_insn *insn)
+{
+	uint16_t code = insn->code;
+
+	switch (BPF_MODE(code)) {
+	case BPF_IMM:
+		return BPF_SIZE(code) == BPF_W;
+	case BPF_ABS:
+	case BPF_IND:
+		/* The index register cannot be used with ldx */
+		return BPF_CLASS(code) == BPF_LD &&
+			BPF_SIZE(code) != 0x18;
+	case BPF_MEM:
+		return BPF_SIZE(code) == BPF_W && insn->k < BPF_MEMWORDS;
+	case BPF_LEN:
+		return BPF_SIZE(code) == BPF_W;
+	case BPF_MSH:
+		return BPF_CLASS(code) == BPF_LDX && BPF_SIZE(code) == BPF_B;
+	}
+
+	return false;
+}
+
+static bool check_alu(const struct net_capture_filter_insn *insn)
+{
+	uint16_t code = insn->code;
+
+	switch (BPF_OP(code)) {
+	case BPF_DIV:
+	case BPF_MOD:
+		/* Division by zero is caught at runtime for the X register */
+		return BPF_SRC(code) == BPF_X || insn->k != 0U;
+	case BPF_ADD:
+	case BPF_SUB:
+	case BPF_MUL:
+	case BPF_OR:
+	case BPF_AND:
+	case BPF_LSH:
+	case BPF_RSH:
+	case BPF_XOR:
+	case BPF_NEG:
+		return true;
+	}
+
+	return false;
+}
+
+static bool check_jump(const struct net_capture_filter_insn *insn,
+		       size_t pc, size_t len)
+{
+	uint16_t code = insn->code;
+
+	/* Jumps are relative to the next instruction and can only go
+	 * forward, which means that every program terminates.
+	 */
+	if (BPF_OP(code) == BPF_JA) {
+		return insn->k < len - pc - 1;
+	}
+
+	switch (BPF_OP(code)) {
+	case BPF_JEQ:
+	case BPF_JGT:
+	case BPF_JGE:
+	case BPF_JSET:
+		return insn->jt < len - pc - 1 && insn->jf < len - pc - 1;
+	}
+
+	return false;
+}
+
+static bool check_insn(const struct net_capture_filter_insn *insn,
+		       size_t pc, size_t len)
+{
+	uint16_t code = insn->code;
+
+	switch (BPF_CLASS(code)) {
+	case BPF_LD:
+	case BPF_LDX:
+		return check_load(insn);
+	case BPF_ST:
+	case BPF_STX:
+		return insn->k < BPF_MEMWORDS;
+	case BPF_ALU:
+		return check_alu(insn);
+	case BPF_JMP:
+		return check_jump(insn, pc, len);
+	case BPF_RET:
+		return BPF_RVAL(code) == BPF_K || BPF_RVAL(code) == BPF_A;
+	case BPF_MISC:
+		return BPF_MISCOP(code) == BPF_TAX ||
+			BPF_MISCOP(code) == BPF_TXA;
+	}
+
+	return false;
+}
+
+int net_capture_filter_set(const struct net_capture_filter_insn *prog,
+			   size_t len)
+{
+	size_t pc;
+
+	if (prog == NULL || len == 0) {
+		k_mutex_lock(&filter_lock, K_FOREVER);
+		filter_len = 0;
+		k_mutex_unlock(&filter_lock);
+
+		return 0;
+	}
+
+	if (len > ARRAY_SIZE(filter)) {
+		NET_DBG("Filter too long (%zu > %zu)", len, ARRAY_SIZE(filter));
+		return -ENOMEM;
+	}
+
+	for (pc = 0; pc < len; pc++) {
+		if (!check_insn(&prog[pc], pc, len)) {
+			NET_DBG("Invalid filter instruction %zu (0x%04x)", pc,
+				prog[pc].code);
+			return -EINVAL;
+		}
+	}
+
+	if (BPF_CLASS(prog[len - 1].code) != BPF_RET) {
+		NET_DBG("Filter does not end with %s", "return");
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&filter_lock, K_FOREVER);
+	memcpy(filter, prog, len * sizeof(*prog));
+	filter_len = len;
+	k_mutex_unlock(&filter_lock);
+
+	return 0;
+}
+
+/* Multi-byte loads are in network byte order as in BPF */
+static bool load(struct net_pkt *pkt, uint32_t off, uint16_t size,
+		 uint32_t *val)
+{
+	uint8_t buf[sizeof(uint32_t)];
+	size_t len;
+
+	len = size == BPF_W ? 4 : (size == BPF_H ? 2 : 1);
+
+	if (net_buf_linearize(buf, len, pkt->buffer, off, len) != len) {
+		return false;
+	}
+
+	*val = len == 4 ? sys_get_be32(buf) :
+		(len == 2 ? sys_get_be16(buf) : buf[0]);
+
+	return true;
+}
+
+static uint32_t alu(uint16_t code, uint32_t a, uint32_t operand)
+{
+	switch (BPF_OP(code)) {
+	case BPF_ADD:
+		return a + operand;
+	case BPF_SUB:
+		return a - operand;
+	case BPF_MUL:
+		return a * operand;
+	case BPF_DIV:
+		return a / operand;
+	case BPF_MOD:
+		return a % operand;
+	case BPF_OR:
+		return a | operand;
+	case BPF_AND:
+		return a & operand;
+	case BPF_XOR:
+		return a ^ operand;
+	case BPF_LSH:
+		return operand < 32 ? a << operand : 0;
+	case BPF_RSH:
+		return operand < 32 ? a >> operand : 0;
+	case BPF_NEG:
+		return -a;
+	}
+
+	return a;
+}
+
+static uint32_t run(struct net_pkt *pkt)
+{
+	uint32_t mem[BPF_MEMWORDS] = { 0 };
+	uint32_t a = 0U, x = 0U;
+	size_t pc = 0;
+
+	while (pc < filter_len) {
+		const struct net_capture_filter_insn *insn = &filter[pc++];
+		uint16_t code = insn->code;
+		uint32_t val, operand;
+
+		switch (BPF_CLASS(code)) {
+		case BPF_LD:
+			switch (BPF_MODE(code)) {
+			case BPF_IMM:
+				a = insn->k;
+				break;
+			case BPF_ABS:
+				if (!load(pkt, insn->k, BPF_SIZE(code), &a)) {
+					return 0;
+				}
+				break;
+			case BPF_IND:
+				if (!load(pkt, x + insn->k, BPF_SIZE(code),
+					  &a)) {
+					return 0;
+				}
+				break;
+			case BPF_MEM:
+				a = mem[insn->k];
+				break;
+			case BPF_LEN:
+				a = net_pkt_get_len(pkt);
+				break;
+			}
+			break;
+
+		case BPF_LDX:
+			switch (BPF_MODE(code)) {
+			case BPF_IMM:
+				x = insn->k;
+				break;
+			case BPF_MEM:
+				x = mem[insn->k];
+				break;
+			case BPF_LEN:
+				x = net_pkt_get_len(pkt);
+				break;
+			case BPF_MSH:
+				/* IPv4 header length */
+				if (!load(pkt, insn->k, BPF_B, &val)) {
+					return 0;
+				}
+				x = (val & 0x0f) << 2;
+				break;
+			}
+			break;
+
+		case BPF_ST:
+			mem[insn->k] = a;
+			break;
+
+		case BPF_STX:
+			mem[insn->k] = x;
+			break;
+
+		case BPF_ALU:
+			operand = BPF_SRC(code) == BPF_X ? x : insn->k;
+
+			if (operand == 0U && (BPF_OP(code) == BPF_DIV ||
+					      BPF_OP(code) == BPF_MOD)) {
+				return 0;
+			}
+
+			a = alu(code, a, operand);
+			break;
+
+		case BPF_JMP:
+			if (BPF_OP(code) == BPF_JA) {
+				pc += insn->k;
+				break;
+			}
+
+			operand = BPF_SRC(code) == BPF_X ? x : insn->k;
+
+			switch (BPF_OP(code)) {
+			case BPF_JEQ:
+				val = a == operand;
+				break;
+			case BPF_JGT:
+				val = a > operand;
+				break;
+			case BPF_JGE:
+				val = a >= operand;
+				break;
+			default:
+				val = (a & operand) != 0U;
+				break;
+			}
+
+			pc += val ? insn->jt : insn->jf;
+			break;
+
+		case BPF_RET:
+			return BPF_RVAL(code) == BPF_A ? a : insn->k;
+
+		case BPF_MISC:
+			if (BPF_MISCOP(code) == BPF_TAX) {
+				x = a;
+			} else {
+				a = x;
+			}
+			break;
+		}
+	}
+
+	return 0;
+}
+
+uint32_t net_capture_filter_run(struct net_pkt *pkt)
+{
+	uint32_t snaplen = UINT32_MAX;
+
+	k_mutex_lock(&filter_lock, K_FOREVER);
+
+	if (filter_len > 0) {
+		snaplen = run(pkt);
+	}
+
+	k_mutex_unlock(&filter_lock);
+
+	return snaplen;
+}
@@ -0,0 +1,302 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ *
+ * Capture ring. Captured packets are copied straight from the network
+ * buffers to a fixed array of frames, without allocating a packet for the
+ * copy. The status word of each frame tells whether it belongs to the
+ * capture code or to the reader, so the reader can go through the ring
+ * without locking and can see the data in place.
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_capture, CONFIG_NET_CAPTURE_LOG_LEVEL);
+
+#include <zephyr/zephyr.h>
+#include <errno.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/net/capture.h>
+
+#define FRAME_SIZE ROUND_UP(sizeof(struct net_capture_frame) +	\
+			    CONFIG_NET_CAPTURE_RING_SNAPLEN,		\
+			    __alignof__(struct net_capture_frame))
+
+/* pcapng block types, see draft-ietf-opsawg-pcapng */
+#define PCAPNG_SHB 0x0a0d0d0a
+#define PCAPNG_IDB 0x00000001
+#define PCAPNG_EPB 0x00000006
+
+#define PCAPNG_BYTE_ORDER_MAGIC 0x1a2b3c4d
+
+#define LINKTYPE_ETHERNET       1
+#define LINKTYPE_PPP            9
+#define LINKTYPE_RAW            101
+#define LINKTYPE_IEEE802_15_4   230
+
+static uint8_t frames[CONFIG_NET_CAPTURE_RING_FRAMES][FRAME_SIZE]
+	__aligned(__alignof__(struct net_capture_frame));
+
+/* Next frame to fill and next frame to read */
+static uint16_t head;
+static uint16_t tail;
+
+static struct net_if *ring_iface;
+static bool ring_enabled;
+static struct net_capture_ring_stats ring_stats;
+
+static K_SEM_DEFINE(ring_ready, 0, 1);
+
+static inline struct net_capture_frame *get_frame(uint16_t idx)
+{
+	return (struct net_capture_frame *)frames[idx];
+}
+
+int net_capture_ring_enable(struct net_if *iface)
+{
+	if (ring_enabled) {
+		return -EALREADY;
+	}
+
+	ring_iface = iface;
+	ring_enabled = true;
+
+	return 0;
+}
+
+void net_capture_ring_disable(void)
+{
+	ring_enabled = false;
+	ring_iface = NULL;
+}
+
+bool net_capture_ring_is_enabled(struct net_if **iface)
+{
+	if (iface != NULL) {
+		*iface = ring_iface;
+	}
+
+	return ring_enabled;
+}
+
+/* Called with the capture lock held, so there is only one writer. */
+void net_capture_ring_add(struct net_if *iface, struct net_pkt *pkt,
+			  uint32_t snaplen)
+{
+	struct net_capture_frame *frame;
+	size_t len;
+
+	if (!ring_enabled || (ring_iface != NULL && ring_iface != iface)) {
+		return;
+	}
+
+	if (snaplen == 0U) {
+		ring_stats.filtered++;
+		return;
+	}
+
+	frame = get_frame(head);
+
+	if (atomic_get(&frame->status) != NET_CAPTURE_FRAME_KERNEL) {
+		ring_stats.dropped++;
+		return;
+	}
+
+	len = net_pkt_get_len(pkt);
+
+	frame->timestamp = k_ticks_to_us_floor64(k_uptime_ticks());
+	frame->len = len;
+	frame->iface = net_if_get_by_iface(iface);
+	frame->caplen = net_buf_linearize(frame->data,
+					  CONFIG_NET_CAPTURE_RING_SNAPLEN,
+					  pkt->buffer, 0,
+					  MIN(len, snaplen));
+
+	/* Hand the frame over only after the data is in place */
+	atomic_set(&frame->status, NET_CAPTURE_FRAME_USER);
+
+	head = (head + 1) % CONFIG_NET_CAPTURE_RING_FRAMES;
+	ring_stats.captured++;
+
+	k_sem_give(&ring_ready);
+}
+
+struct net_capture_frame *net_capture_ring_get(k_timeout_t timeout)
+{
+	struct net_capture_frame *frame = get_frame(tail);
+
+	/* The semaphore is only a wakeup, the frame status is the truth */
+	while (atomic_get(&frame->status) != NET_CAPTURE_FRAME_USER) {
+		if (k_sem_take(&ring_ready, timeout) < 0) {
+			return NULL;
+		}
+	}
+
+	return frame;
+}
+
+void net_capture_ring_release(struct net_capture_frame *frame)
+{
+	__ASSERT(frame == get_frame(tail), "Frames released out of order");
+
+	tail = (tail + 1) % CONFIG_NET_CAPTURE_RING_FRAMES;
+
+	atomic_set(&frame->status, NET_CAPTURE_FRAME_KERNEL);
+}
+
+void net_capture_ring_get_stats(struct net_capture_ring_stats *stats)
+{
+	*stats = ring_stats;
+}
+
+static uint16_t get_linktype(struct net_if *iface)
+{
+#if defined(CONFIG_NET_L2_PPP)
+	/* The PPP driver uses an Ethernet type link address */
+	if (net_if_l2(iface) == &NET_L2_GET_NAME(PPP)) {
+		return LINKTYPE_PPP;
+	}
+#endif
+
+	switch (net_if_get_link_addr(iface)->type) {
+	case NET_LINK_ETHERNET:
+		return LINKTYPE_ETHERNET;
+	case NET_LINK_IEEE802154:
+		return LINKTYPE_IEEE802_15_4;
+	default:
+		return LINKTYPE_RAW;
+	}
+}
+
+static int write_header(net_capture_write_cb_t cb, void *user_data)
+{
+	struct {
+		uint32_t type;
+		uint32_t len;
+		uint32_t magic;
+		uint16_t major;
+		uint16_t minor;
+		int64_t section_len;
+		uint32_t len2;
+	} __packed shb = {
+		.type = PCAPNG_SHB,
+		.len = sizeof(shb),
+		.magic = PCAPNG_BYTE_ORDER_MAGIC,
+		.major = 1,
+		.minor = 0,
+		.section_len = -1,
+		.len2 = sizeof(shb),
+	};
+	struct {
+		uint32_t type;
+		uint32_t len;
+		uint16_t linktype;
+		uint16_t reserved;
+		uint32_t snaplen;
+		uint32_t len2;
+	} __packed idb = {
+		.type = PCAPNG_IDB,
+		.len = sizeof(idb),
+		.snaplen = CONFIG_NET_CAPTURE_RING_SNAPLEN,
+		.len2 = sizeof(idb),
+	};
+	struct net_if *iface;
+	int ret, i;
+
+	ret = cb(&shb, sizeof(shb), user_data);
+	if (ret < 0) {
+		return ret;
+	}
+
+	/* One description per interface in index order, so that the
+	 * pcapng interface id is the interface index minus one.
+	 */
+	for (i = 1; (iface = net_if_get_by_index(i)) != NULL; i++) {
+		idb.linktype = get_linktype(iface);
+
+		ret = cb(&idb, sizeof(idb), user_data);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	return 0;
+}
+
+static int write_frame(struct net_capture_frame *frame,
+		       net_capture_write_cb_t cb, void *user_data)
+{
+	static const uint8_t padding[3];
+	size_t pad = ROUND_UP(frame->caplen, 4) - frame->caplen;
+	struct {
+		uint32_t type;
+		uint32_t len;
+		uint32_t iface_id;
+		uint32_t ts_high;
+		uint32_t ts_low;
+		uint32_t caplen;
+		uint32_t orig_len;
+	} __packed epb = {
+		.type = PCAPNG_EPB,
+		.iface_id = frame->iface - 1,
+		.ts_high = frame->timestamp >> 32,
+		.ts_low = (uint32_t)frame->timestamp,
+		.caplen = frame->caplen,
+		.orig_len = frame->len,
+	};
+	uint32_t block_len;
+	int ret;
+
+	block_len = sizeof(epb) + frame->caplen + pad + sizeof(block_len);
+	epb.len = block_len;
+
+	ret = cb(&epb, sizeof(epb), user_data);
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = cb(frame->data, frame->caplen, user_data);
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (pad > 0) {
+		ret = cb(padding, pad, user_data);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	return cb(&block_len, sizeof(block_len), user_data);
+}
+
+int net_capture_ring_export(net_capture_write_cb_t cb, void *user_data)
+{
+	struct net_capture_frame *frame;
+	int count = 0;
+	int ret;
+
+	ret = write_header(cb, user_data);
+	if (ret < 0) {
+		return ret;
+	}
+
+	while ((frame = net_capture_ring_get(K_NO_WAIT)) != NULL) {
+		ret = write_frame(frame, cb, user_data);
+
+		net_capture_ring_release(frame);
+
+		if (ret < 0) {
+			return ret;
+		}
+
+		count++;
+	}
+
+	return count;
+}
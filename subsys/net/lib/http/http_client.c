@@ -25,6 +25,7 @@ LOG_MODULE_REGISTER(net_http, CONFIG_NET_HTTP_LOG_LEVEL);
 #include <zephyr/net/http_client.h>
 
 #include "net_private.h"
+#include "http_client_internal.h"
 
 #define HTTP_CONTENT_LEN_SIZE 11
 #define MAX_SEND_BUF_LEN 192
@@ -197,13 +198,6 @@ static int on_header_field(struct http_parser *parser, const char *at,
 	struct http_request *req = CONTAINER_OF(parser,
 						struct http_request,
 						internal.parser);
-	const char *content_len = "Content-Length";
-	uint16_t len;
-
-	len = strlen(content_len);
-	if (length >= len && strncasecmp(at, content_len, len) == 0) {
-		req->internal.response.cl_present = true;
-	}
 
 	print_header_field(length, at);
 
@@ -216,33 +210,12 @@ static int on_header_field(struct http_parser *parser, const char *at,
 	return 0;
 }
 
-#define MAX_NUM_DIGITS	16
-
 static int on_header_value(struct http_parser *parser, const char *at,
 			   size_t length)
 {
 	struct http_request *req = CONTAINER_OF(parser,
 						struct http_request,
 						internal.parser);
-	char str[MAX_NUM_DIGITS];
-
-	if (req->internal.response.cl_present) {
-		if (length <= MAX_NUM_DIGITS - 1) {
-			long int num;
-
-			memcpy(str, at, length);
-			str[length] = 0;
-
-			num = strtol(str, NULL, 10);
-			if (num == LONG_MIN || num == LONG_MAX) {
-				return -EINVAL;
-			}
-
-			req->internal.response.content_length = num;
-		}
-
-		req->internal.response.cl_present = false;
-	}
 
 	if (req->internal.response.http_cb &&
 	    req->internal.response.http_cb->on_header_value) {
@@ -272,6 +245,17 @@ static int on_body(struct http_parser *parser, const char *at, size_t length)
 		req->internal.response.http_cb->on_body(parser, at, length);
 	}
 
+	if (req->body_cb) {
+		int ret;
+
+		ret = req->body_cb(&req->internal.response, (const uint8_t *)at,
+				   length, req->internal.user_data);
+		if (ret < 0) {
+			NET_DBG("Body callback aborted the request (%d)", ret);
+			return ret;
+		}
+	}
+
 	/* Reset the body_frag_start pointer for each fragment. */
 	if (!req->internal.response.body_frag_start) {
 		req->internal.response.body_frag_start = (uint8_t *)at;
@@ -290,6 +274,12 @@ static int on_headers_complete(struct http_parser *parser)
 						struct http_request,
 						internal.parser);
 
+	/* The parser has already decoded the Content-Length header. */
+	if (parser->flags & F_CONTENTLENGTH) {
+		req->internal.response.cl_present = true;
+		req->internal.response.content_length = parser->content_length;
+	}
+
 	if (req->internal.response.http_cb &&
 	    req->internal.response.http_cb->on_headers_complete) {
 		req->internal.response.http_cb->on_headers_complete(parser);
@@ -343,6 +333,12 @@ static int on_message_complete(struct http_parser *parser)
 		http_method_str(req->method));
 
 	req->internal.response.message_complete = 1;
+	req->internal.response.keep_alive = http_should_keep_alive(parser);
+
+	/* Stop parsing here so that any data following this response
+	 * (a pipelined response) is left for the next request.
+	 */
+	http_parser_pause(parser, 1);
 
 	return 0;
 }
@@ -392,19 +388,44 @@ static void http_client_init_parser(struct http_parser *parser,
 	settings->on_url = on_url;
 }
 
-static int http_wait_data(int sock, struct http_request *req)
+/* Receive and parse the response to the request. The first "pending" bytes
+ * of the receive buffer were already received together with the previous
+ * pipelined response. If data of a following response is received, its
+ * location is returned in "leftover" and "leftover_len".
+ */
+static int http_wait_data(int sock, struct http_request *req, size_t pending,
+			  uint8_t **leftover, size_t *leftover_len)
 {
 	int total_received = 0;
 	size_t offset = 0;
 	int received, ret;
 
+	*leftover = NULL;
+	*leftover_len = 0;
+
 	do {
-		received = zsock_recv(sock, req->internal.response.recv_buf + offset,
-				      req->internal.response.recv_buf_len - offset,
-				      0);
+		if (pending > 0) {
+			received = pending;
+			pending = 0;
+		} else {
+			received = zsock_recv(sock,
+					      req->internal.response.recv_buf + offset,
+					      req->internal.response.recv_buf_len - offset,
+					      0);
+		}
+
 		if (received == 0) {
 			/* Connection closed */
 			LOG_DBG("Connection closed");
+
+			if (req->internal.retry_on_close) {
+				/* Let the caller retry the request before
+				 * the application sees an empty response.
+				 */
+				ret = -ECONNRESET;
+				break;
+			}
+
 			ret = total_received;
 
 			if (req->internal.response.cb) {
@@ -419,6 +440,7 @@ static int http_wait_data(int sock, struct http_request *req)
 				req->internal.response.data_len = 0;
 				req->internal.response.content_length = 0;
 				req->internal.response.body_frag_start = NULL;
+				req->internal.response.keep_alive = 0;
 				memset(req->internal.response.http_status, 0,
 				       HTTP_STATUS_STR_SIZE);
 
@@ -434,19 +456,42 @@ static int http_wait_data(int sock, struct http_request *req)
 			ret = -errno;
 			break;
 		} else {
+			size_t parsed;
+
+			req->internal.retry_on_close = false;
 			req->internal.response.data_len += received;
 
-			(void)http_parser_execute(
+			parsed = http_parser_execute(
 				&req->internal.parser,
 				&req->internal.parser_settings,
 				req->internal.response.recv_buf + offset,
 				received);
+
+			if (HTTP_PARSER_ERRNO(&req->internal.parser) == HPE_CB_body) {
+				ret = -ECONNABORTED;
+				break;
+			}
+
+			if (req->internal.response.message_complete &&
+			    parsed < (size_t)received) {
+				*leftover = req->internal.response.recv_buf +
+					    offset + parsed;
+				*leftover_len = received - parsed;
+
+				req->internal.response.data_len -= *leftover_len;
+				received = parsed;
+			}
 		}
 
 		total_received += received;
 		offset += received;
 
-		if (offset >= req->internal.response.recv_buf_len) {
+		/* When the body is streamed, everything received so far has
+		 * already been handed to the application, so the buffer can
+		 * be refilled from the start.
+		 */
+		if (offset >= req->internal.response.recv_buf_len ||
+		    (req->body_cb && !req->internal.response.message_complete)) {
 			offset = 0;
 		}
 
@@ -460,7 +505,7 @@ static int http_wait_data(int sock, struct http_request *req)
 
 				notify = true;
 				event = HTTP_DATA_FINAL;
-			} else if (offset == 0) {
+			} else if (offset == 0 && !req->body_cb) {
 				NET_DBG("Calling callback for partitioned %zd len data",
 					req->internal.response.data_len);
 
@@ -480,6 +525,12 @@ static int http_wait_data(int sock, struct http_request *req)
 			}
 		}
 
+		if (req->body_cb && offset == 0) {
+			req->internal.response.data_len = 0;
+			req->internal.response.body_frag_start = NULL;
+			req->internal.response.body_frag_len = 0;
+		}
+
 		if (req->internal.response.message_complete) {
 			ret = total_received;
 			break;
@@ -499,17 +550,9 @@ static void http_timeout(struct k_work *work)
 	(void)zsock_shutdown(data->sock, ZSOCK_SHUT_RD);
 }
 
-int http_client_req(int sock, struct http_request *req,
-		    int32_t timeout, void *user_data)
+static int http_client_req_init(int sock, struct http_request *req,
+				int32_t timeout, void *user_data)
 {
-	/* Utilize the network usage by sending data in bigger blocks */
-	char send_buf[MAX_SEND_BUF_LEN];
-	const size_t send_buf_max_len = sizeof(send_buf);
-	size_t send_buf_pos = 0;
-	int total_sent = 0;
-	int ret, total_recv, i;
-	const char *method;
-
 	if (sock < 0 || req == NULL || req->response == NULL ||
 	    req->recv_buf == NULL || req->recv_buf_len == 0) {
 		return -EINVAL;
@@ -524,6 +567,57 @@ int http_client_req(int sock, struct http_request *req,
 	req->internal.user_data = user_data;
 	req->internal.sock = sock;
 	req->internal.timeout = SYS_TIMEOUT_MS(timeout);
+	req->internal.retry_on_close = false;
+
+	http_client_init_parser(&req->internal.parser,
+				&req->internal.parser_settings);
+
+	/* Let the parser skip the header callbacks if nobody is interested
+	 * in the individual headers.
+	 */
+	if (!IS_ENABLED(CONFIG_NET_HTTP_LOG_LEVEL_DBG)) {
+		if (req->http_cb == NULL ||
+		    req->http_cb->on_header_field == NULL) {
+			req->internal.parser_settings.on_header_field = NULL;
+		}
+
+		if (req->http_cb == NULL ||
+		    req->http_cb->on_header_value == NULL) {
+			req->internal.parser_settings.on_header_value = NULL;
+		}
+	}
+
+	return 0;
+}
+
+static void http_client_timeout_start(struct http_request *req)
+{
+	if (!K_TIMEOUT_EQ(req->internal.timeout, K_FOREVER) &&
+	    !K_TIMEOUT_EQ(req->internal.timeout, K_NO_WAIT)) {
+		k_work_init_delayable(&req->internal.work, http_timeout);
+		(void)k_work_reschedule(&req->internal.work,
+					req->internal.timeout);
+	}
+}
+
+static void http_client_timeout_stop(struct http_request *req)
+{
+	if (!K_TIMEOUT_EQ(req->internal.timeout, K_FOREVER) &&
+	    !K_TIMEOUT_EQ(req->internal.timeout, K_NO_WAIT)) {
+		(void)k_work_cancel_delayable(&req->internal.work);
+	}
+}
+
+static int http_send_request(int sock, struct http_request *req,
+			     void *user_data)
+{
+	/* Utilize the network usage by sending data in bigger blocks */
+	char send_buf[MAX_SEND_BUF_LEN];
+	const size_t send_buf_max_len = sizeof(send_buf);
+	size_t send_buf_pos = 0;
+	int total_sent = 0;
+	int ret, i;
+	const char *method;
 
 	method = http_method_str(req->method);
 
@@ -687,31 +781,136 @@ int http_client_req(int sock, struct http_request *req,
 
 	NET_DBG("Sent %d bytes", total_sent);
 
-	http_client_init_parser(&req->internal.parser,
-				&req->internal.parser_settings);
+	return total_sent;
 
-	if (!K_TIMEOUT_EQ(req->internal.timeout, K_FOREVER) &&
-	    !K_TIMEOUT_EQ(req->internal.timeout, K_NO_WAIT)) {
-		k_work_init_delayable(&req->internal.work, http_timeout);
-		(void)k_work_reschedule(&req->internal.work,
-					req->internal.timeout);
+out:
+	return ret;
+}
+
+int z_http_client_req(int sock, struct http_request *req,
+		      int32_t timeout, void *user_data, bool retry_on_close)
+{
+	uint8_t *leftover;
+	size_t leftover_len;
+	int total_sent;
+	int ret, total_recv;
+
+	ret = http_client_req_init(sock, req, timeout, user_data);
+	if (ret < 0) {
+		return ret;
 	}
 
+	req->internal.retry_on_close = retry_on_close;
+
+	total_sent = http_send_request(sock, req, user_data);
+	if (total_sent < 0) {
+		return total_sent;
+	}
+
+	http_client_timeout_start(req);
+
 	/* Request is sent, now wait data to be received */
-	total_recv = http_wait_data(sock, req);
+	total_recv = http_wait_data(sock, req, 0, &leftover, &leftover_len);
 	if (total_recv < 0) {
 		NET_DBG("Wait data failure (%d)", total_recv);
+
+		if (req->internal.retry_on_close) {
+			http_client_timeout_stop(req);
+			return total_recv;
+		}
 	} else {
 		NET_DBG("Received %d bytes", total_recv);
 	}
 
-	if (!K_TIMEOUT_EQ(req->internal.timeout, K_FOREVER) &&
-	    !K_TIMEOUT_EQ(req->internal.timeout, K_NO_WAIT)) {
-		(void)k_work_cancel_delayable(&req->internal.work);
+	if (leftover_len > 0) {
+		/* The connection state is unknown if the server sent more
+		 * than one response, so it must not be reused.
+		 */
+		NET_DBG("Dropping %zd bytes of unexpected data", leftover_len);
+		req->internal.response.keep_alive = 0;
 	}
 
+	http_client_timeout_stop(req);
+
 	return total_sent;
+}
 
-out:
-	return ret;
+int http_client_req(int sock, struct http_request *req,
+		    int32_t timeout, void *user_data)
+{
+	return z_http_client_req(sock, req, timeout, user_data, false);
+}
+
+int http_client_req_pipelined(int sock, struct http_request **reqs,
+			      size_t count, int32_t timeout, void *user_data)
+{
+	uint8_t *leftover = NULL;
+	size_t leftover_len = 0;
+	size_t i, completed = 0;
+	int ret;
+
+	if (reqs == NULL || count == 0) {
+		return -EINVAL;
+	}
+
+	for (i = 0; i < count; i++) {
+		ret = http_client_req_init(sock, reqs[i], timeout, user_data);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	for (i = 0; i < count; i++) {
+		ret = http_send_request(sock, reqs[i], user_data);
+		if (ret < 0) {
+			NET_DBG("Cannot send pipelined request %zd (%d)", i, ret);
+			return ret;
+		}
+	}
+
+	/* A single timeout covers the whole batch */
+	http_client_timeout_start(reqs[0]);
+
+	for (i = 0; i < count; i++) {
+		struct http_request *req = reqs[i];
+		size_t pending = leftover_len;
+
+		if (pending > req->recv_buf_len) {
+			NET_DBG("Pipelined data does not fit (%zd > %zd)",
+				pending, req->recv_buf_len);
+			ret = -EMSGSIZE;
+			break;
+		}
+
+		if (pending > 0) {
+			memmove(req->recv_buf, leftover, pending);
+		}
+
+		ret = http_wait_data(sock, req, pending, &leftover,
+				     &leftover_len);
+		if (ret < 0) {
+			NET_DBG("Wait data failure (%d)", ret);
+			break;
+		}
+
+		if (!req->internal.response.message_complete) {
+			break;
+		}
+
+		completed++;
+
+		if (!req->internal.response.keep_alive) {
+			NET_DBG("Server closes the connection after %zd "
+				"responses", completed);
+			break;
+		}
+	}
+
+	http_client_timeout_stop(reqs[0]);
+
+	if (ret < 0 && completed == 0) {
+		return ret;
+	}
+
+	return completed;
 }
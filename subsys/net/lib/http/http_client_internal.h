@@ -0,0 +1,20 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef __HTTP_CLIENT_INTERNAL_H
+#define __HTTP_CLIENT_INTERNAL_H
+
+#include <zephyr/net/http_client.h>
+
+/* Same as http_client_req(). If retry_on_close is set and the connection
+ * fails before any response data is received, the response callback is
+ * not called and an error is returned, so that the request can be sent
+ * again on another connection.
+ */
+int z_http_client_req(int sock, struct http_request *req,
+		      int32_t timeout, void *user_data, bool retry_on_close);
+
+#endif /* __HTTP_CLIENT_INTERNAL_H */
@@ -0,0 +1,357 @@
+/** @file
+ * @brief HTTP client connection pool
+ *
+ * Keeps connections to HTTP servers open between requests so that the
+ * TCP (and TLS) connection setup is not paid for every request.
+ */
+
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_http, CONFIG_NET_HTTP_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+#include <string.h>
+#include <errno.h>
+
+#include <zephyr/net/net_ip.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/net/http_client.h>
+
+#include "net_private.h"
+#include "http_client_internal.h"
+
+#define HTTP_PORT_STR_LEN sizeof("65535")
+
+struct http_client_conn {
+	/** Server the connection is made to */
+	char host[CONFIG_HTTP_CLIENT_POOL_HOST_LEN];
+	char port[HTTP_PORT_STR_LEN];
+	sec_tag_t sec_tag;
+
+	/** Time when the connection was last given back to the pool */
+	int64_t last_used;
+
+	/** Socket of the connection, <0 if the slot is free */
+	int sock;
+
+	bool in_use;
+};
+
+static struct http_client_conn conns[CONFIG_HTTP_CLIENT_POOL_SIZE] = {
+	[0 ... (CONFIG_HTTP_CLIENT_POOL_SIZE - 1)] = { .sock = -1 },
+};
+
+static K_MUTEX_DEFINE(pool_lock);
+
+static void conn_close(struct http_client_conn *conn)
+{
+	NET_DBG("Closing connection %d to %s:%s", conn->sock,
+		log_strdup(conn->host), log_strdup(conn->port));
+
+	(void)zsock_close(conn->sock);
+
+	conn->sock = -1;
+	conn->in_use = false;
+}
+
+static bool conn_is_stale(struct http_client_conn *conn)
+{
+	struct zsock_pollfd fds = {
+		.fd = conn->sock,
+		.events = ZSOCK_POLLIN,
+	};
+
+	if (k_uptime_get() - conn->last_used >=
+	    CONFIG_HTTP_CLIENT_POOL_IDLE_TIMEOUT) {
+		return true;
+	}
+
+	/* An idle HTTP connection must not have anything to read. If it
+	 * has, the server has either closed it or sent garbage.
+	 */
+	if (zsock_poll(&fds, 1, 0) != 0) {
+		return true;
+	}
+
+	return false;
+}
+
+static struct http_client_conn *conn_find(int sock)
+{
+	for (int i = 0; i < ARRAY_SIZE(conns); i++) {
+		if (conns[i].sock == sock && conns[i].in_use) {
+			return &conns[i];
+		}
+	}
+
+	return NULL;
+}
+
+static int conn_connect(const char *host, const char *port, sec_tag_t sec_tag)
+{
+	struct zsock_addrinfo hints = { 0 };
+	struct zsock_addrinfo *addr;
+	int proto = IPPROTO_TCP;
+	int sock, ret;
+
+	if (sec_tag != HTTP_CLIENT_POOL_NO_TLS) {
+		if (!IS_ENABLED(CONFIG_NET_SOCKETS_SOCKOPT_TLS)) {
+			return -EPROTONOSUPPORT;
+		}
+
+		proto = IPPROTO_TLS_1_2;
+	}
+
+	hints.ai_socktype = SOCK_STREAM;
+
+	ret = zsock_getaddrinfo(host, port, &hints, &addr);
+	if (ret != 0) {
+		NET_DBG("Cannot resolve %s (%d)", log_strdup(host), ret);
+		return -EHOSTUNREACH;
+	}
+
+	sock = zsock_socket(addr->ai_family, SOCK_STREAM, proto);
+	if (sock < 0) {
+		ret = -errno;
+		goto out;
+	}
+
+#if defined(CONFIG_NET_SOCKETS_SOCKOPT_TLS)
+	if (sec_tag != HTTP_CLIENT_POOL_NO_TLS) {
+		sec_tag_t sec_tag_list[] = { sec_tag };
+
+		if (zsock_setsockopt(sock, SOL_TLS, TLS_SEC_TAG_LIST,
+				     sec_tag_list, sizeof(sec_tag_list)) < 0 ||
+		    zsock_setsockopt(sock, SOL_TLS, TLS_HOSTNAME, host,
+				     strlen(host) + 1) < 0) {
+			ret = -errno;
+			goto close;
+		}
+	}
+#endif
+
+	if (zsock_connect(sock, addr->ai_addr, addr->ai_addrlen) < 0) {
+		ret = -errno;
+		goto close;
+	}
+
+	ret = sock;
+	goto out;
+
+close:
+	(void)zsock_close(sock);
+out:
+	zsock_freeaddrinfo(addr);
+
+	return ret;
+}
+
+static int conn_get(const char *host, const char *port, sec_tag_t sec_tag,
+		    bool *reused)
+{
+	struct http_client_conn *free_conn = NULL;
+	struct http_client_conn *oldest = NULL;
+	struct http_client_conn *conn;
+	int sock;
+
+	if (host == NULL || strlen(host) >= sizeof(conns[0].host) ||
+	    (port != NULL && strlen(port) >= sizeof(conns[0].port))) {
+		return -EINVAL;
+	}
+
+	if (port == NULL) {
+		port = (sec_tag == HTTP_CLIENT_POOL_NO_TLS) ? "80" : "443";
+	}
+
+	*reused = false;
+
+	k_mutex_lock(&pool_lock, K_FOREVER);
+
+	for (int i = 0; i < ARRAY_SIZE(conns); i++) {
+		conn = &conns[i];
+
+		if (conn->in_use) {
+			continue;
+		}
+
+		if (conn->sock >= 0 && conn_is_stale(conn)) {
+			conn_close(conn);
+		}
+
+		if (conn->sock < 0) {
+			if (free_conn == NULL) {
+				free_conn = conn;
+			}
+
+			continue;
+		}
+
+		if (conn->sec_tag == sec_tag && strcmp(conn->host, host) == 0 &&
+		    strcmp(conn->port, port) == 0) {
+			NET_DBG("Reusing connection %d to %s:%s", conn->sock,
+				log_strdup(host), log_strdup(port));
+
+			conn->in_use = true;
+			*reused = true;
+			sock = conn->sock;
+			goto out;
+		}
+
+		if (oldest == NULL || conn->last_used < oldest->last_used) {
+			oldest = conn;
+		}
+	}
+
+	if (free_conn == NULL) {
+		if (oldest == NULL) {
+			sock = -ENOMEM;
+			goto out;
+		}
+
+		/* Make room by dropping the least recently used idle
+		 * connection to some other server.
+		 */
+		conn_close(oldest);
+		free_conn = oldest;
+	}
+
+	/* Reserve the slot so that the lock need not be held while
+	 * connecting, which can take a long time.
+	 */
+	free_conn->in_use = true;
+	k_mutex_unlock(&pool_lock);
+
+	sock = conn_connect(host, port, sec_tag);
+
+	k_mutex_lock(&pool_lock, K_FOREVER);
+
+	if (sock < 0) {
+		NET_DBG("Cannot connect to %s:%s (%d)", log_strdup(host),
+			log_strdup(port), sock);
+		free_conn->in_use = false;
+		goto out;
+	}
+
+	free_conn->sock = sock;
+	free_conn->sec_tag = sec_tag;
+	strcpy(free_conn->host, host);
+	strcpy(free_conn->port, port);
+
+	NET_DBG("New connection %d to %s:%s", sock, log_strdup(host),
+		log_strdup(port));
+
+out:
+	k_mutex_unlock(&pool_lock);
+
+	return sock;
+}
+
+int http_client_conn_get(const char *host, const char *port,
+			 sec_tag_t sec_tag)
+{
+	bool reused;
+
+	return conn_get(host, port, sec_tag, &reused);
+}
+
+void http_client_conn_release(int sock, bool reuse)
+{
+	struct http_client_conn *conn;
+
+	k_mutex_lock(&pool_lock, K_FOREVER);
+
+	conn = conn_find(sock);
+	if (conn == NULL) {
+		NET_DBG("Connection %d not in the pool", sock);
+		goto out;
+	}
+
+	if (!reuse) {
+		conn_close(conn);
+		goto out;
+	}
+
+	conn->last_used = k_uptime_get();
+	conn->in_use = false;
+
+out:
+	k_mutex_unlock(&pool_lock);
+}
+
+void http_client_pool_flush(void)
+{
+	k_mutex_lock(&pool_lock, K_FOREVER);
+
+	for (int i = 0; i < ARRAY_SIZE(conns); i++) {
+		if (conns[i].sock >= 0 && !conns[i].in_use) {
+			conn_close(&conns[i]);
+		}
+	}
+
+	k_mutex_unlock(&pool_lock);
+}
+
+/* Only requests without side effects on the server are sent again, the
+ * server may have processed a request before closing the connection.
+ */
+static bool method_is_retryable(enum http_method method)
+{
+	switch (method) {
+	case HTTP_GET:
+	case HTTP_HEAD:
+	case HTTP_OPTIONS:
+	case HTTP_TRACE:
+		return true;
+	default:
+		return false;
+	}
+}
+
+int http_client_pool_req(const char *host, const char *port,
+			 sec_tag_t sec_tag, struct http_request *req,
+			 int32_t timeout, void *user_data)
+{
+	bool reused, retry;
+	int sock, ret;
+
+	if (req == NULL) {
+		return -EINVAL;
+	}
+
+	do {
+		sock = conn_get(host, port, sec_tag, &reused);
+		if (sock < 0) {
+			return sock;
+		}
+
+		/* A reused connection may have been closed by the server
+		 * while it was idle.
+		 */
+		retry = reused && method_is_retryable(req->method);
+
+		ret = z_http_client_req(sock, req, timeout, user_data, retry);
+		if (ret >= 0 && req->internal.response.message_complete) {
+			http_client_conn_release(sock,
+					req->internal.response.keep_alive);
+			break;
+		}
+
+		http_client_conn_release(sock, false);
+
+		/* Retry only if nothing was received, so the response
+		 * callback has not been called yet.
+		 */
+		retry = ret < 0 && req->internal.retry_on_close;
+		if (retry) {
+			NET_DBG("Reused connection failed (%d), reconnecting",
+				ret);
+		}
+	} while (retry);
+
+	return ret;
+}
@@ -476,6 +476,95 @@ int parser_header_state(struct http_parser *parser, char ch, char c)
 	return 0;
 }
 
+/* Match a complete header name against the headers the parser interprets.
+ * The lengths of these names are all different, so the length selects the
+ * only candidate.
+ */
+static
+enum header_states header_name_state(const char *name, size_t len)
+{
+	enum header_states state;
+	const char *known;
+	size_t i;
+
+	/* Lenient parsing allows spaces in (and after) the name. */
+	while (len > 0 && name[len - 1] == ' ') {
+		len--;
+	}
+
+	switch (len) {
+	case sizeof(UPGRADE) - 1:
+		known = UPGRADE;
+		state = h_upgrade;
+		break;
+	case sizeof(CONNECTION) - 1:
+		known = CONNECTION;
+		state = h_connection;
+		break;
+	case sizeof(CONTENT_LENGTH) - 1:
+		known = CONTENT_LENGTH;
+		state = h_content_length;
+		break;
+	case sizeof(PROXY_CONNECTION) - 1:
+		known = PROXY_CONNECTION;
+		state = h_connection;
+		break;
+	case sizeof(TRANSFER_ENCODING) - 1:
+		known = TRANSFER_ENCODING;
+		state = h_transfer_encoding;
+		break;
+	default:
+		return h_general;
+	}
+
+	for (i = 0; i < len; i++) {
+		if (TOKEN(name[i]) != known[i]) {
+			return h_general;
+		}
+	}
+
+	return state;
+}
+
+/* Word-at-a-time byte search, see "Determine if a word has a zero byte"
+ * in Bit Twiddling Hacks.
+ */
+#define REPEAT_BYTE(x) ((~0UL / 0xff) * (unsigned char)(x))
+#define HAS_ZERO_BYTE(v) (((v) - REPEAT_BYTE(0x01)) & ~(v) & REPEAT_BYTE(0x80))
+
+/* Return the first CR or LF in [p, end), or end if there is none. */
+static
+const char *find_eol(const char *p, const char *end)
+{
+	unsigned long v;
+
+	for (; p != end && ((uintptr_t)p & (sizeof(v) - 1)) != 0; p++) {
+		if (*p == CR || *p == LF) {
+			return p;
+		}
+	}
+
+	for (; end - p >= sizeof(v); p += sizeof(v)) {
+		/* Not a type-punned load, which would break strict
+		 * aliasing.
+		 */
+		memcpy(&v, p, sizeof(v));
+
+		if (HAS_ZERO_BYTE(v ^ REPEAT_BYTE(CR)) ||
+		    HAS_ZERO_BYTE(v ^ REPEAT_BYTE(LF))) {
+			break;
+		}
+	}
+
+	for (; p != end; p++) {
+		if (*p == CR || *p == LF) {
+			return p;
+		}
+	}
+
+	return end;
+}
+
 static
 int header_states(struct http_parser *parser, const char *data, size_t len,
 		  const char **ptr, enum state *p_state,
@@ -488,20 +577,12 @@ int header_states(struct http_parser *parser, const char *data, size_t len,
 	switch (h_state) {
 	case h_general: {
 		size_t limit = data + len - p;
-		const char *p_cr;
-		const char *p_lf;
+		const char *p_eol;
 
 		limit = MIN(limit, HTTP_MAX_HEADER_SIZE);
-		p_cr = (const char *)memchr(p, CR, limit);
-		p_lf = (const char *)memchr(p, LF, limit);
-		if (p_cr != NULL) {
-			if (p_lf != NULL && p_cr >= p_lf) {
-				p = p_lf;
-			} else {
-				p = p_cr;
-			}
-		} else if (UNLIKELY(p_lf != NULL)) {
-			p = p_lf;
+		p_eol = find_eol(p, p + limit);
+		if (p_eol != p + limit) {
+			p = p_eol;
 		} else {
 			p = data + len;
 		}
@@ -1488,6 +1569,8 @@ reexecute:
 		}
 
 		case s_header_field_start: {
+			const char *q;
+
 			if (ch == CR) {
 				UPDATE_STATE(s_headers_almost_done);
 				break;
@@ -1514,6 +1597,26 @@ reexecute:
 			parser->index = 0U;
 			UPDATE_STATE(s_header_field);
 
+			/* Fast path: if the whole name is in the buffer, match
+			 * it at once instead of byte by byte.
+			 */
+			for (q = p + 1; q != data + len && TOKEN(*q); q++) {
+			}
+
+			if (q != data + len && *q == ':') {
+				parser->header_state =
+					header_name_state(p, q - p);
+
+				rc = count_header_size(parser, q - p - 1);
+				if (rc != 0) {
+					goto error;
+				}
+
+				/* Continue from the ':' in s_header_field. */
+				p = q - 1;
+				break;
+			}
+
 			switch (c) {
 			case 'c':
 				parser->header_state = h_C;
@@ -59,6 +59,11 @@ static void client_disconnect(struct mqtt_client *client, int result,
 	/* Reset internal state. */
 	client_reset(client);
 
+#if defined(CONFIG_MQTT_LIB_OUTBOX)
+	/* Unacknowledged messages are sent again on the next connection. */
+	outbox_requeue(client);
+#endif
+
 	if (notify) {
 		struct mqtt_evt evt = {
 			.type = MQTT_EVT_DISCONNECT,
@@ -167,6 +172,38 @@ static int client_write_msg(struct mqtt_client *client,
 	return 0;
 }
 
+#if defined(CONFIG_MQTT_LIB_OUTBOX)
+static int client_flush(struct mqtt_client *client)
+{
+	struct iovec io_vector[CONFIG_MQTT_OUTBOX_BATCH_SIZE];
+	struct msghdr msg;
+	int err_code;
+	int count;
+
+	while (true) {
+		count = outbox_prepare(client, io_vector,
+				       ARRAY_SIZE(io_vector));
+		if (count == 0) {
+			return 0;
+		}
+
+		NET_DBG("[%p]: Sending %d queued packets.", client, count);
+
+		memset(&msg, 0, sizeof(msg));
+
+		msg.msg_iov = io_vector;
+		msg.msg_iovlen = count;
+
+		err_code = client_write_msg(client, &msg);
+		if (err_code < 0) {
+			return err_code;
+		}
+
+		outbox_sent(client);
+	}
+}
+#endif /* CONFIG_MQTT_LIB_OUTBOX */
+
 void mqtt_client_init(struct mqtt_client *client)
 {
 	NULL_PARAM_CHECK_VOID(client);
@@ -287,6 +324,80 @@ error:
 	return err_code;
 }
 
+#if defined(CONFIG_MQTT_LIB_OUTBOX)
+int mqtt_publish_queued(struct mqtt_client *client,
+			const struct mqtt_publish_param *param)
+{
+	int err_code;
+
+	NULL_PARAM_CHECK(client);
+	NULL_PARAM_CHECK(param);
+
+	NET_DBG("[CID %p]:[State 0x%02x]: >> Message id 0x%04x, "
+		 "Data size 0x%08x", client, client->internal.state,
+		 param->message_id, param->message.payload.len);
+
+	mqtt_mutex_lock(client);
+
+	/* Messages can be queued while not connected, they are sent once
+	 * the connection is established.
+	 */
+	err_code = outbox_publish(client, param);
+	if (err_code < 0) {
+		goto error;
+	}
+
+	if (MQTT_HAS_STATE(client, MQTT_STATE_CONNECTED) &&
+	    client->internal.outbox_unsent >= CONFIG_MQTT_OUTBOX_BATCH_SIZE) {
+		err_code = client_flush(client);
+	}
+
+error:
+	NET_DBG("[CID %p]:[State 0x%02x]: << result 0x%08x",
+		 client, client->internal.state, err_code);
+
+	mqtt_mutex_unlock(client);
+
+	return err_code;
+}
+
+int mqtt_outbox_flush(struct mqtt_client *client)
+{
+	int err_code;
+
+	NULL_PARAM_CHECK(client);
+
+	mqtt_mutex_lock(client);
+
+	err_code = verify_tx_state(client);
+	if (err_code < 0) {
+		goto error;
+	}
+
+	err_code = client_flush(client);
+
+error:
+	mqtt_mutex_unlock(client);
+
+	return err_code;
+}
+
+int mqtt_outbox_count(struct mqtt_client *client)
+{
+	int count;
+
+	NULL_PARAM_CHECK(client);
+
+	mqtt_mutex_lock(client);
+
+	count = outbox_count(client);
+
+	mqtt_mutex_unlock(client);
+
+	return count;
+}
+#endif /* CONFIG_MQTT_LIB_OUTBOX */
+
 int mqtt_publish_qos1_ack(struct mqtt_client *client,
 			  const struct mqtt_puback_param *param)
 {
@@ -601,6 +712,16 @@ int mqtt_live(struct mqtt_client *client)
 
 	mqtt_mutex_lock(client);
 
+#if defined(CONFIG_MQTT_LIB_OUTBOX)
+	if (MQTT_HAS_STATE(client, MQTT_STATE_CONNECTED)) {
+		err_code = client_flush(client);
+		if (err_code < 0) {
+			mqtt_mutex_unlock(client);
+			return err_code;
+		}
+	}
+#endif
+
 	elapsed_time = mqtt_elapsed_time_in_ms_get(
 				client->internal.last_activity);
 	if ((client->keepalive > 0) &&
@@ -652,6 +773,13 @@ int mqtt_input(struct mqtt_client *client)
 		err_code = -ENOTCONN;
 	}
 
+#if defined(CONFIG_MQTT_LIB_OUTBOX)
+	/* Received acknowledgments may have opened the inflight window. */
+	if (err_code == 0 && MQTT_HAS_STATE(client, MQTT_STATE_CONNECTED)) {
+		err_code = client_flush(client);
+	}
+#endif
+
 	mqtt_mutex_unlock(client);
 
 	return err_code;
@@ -393,6 +393,63 @@ int subscribe_ack_decode(struct buf_ctx *buf,
 int unsubscribe_ack_decode(struct buf_ctx *buf,
 			   struct mqtt_unsuback_param *param);
 
+#if defined(CONFIG_MQTT_LIB_OUTBOX)
+/**@brief Encode a Publish packet and append it, with its payload, to the
+ *        client outbox.
+ *
+ * @param[in] client Client to queue the message for.
+ * @param[in] param Publish message parameters.
+ *
+ * @return 0 if the procedure is successful, an error code otherwise.
+ */
+int outbox_publish(struct mqtt_client *client,
+		   const struct mqtt_publish_param *param);
+
+/**@brief Select the next batch of outbox packets to be sent.
+ *
+ * The selected packets are marked as sent, the caller shall call
+ * outbox_sent() once they are written to the transport.
+ *
+ * @param[in] client Client to send the packets for.
+ * @param[out] iov Vector filled with the packets to send.
+ * @param[in] iov_max Maximum number of packets to select.
+ *
+ * @return Number of packets selected.
+ */
+int outbox_prepare(struct mqtt_client *client, struct iovec *iov,
+		   int iov_max);
+
+/**@brief Drop the QoS 0 packets written to the transport from the outbox.
+ *
+ * @param[in] client Client the packets were sent for.
+ */
+void outbox_sent(struct mqtt_client *client);
+
+/**@brief Mark all the outbox packets to be sent again, called when the
+ *        connection is lost.
+ *
+ * @param[in] client Client that lost the connection.
+ */
+void outbox_requeue(struct mqtt_client *client);
+
+/**@brief Process a Publish Ack, Receive or Complete packet received.
+ *
+ * @param[in] client Client the packet was received for.
+ * @param[in] type MQTT packet type.
+ * @param[in] message_id Message id of the acknowledged message.
+ */
+void outbox_ack(struct mqtt_client *client, uint8_t type,
+		uint16_t message_id);
+
+/**@brief Get the number of messages in the outbox.
+ *
+ * @param[in] client Client to get the message count for.
+ *
+ * @return Number of messages not sent or not acknowledged yet.
+ */
+int outbox_count(struct mqtt_client *client);
+#endif /* CONFIG_MQTT_LIB_OUTBOX */
+
 #ifdef __cplusplus
 }
 #endif
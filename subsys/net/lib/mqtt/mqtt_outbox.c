@@ -0,0 +1,342 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/** @file mqtt_outbox.c
+ *
+ * @brief MQTT outbound message queue.
+ *
+ * Queued packets are stored back to back in the outbox buffer provided by
+ * the application, in the order they were queued. Each packet is preceded
+ * by an entry header and padded to a word boundary.
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_mqtt_outbox, CONFIG_MQTT_LOG_LEVEL);
+
+#include <zephyr/sys/util.h>
+
+#include "mqtt_internal.h"
+#include "mqtt_os.h"
+
+enum outbox_state {
+	/** PUBLISH waiting to be sent. */
+	OUTBOX_PUBLISH_QUEUED,
+
+	/** PUBLISH sent, waiting for PUBACK or PUBREC. */
+	OUTBOX_PUBLISH_SENT,
+
+	/** PUBREC received, PUBREL waiting to be sent. */
+	OUTBOX_PUBREL_QUEUED,
+
+	/** PUBREL sent, waiting for PUBCOMP. */
+	OUTBOX_PUBREL_SENT,
+};
+
+struct outbox_entry {
+	/** Length of the encoded packet following the entry header. */
+	uint32_t len;
+
+	/** Message id of the publication. */
+	uint16_t message_id;
+
+	/** QoS of the publication. */
+	uint8_t qos;
+
+	/** Entry state, see enum outbox_state. */
+	uint8_t state;
+};
+
+#define ENTRY_SIZE(len) (sizeof(struct outbox_entry) + \
+			 ROUND_UP(len, sizeof(uint32_t)))
+
+static uint8_t *outbox_base(struct mqtt_client *client)
+{
+	return (uint8_t *)ROUND_UP(client->outbox_buf, sizeof(uint32_t));
+}
+
+static uint32_t outbox_size(struct mqtt_client *client)
+{
+	uint32_t offset = outbox_base(client) - client->outbox_buf;
+
+	if (client->outbox_buf == NULL || client->outbox_buf_size < offset) {
+		return 0;
+	}
+
+	return client->outbox_buf_size - offset;
+}
+
+static struct outbox_entry *entry_get(struct mqtt_client *client,
+				      uint32_t pos)
+{
+	return (struct outbox_entry *)(outbox_base(client) + pos);
+}
+
+static uint8_t *entry_data(struct outbox_entry *entry)
+{
+	return (uint8_t *)(entry + 1);
+}
+
+/* Change the size of the packet stored in an entry, moving the entries
+ * following it.
+ */
+static void entry_resize(struct mqtt_client *client,
+			 struct outbox_entry *entry, uint32_t len)
+{
+	uint8_t *next = (uint8_t *)entry + ENTRY_SIZE(entry->len);
+	uint8_t *end = outbox_base(client) + client->internal.outbox_len;
+	uint32_t old_size = ENTRY_SIZE(entry->len);
+
+	memmove((uint8_t *)entry + ENTRY_SIZE(len), next, end - next);
+
+	client->internal.outbox_len -= old_size - ENTRY_SIZE(len);
+	entry->len = len;
+}
+
+static void entry_remove(struct mqtt_client *client,
+			 struct outbox_entry *entry)
+{
+	uint8_t *next = (uint8_t *)entry + ENTRY_SIZE(entry->len);
+	uint8_t *end = outbox_base(client) + client->internal.outbox_len;
+
+	memmove(entry, next, end - next);
+
+	client->internal.outbox_len -= next - (uint8_t *)entry;
+}
+
+int outbox_publish(struct mqtt_client *client,
+		   const struct mqtt_publish_param *param)
+{
+	struct buf_ctx packet = {
+		.cur = client->tx_buf,
+		.end = client->tx_buf + client->tx_buf_size,
+	};
+	struct outbox_entry *entry;
+	uint32_t header_len;
+	uint32_t len;
+	int err_code;
+
+	if (client->tx_buf == NULL) {
+		return -ENOMEM;
+	}
+
+	err_code = publish_encode(param, &packet);
+	if (err_code < 0) {
+		return err_code;
+	}
+
+	header_len = packet.end - packet.cur;
+	len = header_len + param->message.payload.len;
+
+	if (ENTRY_SIZE(len) >
+	    outbox_size(client) - client->internal.outbox_len) {
+		NET_DBG("[CID %p]: Outbox full", client);
+		return -ENOMEM;
+	}
+
+	entry = entry_get(client, client->internal.outbox_len);
+	entry->len = len;
+	entry->message_id = param->message_id;
+	entry->qos = param->message.topic.qos;
+	entry->state = OUTBOX_PUBLISH_QUEUED;
+
+	memcpy(entry_data(entry), packet.cur, header_len);
+	memcpy(entry_data(entry) + header_len, param->message.payload.data,
+	       param->message.payload.len);
+
+	client->internal.outbox_len += ENTRY_SIZE(len);
+	client->internal.outbox_unsent++;
+
+	return 0;
+}
+
+int outbox_prepare(struct mqtt_client *client, struct iovec *iov,
+		   int iov_max)
+{
+	struct outbox_entry *entry;
+	bool publish_blocked = false;
+	int count = 0;
+	uint32_t pos;
+
+	for (pos = 0; pos < client->internal.outbox_len && count < iov_max;
+	     pos += ENTRY_SIZE(entry->len)) {
+		entry = entry_get(client, pos);
+
+		switch (entry->state) {
+		case OUTBOX_PUBLISH_QUEUED:
+			/* Keep the publication order, no message may overtake
+			 * one waiting for the inflight window to open.
+			 */
+			if (publish_blocked) {
+				continue;
+			}
+
+			if (entry->qos > MQTT_QOS_0_AT_MOST_ONCE) {
+				if (client->internal.outbox_inflight >=
+				    CONFIG_MQTT_OUTBOX_INFLIGHT_MAX) {
+					publish_blocked = true;
+					continue;
+				}
+
+				client->internal.outbox_inflight++;
+			}
+
+			entry->state = OUTBOX_PUBLISH_SENT;
+			break;
+
+		case OUTBOX_PUBREL_QUEUED:
+			entry->state = OUTBOX_PUBREL_SENT;
+			break;
+
+		default:
+			continue;
+		}
+
+		iov[count].iov_base = entry_data(entry);
+		iov[count].iov_len = entry->len;
+		count++;
+
+		client->internal.outbox_unsent--;
+	}
+
+	return count;
+}
+
+void outbox_sent(struct mqtt_client *client)
+{
+	struct outbox_entry *entry;
+	uint32_t pos = 0;
+
+	while (pos < client->internal.outbox_len) {
+		entry = entry_get(client, pos);
+
+		if (entry->qos == MQTT_QOS_0_AT_MOST_ONCE &&
+		    entry->state == OUTBOX_PUBLISH_SENT) {
+			entry_remove(client, entry);
+			continue;
+		}
+
+		pos += ENTRY_SIZE(entry->len);
+	}
+}
+
+void outbox_requeue(struct mqtt_client *client)
+{
+	struct outbox_entry *entry;
+	uint32_t pos;
+
+	client->internal.outbox_inflight = 0U;
+
+	for (pos = 0; pos < client->internal.outbox_len;
+	     pos += ENTRY_SIZE(entry->len)) {
+		entry = entry_get(client, pos);
+
+		switch (entry->state) {
+		case OUTBOX_PUBLISH_SENT:
+			if (entry->qos > MQTT_QOS_0_AT_MOST_ONCE) {
+				entry_data(entry)[0] |= MQTT_HEADER_DUP_MASK;
+			}
+
+			entry->state = OUTBOX_PUBLISH_QUEUED;
+			client->internal.outbox_unsent++;
+			break;
+
+		case OUTBOX_PUBREL_SENT:
+			entry->state = OUTBOX_PUBREL_QUEUED;
+			client->internal.outbox_unsent++;
+			__fallthrough;
+
+		case OUTBOX_PUBREL_QUEUED:
+			/* Still waiting for PUBCOMP. */
+			client->internal.outbox_inflight++;
+			break;
+
+		default:
+			break;
+		}
+	}
+
+	NET_DBG("[CID %p]: %d packets to retransmit", client,
+		client->internal.outbox_unsent);
+}
+
+static void entry_release(struct mqtt_client *client,
+			  struct outbox_entry *entry)
+{
+	struct mqtt_pubrel_param param = {
+		.message_id = entry->message_id,
+	};
+	uint8_t pubrel[MQTT_FIXED_HEADER_MAX_SIZE + sizeof(uint16_t)];
+	struct buf_ctx packet = {
+		.cur = pubrel,
+		.end = pubrel + sizeof(pubrel),
+	};
+
+	(void)publish_release_encode(&param, &packet);
+
+	/* The PUBLISH is not needed anymore, keep only the PUBREL. */
+	entry_resize(client, entry, packet.end - packet.cur);
+	memcpy(entry_data(entry), packet.cur, entry->len);
+
+	entry->state = OUTBOX_PUBREL_QUEUED;
+	client->internal.outbox_unsent++;
+}
+
+void outbox_ack(struct mqtt_client *client, uint8_t type,
+		uint16_t message_id)
+{
+	struct outbox_entry *entry;
+	uint32_t pos;
+
+	for (pos = 0; pos < client->internal.outbox_len;
+	     pos += ENTRY_SIZE(entry->len)) {
+		entry = entry_get(client, pos);
+
+		if (entry->message_id != message_id ||
+		    entry->qos == MQTT_QOS_0_AT_MOST_ONCE) {
+			continue;
+		}
+
+		if (type == MQTT_PKT_TYPE_PUBACK &&
+		    entry->qos == MQTT_QOS_1_AT_LEAST_ONCE &&
+		    entry->state == OUTBOX_PUBLISH_SENT) {
+			entry_remove(client, entry);
+			client->internal.outbox_inflight--;
+			return;
+		}
+
+		if (type == MQTT_PKT_TYPE_PUBREC &&
+		    entry->qos == MQTT_QOS_2_EXACTLY_ONCE &&
+		    entry->state == OUTBOX_PUBLISH_SENT) {
+			entry_release(client, entry);
+			return;
+		}
+
+		if (type == MQTT_PKT_TYPE_PUBCOMP &&
+		    entry->state == OUTBOX_PUBREL_SENT) {
+			entry_remove(client, entry);
+			client->internal.outbox_inflight--;
+			return;
+		}
+	}
+
+	NET_DBG("[CID %p]: Message id 0x%04x not in outbox", client,
+		message_id);
+}
+
+int outbox_count(struct mqtt_client *client)
+{
+	struct outbox_entry *entry;
+	uint32_t pos;
+	int count = 0;
+
+	for (pos = 0; pos < client->internal.outbox_len;
+	     pos += ENTRY_SIZE(entry->len)) {
+		entry = entry_get(client, pos);
+		count++;
+	}
+
+	return count;
+}
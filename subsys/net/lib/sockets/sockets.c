@@ -714,6 +714,14 @@ out:
 	return -1;
 }
 
+static inline bool udp_recv_registered(struct net_context *ctx)
+{
+	return net_context_get_ip_proto(ctx) == IPPROTO_UDP &&
+	       net_context_is_used(ctx) &&
+	       (ctx->flags & NET_CONTEXT_REMOTE_ADDR_SET) &&
+	       ctx->conn_handler != NULL && ctx->recv_cb == zsock_received_cb;
+}
+
 ssize_t zsock_sendto_ctx(struct net_context *ctx, const void *buf, size_t len,
 			 int flags,
 			 const struct sockaddr *dest_addr, socklen_t addrlen)
@@ -730,13 +738,18 @@ ssize_t zsock_sendto_ctx(struct net_context *ctx, const void *buf, size_t len,
 	}
 
 	/* Register the callback before sending in order to receive the response
-	 * from the peer.
+	 * from the peer. A connected UDP socket got it registered already in
+	 * bind() or connect(), and registering it again on every datagram
+	 * costs more than sending one.
 	 */
-	status = net_context_recv(ctx, zsock_received_cb,
-				  K_NO_WAIT, ctx->user_data);
-	if (status < 0) {
-		errno = -status;
-		return -1;
+	if (!IS_ENABLED(CONFIG_NET_UDP_FAST_PATH) || dest_addr ||
+	    !udp_recv_registered(ctx)) {
+		status = net_context_recv(ctx, zsock_received_cb,
+					  K_NO_WAIT, ctx->user_data);
+		if (status < 0) {
+			errno = -status;
+			return -1;
+		}
 	}
 
 	while (1) {
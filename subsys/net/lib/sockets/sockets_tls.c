@@ -186,6 +186,20 @@ __net_socket struct tls_context {
 	socklen_t dtls_peer_addrlen;
 #endif /* CONFIG_NET_SOCKETS_ENABLE_DTLS */
 
+#if defined(CONFIG_NET_SOCKETS_TLS_BATCH)
+	/** Information whether encrypted records are being batched. */
+	bool tx_batching;
+
+	/** Length of the encrypted records waiting in tx_batch. */
+	size_t tx_batch_len;
+
+	/** Encrypted records waiting to be sent. */
+	uint8_t tx_batch[CONFIG_NET_SOCKETS_TLS_BATCH_TX_BUF_LEN];
+
+	/** Plaintext gathered from short sendmsg() buffers. */
+	uint8_t tx_coalesce[CONFIG_NET_SOCKETS_TLS_BATCH_COALESCE_LEN];
+#endif /* CONFIG_NET_SOCKETS_TLS_BATCH */
+
 #if defined(CONFIG_MBEDTLS)
 	/** mbedTLS context. */
 	mbedtls_ssl_context ssl;
@@ -832,11 +846,57 @@ static int dtls_rx(void *ctx, unsigned char *buf, size_t len,
 }
 #endif /* CONFIG_NET_SOCKETS_ENABLE_DTLS */
 
+#if defined(CONFIG_NET_SOCKETS_TLS_BATCH)
+/* Send out the encrypted records collected in the batch buffer. Only used
+ * on blocking sockets, so a short send is simply retried.
+ */
+static int tls_tx_batch_flush(struct tls_context *ctx)
+{
+	size_t pos = 0;
+	ssize_t sent;
+
+	while (pos < ctx->tx_batch_len) {
+		sent = zsock_sendto(ctx->sock, ctx->tx_batch + pos,
+				    ctx->tx_batch_len - pos, ctx->flags,
+				    NULL, 0);
+		if (sent < 0) {
+			ctx->tx_batch_len = 0;
+			return -errno;
+		}
+
+		pos += sent;
+	}
+
+	ctx->tx_batch_len = 0;
+
+	return 0;
+}
+#endif /* CONFIG_NET_SOCKETS_TLS_BATCH */
+
 static int tls_tx(void *ctx, const unsigned char *buf, size_t len)
 {
 	struct tls_context *tls_ctx = ctx;
 	ssize_t sent;
 
+#if defined(CONFIG_NET_SOCKETS_TLS_BATCH)
+	if (tls_ctx->tx_batching) {
+		if (len > sizeof(tls_ctx->tx_batch) - tls_ctx->tx_batch_len &&
+		    tls_tx_batch_flush(tls_ctx) < 0) {
+			return MBEDTLS_ERR_NET_SEND_FAILED;
+		}
+
+		if (len <= sizeof(tls_ctx->tx_batch)) {
+			memcpy(tls_ctx->tx_batch + tls_ctx->tx_batch_len,
+			       buf, len);
+			tls_ctx->tx_batch_len += len;
+
+			return len;
+		}
+
+		/* Record does not fit the batch buffer, send it directly. */
+	}
+#endif /* CONFIG_NET_SOCKETS_TLS_BATCH */
+
 	sent = zsock_sendto(tls_ctx->sock, buf, len,
 			    tls_ctx->flags, NULL, 0);
 	if (sent < 0) {
@@ -1922,6 +1982,14 @@ error:
 	return -1;
 }
 
+static bool send_tls_would_block(int ret)
+{
+	return ret == MBEDTLS_ERR_SSL_WANT_READ ||
+	       ret == MBEDTLS_ERR_SSL_WANT_WRITE ||
+	       ret == MBEDTLS_ERR_SSL_ASYNC_IN_PROGRESS ||
+	       ret == MBEDTLS_ERR_SSL_CRYPTO_IN_PROGRESS;
+}
+
 static ssize_t send_tls(struct tls_context *ctx, const void *buf,
 			size_t len, int flags)
 {
@@ -1932,10 +2000,7 @@ static ssize_t send_tls(struct tls_context *ctx, const void *buf,
 		return ret;
 	}
 
-	if (ret == MBEDTLS_ERR_SSL_WANT_READ ||
-	    ret == MBEDTLS_ERR_SSL_WANT_WRITE ||
-	    ret == MBEDTLS_ERR_SSL_ASYNC_IN_PROGRESS ||
-	    ret ==  MBEDTLS_ERR_SSL_CRYPTO_IN_PROGRESS) {
+	if (send_tls_would_block(ret)) {
 		errno = EAGAIN;
 	} else {
 		(void)tls_mbedtls_reset(ctx);
@@ -1945,6 +2010,129 @@ static ssize_t send_tls(struct tls_context *ctx, const void *buf,
 	return -1;
 }
 
+#if defined(CONFIG_NET_SOCKETS_TLS_BATCH)
+static bool send_tls_can_batch(struct tls_context *ctx, int flags)
+{
+	int sock_flags;
+
+	/* Handshake messages must not be held back, as the peer has to
+	 * answer them before the handshake can continue.
+	 */
+	if (ctx->type != SOCK_STREAM || (flags & ZSOCK_MSG_DONTWAIT) ||
+	    !is_handshake_complete(ctx)) {
+		return false;
+	}
+
+	sock_flags = zsock_fcntl(ctx->sock, F_GETFL, 0);
+
+	return sock_flags != -1 && !(sock_flags & O_NONBLOCK);
+}
+
+/* Write the whole buffer, mbedtls_ssl_write() produces at most one record
+ * per call.
+ */
+static int send_tls_all(struct tls_context *ctx, const uint8_t *buf,
+			size_t len)
+{
+	int ret;
+
+	while (len > 0) {
+		ret = mbedtls_ssl_write(&ctx->ssl, buf, len);
+		if (ret < 0) {
+			return ret;
+		}
+
+		buf += ret;
+		len -= ret;
+	}
+
+	return 0;
+}
+
+static ssize_t send_tls_batched(struct tls_context *ctx,
+				const struct msghdr *msg)
+{
+	size_t pending = 0;
+	ssize_t len = 0;
+	int ret = 0;
+	int i;
+
+	ctx->tx_batching = true;
+
+	for (i = 0; i < msg->msg_iovlen; i++) {
+		const uint8_t *ptr = msg->msg_iov[i].iov_base;
+		size_t left = msg->msg_iov[i].iov_len;
+		size_t copy;
+
+		while (left > 0) {
+			/* Large buffers are encrypted directly, short ones
+			 * are gathered so that they share a record.
+			 */
+			if (pending == 0 && left >= sizeof(ctx->tx_coalesce)) {
+				ret = send_tls_all(ctx, ptr, left);
+				if (ret < 0) {
+					goto out;
+				}
+
+				len += left;
+				break;
+			}
+
+			copy = MIN(left, sizeof(ctx->tx_coalesce) - pending);
+			memcpy(ctx->tx_coalesce + pending, ptr, copy);
+			pending += copy;
+			ptr += copy;
+			left -= copy;
+
+			if (pending == sizeof(ctx->tx_coalesce)) {
+				ret = send_tls_all(ctx, ctx->tx_coalesce,
+						   pending);
+				if (ret < 0) {
+					goto out;
+				}
+
+				len += pending;
+				pending = 0;
+			}
+		}
+	}
+
+	if (pending > 0) {
+		ret = send_tls_all(ctx, ctx->tx_coalesce, pending);
+		if (ret == 0) {
+			len += pending;
+		}
+	}
+
+out:
+	ctx->tx_batching = false;
+
+	/* Records already accepted by mbedTLS must reach the socket even if
+	 * a later write failed, otherwise the TLS stream gets corrupted.
+	 */
+	if (tls_tx_batch_flush(ctx) < 0) {
+		ret = MBEDTLS_ERR_NET_SEND_FAILED;
+	}
+
+	if (ret == 0) {
+		return len;
+	}
+
+	if (send_tls_would_block(ret)) {
+		if (len > 0) {
+			return len;
+		}
+
+		errno = EAGAIN;
+	} else {
+		(void)tls_mbedtls_reset(ctx);
+		errno = EIO;
+	}
+
+	return -1;
+}
+#endif /* CONFIG_NET_SOCKETS_TLS_BATCH */
+
 #if defined(CONFIG_NET_SOCKETS_ENABLE_DTLS)
 static ssize_t sendto_dtls_client(struct tls_context *ctx, const void *buf,
 				  size_t len, int flags,
@@ -2032,6 +2220,23 @@ ssize_t ztls_sendto_ctx(struct tls_context *ctx, const void *buf, size_t len,
 
 	/* TLS */
 	if (ctx->type == SOCK_STREAM) {
+#if defined(CONFIG_NET_SOCKETS_TLS_BATCH)
+		/* A short buffer fits in a single record anyway. */
+		if (len > sizeof(ctx->tx_coalesce) &&
+		    send_tls_can_batch(ctx, flags)) {
+			struct iovec vec = {
+				.iov_base = (void *)buf,
+				.iov_len = len,
+			};
+			struct msghdr msg = {
+				.msg_iov = &vec,
+				.msg_iovlen = 1,
+			};
+
+			return send_tls_batched(ctx, &msg);
+		}
+#endif /* CONFIG_NET_SOCKETS_TLS_BATCH */
+
 		return send_tls(ctx, buf, len, flags);
 	}
 
@@ -2069,6 +2274,14 @@ ssize_t ztls_sendmsg_ctx(struct tls_context *ctx, const struct msghdr *msg,
 		}
 	}
 
+#if defined(CONFIG_NET_SOCKETS_TLS_BATCH)
+	if (msg && send_tls_can_batch(ctx, flags)) {
+		ctx->flags = flags;
+
+		return send_tls_batched(ctx, msg);
+	}
+#endif /* CONFIG_NET_SOCKETS_TLS_BATCH */
+
 	len = 0;
 	if (msg) {
 		for (i = 0; i < msg->msg_iovlen; i++) {
@@ -2102,6 +2315,7 @@ static ssize_t recv_tls(struct tls_context *ctx, void *buf,
 {
 	size_t recv_len = 0;
 	const bool waitall = flags & ZSOCK_MSG_WAITALL;
+	bool more = waitall;
 	int ret;
 
 	do {
@@ -2125,17 +2339,21 @@ static ssize_t recv_tls(struct tls_context *ctx, void *buf,
 				break;
 			}
 
+			/* Return the data already read, the error is
+			 * reported by the next call.
+			 */
+			if (recv_len > 0) {
+				break;
+			}
+
 			if (ret == MBEDTLS_ERR_SSL_WANT_READ ||
 			    ret == MBEDTLS_ERR_SSL_WANT_WRITE) {
-				if (recv_len > 0) {
-					break;
-				}
-
 				ret = -EAGAIN;
 			} else {
 				ret = -EIO;
 			}
 
+			ctx->flags = flags;
 			errno = -ret;
 			return -1;
 		}
@@ -2145,7 +2363,19 @@ static ssize_t recv_tls(struct tls_context *ctx, void *buf,
 		}
 
 		recv_len += ret;
-	} while (waitall && (recv_len < max_len));
+
+#if defined(CONFIG_NET_SOCKETS_TLS_BATCH)
+		/* Return the data of any further records that have already
+		 * arrived as well, but do not wait for new ones.
+		 */
+		if (!waitall) {
+			ctx->flags |= ZSOCK_MSG_DONTWAIT;
+			more = true;
+		}
+#endif /* CONFIG_NET_SOCKETS_TLS_BATCH */
+	} while (more && (recv_len < max_len));
+
+	ctx->flags = flags;
 
 	return recv_len;
 }
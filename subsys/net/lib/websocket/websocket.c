@@ -603,13 +603,89 @@ static int websocket_prepare_and_send(struct websocket_context *ctx,
 #endif /* CONFIG_NET_TEST */
 }
 
+/* Apply the masking key to len bytes of payload data that start at byte
+ * offset "pos" of the message. The data is XORed a word at a time once the
+ * destination is aligned. The source and destination may be the same buffer.
+ */
+static void websocket_mask_data(uint8_t *dst, const uint8_t *src, size_t len,
+				uint32_t masking_value, uint64_t pos)
+{
+	uint8_t key[sizeof(uint32_t)];
+	uint32_t word_mask;
+	size_t i = 0;
+
+	sys_put_be32(masking_value, key);
+
+	while (i < len && !IS_PTR_ALIGNED(&dst[i], uint32_t)) {
+		dst[i] = src[i] ^ key[(pos + i) % sizeof(key)];
+		i++;
+	}
+
+	if (len - i >= sizeof(uint32_t)) {
+		uint8_t rotated[sizeof(uint32_t)];
+		int j;
+
+		/* The key as it lines up with the aligned words */
+		for (j = 0; j < sizeof(rotated); j++) {
+			rotated[j] = key[(pos + i + j) % sizeof(key)];
+		}
+
+		memcpy(&word_mask, rotated, sizeof(word_mask));
+
+		for (; len - i >= sizeof(uint32_t); i += sizeof(uint32_t)) {
+			*(uint32_t *)&dst[i] =
+				UNALIGNED_GET((const uint32_t *)&src[i]) ^
+				word_mask;
+		}
+	}
+
+	for (; i < len; i++) {
+		dst[i] = src[i] ^ key[(pos + i) % sizeof(key)];
+	}
+}
+
+/* Mask the payload while sending it. The payload is masked in chunks into a
+ * small stack buffer so that the caller's data is neither modified nor copied
+ * to a heap allocated buffer. The header is sent together with the first
+ * chunk.
+ */
+static int websocket_prepare_and_send_masked(struct websocket_context *ctx,
+					     uint8_t *header, size_t header_len,
+					     const uint8_t *payload,
+					     size_t payload_len,
+					     int32_t timeout)
+{
+	uint8_t buf[CONFIG_WEBSOCKET_MASK_BUF_LEN] __aligned(sizeof(uint32_t));
+	size_t pos = 0;
+	int total = 0;
+	int ret;
+
+	do {
+		size_t chunk_len = MIN(payload_len - pos, sizeof(buf));
+
+		websocket_mask_data(buf, payload + pos, chunk_len,
+				    ctx->masking_value, pos);
+
+		ret = websocket_prepare_and_send(ctx, header, header_len,
+						 buf, chunk_len, timeout);
+		if (ret < 0) {
+			return ret;
+		}
+
+		total += ret;
+		pos += chunk_len;
+		header_len = 0;
+	} while (pos < payload_len);
+
+	return total;
+}
+
 int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
 		       enum websocket_opcode opcode, bool mask, bool final,
 		       int32_t timeout)
 {
 	struct websocket_context *ctx;
 	uint8_t header[MAX_HEADER_LEN], hdr_len = 2;
-	uint8_t *data_to_send = (uint8_t *)payload;
 	int ret;
 
 	if (opcode != WEBSOCKET_OPCODE_DATA_TEXT &&
@@ -673,38 +749,23 @@ int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
 
 	/* Add masking value if needed */
 	if (mask) {
-		int i;
-
 		ctx->masking_value = sys_rand32_get();
 
-		header[hdr_len++] |= ctx->masking_value >> 24;
-		header[hdr_len++] |= ctx->masking_value >> 16;
-		header[hdr_len++] |= ctx->masking_value >> 8;
-		header[hdr_len++] |= ctx->masking_value;
+		sys_put_be32(ctx->masking_value, &header[hdr_len]);
+		hdr_len += sizeof(uint32_t);
 
-		data_to_send = k_malloc(payload_len);
-		if (!data_to_send) {
-			return -ENOMEM;
-		}
-
-		memcpy(data_to_send, payload, payload_len);
-
-		for (i = 0; i < payload_len; i++) {
-			data_to_send[i] ^=
-				ctx->masking_value >> (8 * (3 - i % 4));
-		}
+		ret = websocket_prepare_and_send_masked(ctx, header, hdr_len,
+							payload, payload_len,
+							timeout);
+	} else {
+		ret = websocket_prepare_and_send(ctx, header, hdr_len,
+						 (uint8_t *)payload,
+						 payload_len, timeout);
 	}
 
-	ret = websocket_prepare_and_send(ctx, header, hdr_len,
-					 data_to_send, payload_len, timeout);
 	if (ret < 0) {
-		NET_DBG("Cannot send ws msg (%d)", -errno);
-		goto quit;
-	}
-
-quit:
-	if (data_to_send != payload) {
-		k_free(data_to_send);
+		NET_DBG("Cannot send ws msg (%d)", ret);
+		return ret;
 	}
 
 	return ret - hdr_len;
@@ -955,17 +1016,12 @@ int websocket_recv_msg(int ws_sock, uint8_t *buf, size_t buf_len,
 
 	/* Unmask the data */
 	if (ctx->masked) {
-		/* As we might have less than 4 received bytes, we must select
-		 * which byte from masking value to take. The mask_shift will
-		 * tell that.
+		/* As we might have less than 4 received bytes, the position
+		 * in the message selects which byte of the masking value is
+		 * applied first.
 		 */
-		int mask_shift = (ctx->total_read - recv_len) % sizeof(uint32_t);
-		int i;
-
-		for (i = 0; i < recv_len; i++) {
-			buf[i] ^= ctx->masking_value >>
-				(8 * (3 - (i + mask_shift) % 4));
-		}
+		websocket_mask_data(buf, buf, recv_len, ctx->masking_value,
+				    ctx->total_read - recv_len);
 	}
 
 #if HEXDUMP_RECV_PACKETS
@@ -162,6 +162,144 @@ static void uart_callback(const struct device *dev, void *user_data)
 }
 #endif /* CONFIG_SHELL_BACKEND_SERIAL_INTERRUPT_DRIVEN */
 
+#ifdef CONFIG_SHELL_BACKEND_SERIAL_ASYNC
+/* Send all data available in the TX ring buffer in one transfer. Called
+ * only by the context which set tx_busy.
+ */
+static void async_tx_start(const struct shell_uart *sh_uart)
+{
+	const struct device *dev = sh_uart->ctrl_blk->dev;
+	uint8_t *data;
+	uint32_t len;
+
+	do {
+		len = ring_buf_get_claim(sh_uart->tx_ringbuf, &data,
+					 sh_uart->tx_ringbuf->size);
+		if (len) {
+			if (uart_tx(dev, data, len, SYS_FOREVER_US) == 0) {
+				return;
+			}
+
+			/* Data cannot be sent, drop it. */
+			(void)ring_buf_get_finish(sh_uart->tx_ringbuf, len);
+			continue;
+		}
+
+		atomic_set(&sh_uart->ctrl_blk->tx_busy, 0);
+
+		/* Data may have been added before tx_busy was cleared. */
+	} while (!ring_buf_is_empty(sh_uart->tx_ringbuf) &&
+		 (atomic_set(&sh_uart->ctrl_blk->tx_busy, 1) == 0));
+}
+
+static void async_rx_handle(const struct shell_uart *sh_uart,
+			    const uint8_t *data, size_t len)
+{
+	uint32_t rd_len;
+
+	rd_len = ring_buf_put(sh_uart->rx_ringbuf, data, len);
+	if (rd_len < len) {
+		LOG_WRN("RX ring buffer full.");
+	}
+
+	if (rd_len > 0) {
+		sh_uart->ctrl_blk->handler(SHELL_TRANSPORT_EVT_RX_RDY,
+					   sh_uart->ctrl_blk->context);
+	}
+}
+
+static void async_rx_enable(const struct shell_uart *sh_uart)
+{
+	struct shell_uart_ctrl_blk *ctrl_blk = sh_uart->ctrl_blk;
+	int err;
+
+	ctrl_blk->rx_buf_idx = 1;
+	err = uart_rx_enable(ctrl_blk->dev, ctrl_blk->rx_buf[0],
+			     sizeof(ctrl_blk->rx_buf[0]),
+			     CONFIG_SHELL_BACKEND_SERIAL_ASYNC_RX_TIMEOUT);
+	if (err < 0) {
+		LOG_ERR("Failed to enable RX (%d)", err);
+	}
+}
+
+static void uart_async_callback(const struct device *dev,
+				struct uart_event *evt, void *user_data)
+{
+	const struct shell_uart *sh_uart = (struct shell_uart *)user_data;
+	struct shell_uart_ctrl_blk *ctrl_blk = sh_uart->ctrl_blk;
+
+	switch (evt->type) {
+	case UART_TX_DONE:
+	case UART_TX_ABORTED:
+		(void)ring_buf_get_finish(sh_uart->tx_ringbuf,
+					  evt->data.tx.len);
+		if (!ctrl_blk->blocking_tx && !ctrl_blk->stopping) {
+			async_tx_start(sh_uart);
+		}
+
+		ctrl_blk->handler(SHELL_TRANSPORT_EVT_TX_RDY,
+				  ctrl_blk->context);
+		break;
+	case UART_RX_RDY:
+		async_rx_handle(sh_uart,
+				&evt->data.rx.buf[evt->data.rx.offset],
+				evt->data.rx.len);
+		break;
+	case UART_RX_BUF_REQUEST:
+		(void)uart_rx_buf_rsp(dev, ctrl_blk->rx_buf[ctrl_blk->rx_buf_idx],
+				      sizeof(ctrl_blk->rx_buf[0]));
+		ctrl_blk->rx_buf_idx ^= 1;
+		break;
+	case UART_RX_STOPPED:
+		ctrl_blk->rx_error = true;
+		break;
+	case UART_RX_DISABLED:
+		/* Start again if stopped after a receive error but not when
+		 * disabled by uninit().
+		 */
+		if (ctrl_blk->rx_error && !ctrl_blk->stopping) {
+			ctrl_blk->rx_error = false;
+			async_rx_enable(sh_uart);
+		}
+		break;
+	default:
+		break;
+	}
+}
+
+static void async_write(const struct shell_uart *sh_uart, const void *data,
+			size_t length, size_t *cnt)
+{
+	*cnt = ring_buf_put(sh_uart->tx_ringbuf, data, length);
+
+	if (atomic_set(&sh_uart->ctrl_blk->tx_busy, 1) == 0) {
+		async_tx_start(sh_uart);
+	}
+}
+#endif /* CONFIG_SHELL_BACKEND_SERIAL_ASYNC */
+
+static void uart_async_init(const struct shell_uart *sh_uart)
+{
+#ifdef CONFIG_SHELL_BACKEND_SERIAL_ASYNC
+	const struct device *dev = sh_uart->ctrl_blk->dev;
+	int err;
+
+	ring_buf_reset(sh_uart->tx_ringbuf);
+	ring_buf_reset(sh_uart->rx_ringbuf);
+	sh_uart->ctrl_blk->tx_busy = 0;
+	sh_uart->ctrl_blk->rx_error = false;
+	sh_uart->ctrl_blk->stopping = false;
+
+	err = uart_callback_set(dev, uart_async_callback, (void *)sh_uart);
+	if (err < 0) {
+		LOG_ERR("Failed to set callback (%d)", err);
+		return;
+	}
+
+	async_rx_enable(sh_uart);
+#endif
+}
+
 static void uart_irq_init(const struct shell_uart *sh_uart)
 {
 #ifdef CONFIG_SHELL_BACKEND_SERIAL_INTERRUPT_DRIVEN
@@ -206,7 +344,9 @@ static int init(const struct shell_transport *transport,
 	k_fifo_init(&sh_uart->ctrl_blk->smp.buf_ready);
 #endif
 
-	if (IS_ENABLED(CONFIG_SHELL_BACKEND_SERIAL_INTERRUPT_DRIVEN)) {
+	if (IS_ENABLED(CONFIG_SHELL_BACKEND_SERIAL_ASYNC)) {
+		uart_async_init(sh_uart);
+	} else if (IS_ENABLED(CONFIG_SHELL_BACKEND_SERIAL_INTERRUPT_DRIVEN)) {
 		uart_irq_init(sh_uart);
 	} else {
 		k_timer_init(sh_uart->timer, timer_handler, NULL);
@@ -221,7 +361,15 @@ static int uninit(const struct shell_transport *transport)
 {
 	const struct shell_uart *sh_uart = (struct shell_uart *)transport->ctx;
 
-	if (IS_ENABLED(CONFIG_SHELL_BACKEND_SERIAL_INTERRUPT_DRIVEN)) {
+	if (IS_ENABLED(CONFIG_SHELL_BACKEND_SERIAL_ASYNC)) {
+#ifdef CONFIG_SHELL_BACKEND_SERIAL_ASYNC
+		const struct device *dev = sh_uart->ctrl_blk->dev;
+
+		sh_uart->ctrl_blk->stopping = true;
+		(void)uart_tx_abort(dev);
+		(void)uart_rx_disable(dev);
+#endif
+	} else if (IS_ENABLED(CONFIG_SHELL_BACKEND_SERIAL_INTERRUPT_DRIVEN)) {
 		const struct device *dev = sh_uart->ctrl_blk->dev;
 
 		uart_irq_tx_disable(dev);
@@ -242,6 +390,9 @@ static int enable(const struct shell_transport *transport, bool blocking_tx)
 	if (blocking_tx) {
 #ifdef CONFIG_SHELL_BACKEND_SERIAL_INTERRUPT_DRIVEN
 		uart_irq_tx_disable(sh_uart->ctrl_blk->dev);
+#endif
+#ifdef CONFIG_SHELL_BACKEND_SERIAL_ASYNC
+		(void)uart_tx_abort(sh_uart->ctrl_blk->dev);
 #endif
 	}
 
@@ -266,7 +417,12 @@ static int write(const struct shell_transport *transport,
 	const struct shell_uart *sh_uart = (struct shell_uart *)transport->ctx;
 	const uint8_t *data8 = (const uint8_t *)data;
 
-	if (IS_ENABLED(CONFIG_SHELL_BACKEND_SERIAL_INTERRUPT_DRIVEN) &&
+	if (IS_ENABLED(CONFIG_SHELL_BACKEND_SERIAL_ASYNC) &&
+		!sh_uart->ctrl_blk->blocking_tx) {
+#ifdef CONFIG_SHELL_BACKEND_SERIAL_ASYNC
+		async_write(sh_uart, data, length, cnt);
+#endif
+	} else if (IS_ENABLED(CONFIG_SHELL_BACKEND_SERIAL_INTERRUPT_DRIVEN) &&
 		!sh_uart->ctrl_blk->blocking_tx) {
 		irq_write(sh_uart, data, length, cnt);
 	} else {
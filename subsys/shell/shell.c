@@ -320,37 +320,6 @@ static inline bool is_completion_candidate(const char *candidate,
 	return (strncmp(candidate, str, len) == 0) ? true : false;
 }
 
-static void find_completion_candidates(const struct shell *shell,
-				       const struct shell_static_entry *cmd,
-				       const char *incompl_cmd,
-				       size_t *first_idx, size_t *cnt,
-				       uint16_t *longest)
-{
-	const struct shell_static_entry *candidate;
-	struct shell_static_entry dloc;
-	size_t incompl_cmd_len;
-	size_t idx = 0;
-
-	incompl_cmd_len = z_shell_strlen(incompl_cmd);
-	*longest = 0U;
-	*cnt = 0;
-
-	while ((candidate = z_shell_cmd_get(cmd, idx, &dloc)) != NULL) {
-		bool is_candidate;
-		is_candidate = is_completion_candidate(candidate->syntax,
-						incompl_cmd, incompl_cmd_len);
-		if (is_candidate) {
-			*longest = Z_MAX(strlen(candidate->syntax), *longest);
-			if (*cnt == 0) {
-				*first_idx = idx;
-			}
-			(*cnt)++;
-		}
-
-		idx++;
-	}
-}
-
 static void autocomplete(const struct shell *shell,
 			 const struct shell_static_entry *cmd,
 			 const char *arg,
@@ -809,8 +778,8 @@ static void tab_handle(const struct shell *shell)
 		return;
 	}
 
-	find_completion_candidates(shell, cmd, argv[arg_idx], &first, &cnt,
-				   &longest);
+	z_shell_find_completion_candidates(cmd, argv[arg_idx], &first, &cnt,
+					   &longest);
 
 	if (cnt == 1) {
 		/* Autocompletion.*/
@@ -1203,6 +1172,7 @@ static int instance_init(const struct shell *sh,
 
 	if (IS_ENABLED(CONFIG_SHELL_STATS)) {
 		sh->stats->log_lost_cnt = 0;
+		sh->stats->tx_dropped_cnt = 0;
 	}
 
 	z_flag_tx_rdy_set(sh, true);
@@ -311,6 +311,8 @@ static int cmd_shell_stats_show(const struct shell *shell, size_t argc,
 	ARG_UNUSED(argv);
 
 	shell_print(shell, "Lost logs: %lu", shell->stats->log_lost_cnt);
+	shell_print(shell, "Dropped output bytes: %lu",
+		    shell->stats->tx_dropped_cnt);
 
 	return 0;
 }
@@ -322,6 +324,7 @@ static int cmd_shell_stats_reset(const struct shell *shell,
 	ARG_UNUSED(argv);
 
 	shell->stats->log_lost_cnt = 0;
+	shell->stats->tx_dropped_cnt = 0;
 
 	return 0;
 }
@@ -7,25 +7,49 @@
 #include <zephyr/shell/shell_fprintf.h>
 #include <zephyr/shell/shell.h>
 #include <zephyr/sys/cbprintf.h>
+#include <string.h>
 
-static int out_func(int c, void *ctx)
+static void buffer_put(const struct shell_fprintf *sh_fprintf,
+		       const char *str, size_t len)
+{
+	size_t cnt;
+
+	while (len > 0) {
+		cnt = MIN(len, sh_fprintf->buffer_size -
+			       sh_fprintf->ctrl_blk->buffer_cnt);
+		memcpy(&sh_fprintf->buffer[sh_fprintf->ctrl_blk->buffer_cnt],
+		       str, cnt);
+		sh_fprintf->ctrl_blk->buffer_cnt += cnt;
+
+		if (sh_fprintf->ctrl_blk->buffer_cnt ==
+		    sh_fprintf->buffer_size) {
+			z_shell_fprintf_buffer_flush(sh_fprintf);
+		}
+
+		str += cnt;
+		len -= cnt;
+	}
+}
+
+static int out_func(const char *str, size_t len, void *ctx)
 {
 	const struct shell_fprintf *sh_fprintf;
 	const struct shell *shell;
+	const char *nl;
 
 	sh_fprintf = (const struct shell_fprintf *)ctx;
 	shell = (const struct shell *)sh_fprintf->user_ctx;
 
-	if ((shell->shell_flag == SHELL_FLAG_OLF_CRLF) && (c == '\n')) {
-		(void)out_func('\r', ctx);
+	if (shell->shell_flag == SHELL_FLAG_OLF_CRLF) {
+		while ((nl = memchr(str, '\n', len)) != NULL) {
+			buffer_put(sh_fprintf, str, nl - str);
+			buffer_put(sh_fprintf, "\r\n", 2);
+			len -= nl - str + 1;
+			str = nl + 1;
+		}
 	}
 
-	sh_fprintf->buffer[sh_fprintf->ctrl_blk->buffer_cnt] = (uint8_t)c;
-	sh_fprintf->ctrl_blk->buffer_cnt++;
-
-	if (sh_fprintf->ctrl_blk->buffer_cnt == sh_fprintf->buffer_size) {
-		z_shell_fprintf_buffer_flush(sh_fprintf);
-	}
+	buffer_put(sh_fprintf, str, len);
 
 	return 0;
 }
@@ -33,7 +57,7 @@ static int out_func(int c, void *ctx)
 void z_shell_fprintf_fmt(const struct shell_fprintf *sh_fprintf,
 			 const char *fmt, va_list args)
 {
-	(void)cbvprintf(out_func, (void *)sh_fprintf, fmt, args);
+	(void)cbvprintf_str(out_func, (void *)sh_fprintf, fmt, args);
 
 	if (sh_fprintf->ctrl_blk->autoflush) {
 		z_shell_fprintf_buffer_flush(sh_fprintf);
@@ -386,11 +386,18 @@ static void shell_pend_on_txdone(const struct shell *shell)
 	    (shell->ctx->state < SHELL_STATE_PANIC_MODE_ACTIVE)) {
 		struct k_poll_event event;
 
+#if defined(CONFIG_SHELL_TX_DROP)
+		/* Wake up to check if the transport is stalled. */
+		k_timeout_t timeout = K_MSEC(CONFIG_SHELL_TX_DROP_TIMEOUT);
+#else
+		k_timeout_t timeout = K_FOREVER;
+#endif
+
 		k_poll_event_init(&event,
 				  K_POLL_TYPE_SIGNAL,
 				  K_POLL_MODE_NOTIFY_ONLY,
 				  &shell->ctx->signals[SHELL_SIGNAL_TXDONE]);
-		k_poll(&event, 1, K_FOREVER);
+		k_poll(&event, 1, timeout);
 		k_poll_signal_reset(&shell->ctx->signals[SHELL_SIGNAL_TXDONE]);
 	} else {
 		/* Blocking wait in case of bare metal. */
@@ -400,6 +407,31 @@ static void shell_pend_on_txdone(const struct shell *shell)
 	}
 }
 
+/* Function returns true if output shall be dropped because the transport
+ * has not accepted any data for CONFIG_SHELL_TX_DROP_TIMEOUT.
+ */
+static bool tx_stalled(const struct shell *shell, int64_t *stall_start)
+{
+#if defined(CONFIG_SHELL_TX_DROP)
+	/* Transport was already found stalled, do not wait again. */
+	if (z_flag_tx_drop_get(shell)) {
+		return true;
+	}
+
+	if (*stall_start < 0) {
+		*stall_start = k_uptime_get();
+		return false;
+	}
+
+	if ((k_uptime_get() - *stall_start) >= CONFIG_SHELL_TX_DROP_TIMEOUT) {
+		z_flag_tx_drop_set(shell, true);
+		return true;
+	}
+#endif
+
+	return false;
+}
+
 void z_shell_write(const struct shell *shell, const void *data,
 		 size_t length)
 {
@@ -407,6 +439,7 @@ void z_shell_write(const struct shell *shell, const void *data,
 
 	size_t offset = 0;
 	size_t tmp_cnt;
+	int64_t stall_start = -1;
 
 	while (length) {
 		int err = shell->iface->api->write(shell->iface,
@@ -417,8 +450,23 @@ void z_shell_write(const struct shell *shell, const void *data,
 		__ASSERT_NO_MSG(length >= tmp_cnt);
 		offset += tmp_cnt;
 		length -= tmp_cnt;
+
+		if (IS_ENABLED(CONFIG_SHELL_TX_DROP) && (tmp_cnt > 0)) {
+			z_flag_tx_drop_set(shell, false);
+			stall_start = -1;
+		}
+
 		if (tmp_cnt == 0 &&
 		    (shell->ctx->state != SHELL_STATE_PANIC_MODE_ACTIVE)) {
+			if (tx_stalled(shell, &stall_start)) {
+				if (IS_ENABLED(CONFIG_SHELL_STATS) &&
+				    (shell->stats != NULL)) {
+					atomic_add(&shell->stats->tx_dropped_cnt,
+						   length);
+				}
+				return;
+			}
+
 			shell_pend_on_txdone(shell);
 		}
 	}
@@ -203,6 +203,19 @@ static inline bool z_flag_print_noinit_set(const struct shell *sh, bool val)
 	return ret;
 }
 
+static inline bool z_flag_tx_drop_get(const struct shell *sh)
+{
+	return sh->ctx->ctx.flags.tx_drop == 1;
+}
+
+static inline bool z_flag_tx_drop_set(const struct shell *sh, bool val)
+{
+	bool ret;
+
+	Z_SHELL_SET_FLAG_ATOMIC(sh, ctx, tx_drop, val, ret);
+	return ret;
+}
+
 static inline bool z_flag_sync_mode_get(const struct shell *sh)
 {
 	return sh->ctx->ctx.flags.sync_mode == 1;
@@ -264,12 +264,116 @@ static inline uint32_t shell_root_cmd_count(void)
 				sizeof(union shell_cmd_entry);
 }
 
+/* Root commands are placed in a memory section sorted by the section name
+ * which ends with the command syntax (see SHELL_CMD_ARG_REGISTER), so they
+ * are in alphabetical order. The order is verified once in case the linker
+ * did not sort the section, lookup falls back to linear search then.
+ */
+static int8_t root_cmds_sorted = -1;
+
+bool z_shell_root_cmds_sorted(void)
+{
+	if (root_cmds_sorted < 0) {
+		const size_t cmd_count = shell_root_cmd_count();
+
+		root_cmds_sorted = 1;
+		for (size_t cmd_idx = 1; cmd_idx < cmd_count; ++cmd_idx) {
+			if (strcmp(shell_root_cmd_get(cmd_idx - 1)->entry->syntax,
+				   shell_root_cmd_get(cmd_idx)->entry->syntax) > 0) {
+				root_cmds_sorted = 0;
+				break;
+			}
+		}
+	}
+
+	return root_cmds_sorted == 1;
+}
+
+#if defined(CONFIG_ZTEST)
+void z_shell_root_cmds_sorted_set(bool sorted)
+{
+	root_cmds_sorted = sorted ? 1 : 0;
+}
+#endif
+
+size_t z_shell_root_cmd_lower_bound(const char *str, size_t len)
+{
+	size_t first = 0;
+	size_t last = shell_root_cmd_count();
+
+	while (first < last) {
+		size_t mid = first + (last - first) / 2;
+
+		if (strncmp(shell_root_cmd_get(mid)->entry->syntax,
+			    str, len) < 0) {
+			first = mid + 1;
+		} else {
+			last = mid;
+		}
+	}
+
+	return first;
+}
+
+void z_shell_find_completion_candidates(const struct shell_static_entry *cmd,
+					const char *incompl_cmd,
+					size_t *first_idx, size_t *cnt,
+					uint16_t *longest)
+{
+	const struct shell_static_entry *candidate;
+	struct shell_static_entry dloc;
+	size_t incompl_cmd_len;
+	size_t idx = 0;
+	bool sorted;
+
+	incompl_cmd_len = z_shell_strlen(incompl_cmd);
+	*longest = 0U;
+	*cnt = 0;
+
+	/* Sorted root commands matching the prefix are adjacent. */
+	sorted = (cmd == NULL) && z_shell_root_cmds_sorted();
+	if (sorted && (incompl_cmd_len > 0)) {
+		idx = z_shell_root_cmd_lower_bound(incompl_cmd,
+						   incompl_cmd_len);
+	}
+
+	while ((candidate = z_shell_cmd_get(cmd, idx, &dloc)) != NULL) {
+		if (strncmp(candidate->syntax, incompl_cmd,
+			    incompl_cmd_len) == 0) {
+			*longest = Z_MAX(strlen(candidate->syntax), *longest);
+			if (*cnt == 0) {
+				*first_idx = idx;
+			}
+			(*cnt)++;
+		} else if (sorted) {
+			break;
+		}
+
+		idx++;
+	}
+}
+
 /* Function returning pointer to parent command matching requested syntax. */
 const struct shell_static_entry *root_cmd_find(const char *syntax)
 {
 	const size_t cmd_count = shell_root_cmd_count();
 	const union shell_cmd_entry *cmd;
 
+	if (z_shell_root_cmds_sorted()) {
+		/* Comparing the terminating null finds the exact match. */
+		size_t cmd_idx = z_shell_root_cmd_lower_bound(syntax,
+							      strlen(syntax) + 1);
+
+		if (cmd_idx < cmd_count) {
+			cmd = shell_root_cmd_get(cmd_idx);
+			if (strcmp(syntax, cmd->entry->syntax) == 0) {
+				return cmd->entry;
+			}
+		}
+
+		return NULL;
+	}
+
 	for (size_t cmd_idx = 0; cmd_idx < cmd_count; ++cmd_idx) {
 		cmd = shell_root_cmd_get(cmd_idx);
 		if (strcmp(syntax, cmd->entry->syntax) == 0) {
@@ -350,6 +454,8 @@ const struct shell_static_entry *z_shell_find_cmd(
 	if (parent) {
 		memcpy(&parent_cpy, parent, sizeof(struct shell_static_entry));
 		parent = &parent_cpy;
+	} else {
+		return root_cmd_find(cmd_str);
 	}
 
 	while ((entry = z_shell_cmd_get(parent, idx++, dloc)) != NULL) {
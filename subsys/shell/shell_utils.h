@@ -83,6 +83,54 @@ void z_shell_cmd_trim(const struct shell *shell);
 
 const struct shell_static_entry *root_cmd_find(const char *syntax);
 
+/* @internal @brief Check if root commands are in alphabetical order.
+ *
+ * @return True if root commands can be searched with
+ *	   @ref z_shell_root_cmd_lower_bound.
+ */
+bool z_shell_root_cmds_sorted(void);
+
+/* @internal @brief Find first root command not lower than given string.
+ *
+ * Root commands must be sorted, see @ref z_shell_root_cmds_sorted.
+ *
+ * @param str	String compared with command syntax.
+ * @param len	Number of characters compared, length of the prefix when
+ *		looking for completion candidates.
+ *
+ * @return Index of the command or number of root commands if all commands
+ *	   are lower.
+ */
+size_t z_shell_root_cmd_lower_bound(const char *str, size_t len);
+
+#if defined(CONFIG_ZTEST)
+/* @internal @brief Override the result of @ref z_shell_root_cmds_sorted.
+ *
+ * Lets tests run the linear search used when root commands are not sorted.
+ *
+ * @param sorted	Value returned by @ref z_shell_root_cmds_sorted.
+ */
+void z_shell_root_cmds_sorted_set(bool sorted);
+#endif
+
+/* @internal @brief Find completion candidates for an incomplete command.
+ *
+ * At the root level the search starts at the first command not lower than
+ * the incomplete command and stops at the first one not matching it, when
+ * root commands are sorted. Other levels are searched linearly.
+ *
+ * @param cmd		Parent command, NULL for root commands.
+ * @param incompl_cmd	Incomplete command.
+ * @param first_idx	Index of the first candidate. Not changed if there are
+ *			no candidates.
+ * @param cnt		Number of candidates.
+ * @param longest	Length of the longest candidate.
+ */
+void z_shell_find_completion_candidates(const struct shell_static_entry *cmd,
+					const char *incompl_cmd,
+					size_t *first_idx, size_t *cnt,
+					uint16_t *longest);
+
 static inline void z_transport_buffer_flush(const struct shell *shell)
 {
 	z_shell_fprintf_buffer_flush(shell->fprintf_ctx);
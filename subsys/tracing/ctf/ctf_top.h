@@ -10,6 +10,8 @@
 #include <stddef.h>
 #include <string.h>
 #include <ctf_map.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/tracing/tracing_filter.h>
 #include <zephyr/tracing/tracing_format.h>
 
 /* Limit strings to 20 bytes to optimize bandwidth */
@@ -41,16 +43,26 @@
 		tracing_format_raw_data(epacket, sizeof(epacket));              \
 	}
 
+/*
+ * Check the runtime filter, the first field of an event is its ID.
+ */
+#ifdef CONFIG_TRACING_FILTER
+#define CTF_EVENT_ENABLED(...)                                                 \
+	tracing_filter_event_is_enabled(GET_ARG_N(1, __VA_ARGS__))
+#else
+#define CTF_EVENT_ENABLED(...) true
+#endif
+
 #ifdef CONFIG_TRACING_CTF_TIMESTAMP
 #define CTF_EVENT(...)                                                         \
-	{                                                                      \
+	if (CTF_EVENT_ENABLED(__VA_ARGS__)) {                                  \
 		const uint32_t tstamp = k_cyc_to_ns_floor64(k_cycle_get_32()); \
 									       \
 		CTF_GATHER_FIELDS(tstamp, __VA_ARGS__)                         \
 	}
 #else
 #define CTF_EVENT(...)                                                         \
-	{                                                                      \
+	if (CTF_EVENT_ENABLED(__VA_ARGS__)) {                                  \
 		CTF_GATHER_FIELDS(__VA_ARGS__)                                 \
 	}
 #endif
@@ -513,6 +513,16 @@ void sys_trace_syscall_exit(uint32_t syscall_id, const char *syscall_name)
 	TRACING_STRING("%s: %s (%u) exit\n", __func__, syscall_name, syscall_id);
 }
 
+void sys_trace_k_thread_foreach_enter(k_thread_user_cb_t user_cb, void *data)
+{
+	TRACING_STRING("%s: %p (%p) enter\n", __func__, user_cb, data);
+}
+
+void sys_trace_k_thread_foreach_exit(k_thread_user_cb_t user_cb, void *data)
+{
+	TRACING_STRING("%s: %p (%p) exit\n", __func__, user_cb, data);
+}
+
 void sys_trace_k_thread_foreach_unlocked_enter(k_thread_user_cb_t user_cb, void *data)
 {
 	TRACING_STRING("%s: %p (%p) enter\n", __func__, user_cb, data);
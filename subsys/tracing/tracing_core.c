@@ -17,9 +17,11 @@
 #include <tracing_core.h>
 #include <tracing_buffer.h>
 #include <tracing_backend.h>
+#include <zephyr/tracing/tracing_filter.h>
 
 #define TRACING_CMD_ENABLE  "enable"
 #define TRACING_CMD_DISABLE "disable"
+#define TRACING_CMD_FILTER  "filter"
 
 #ifdef CONFIG_TRACING_BACKEND_UART
 #define TRACING_BACKEND_NAME "tracing_backend_uart"
@@ -141,12 +143,49 @@ bool is_tracing_enabled(void)
 	return atomic_get(&tracing_state) == TRACING_ENABLE;
 }
 
+#define TRACING_CMD_ARGS_MAX 4
+
+/* Split "filter <command> [args]" into words for the filter. */
+static void tracing_cmd_filter(uint8_t *buf, uint32_t length)
+{
+	char cmd[CONFIG_TRACING_CMD_BUFFER_SIZE];
+	char *argv[TRACING_CMD_ARGS_MAX];
+	size_t argc = 0;
+	char *pos = cmd;
+
+	length = MIN(length, sizeof(cmd) - 1);
+	memcpy(cmd, buf, length);
+	cmd[length] = '\0';
+
+	while (*pos != '\0') {
+		if (*pos == ' ') {
+			*pos++ = '\0';
+			continue;
+		}
+
+		if (argc == ARRAY_SIZE(argv)) {
+			return;
+		}
+
+		argv[argc++] = pos;
+		while (*pos != '\0' && *pos != ' ') {
+			pos++;
+		}
+	}
+
+	if (argc > 1 && strcmp(argv[0], TRACING_CMD_FILTER) == 0) {
+		(void)tracing_filter_cmd(argc - 1, &argv[1]);
+	}
+}
+
 void tracing_cmd_handle(uint8_t *buf, uint32_t length)
 {
 	if (strncmp(buf, TRACING_CMD_ENABLE, length) == 0) {
 		tracing_set_state(TRACING_ENABLE);
 	} else if (strncmp(buf, TRACING_CMD_DISABLE, length) == 0) {
 		tracing_set_state(TRACING_DISABLE);
+	} else if (IS_ENABLED(CONFIG_TRACING_FILTER)) {
+		tracing_cmd_filter(buf, length);
 	}
 }
 
@@ -0,0 +1,444 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Disable syscall tracing for all calls from this compilation unit, the
+ * filter is checked from the tracing hooks.
+ */
+#define DISABLE_SYSCALL_TRACING
+
+#include <zephyr/kernel.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/tracing/tracing_filter.h>
+#include <stdlib.h>
+#include <string.h>
+
+atomic_t z_tracing_filter;
+ATOMIC_DEFINE(z_tracing_filter_events, 256);
+
+static struct k_spinlock lock;
+static struct k_thread *threads[CONFIG_TRACING_FILTER_THREADS];
+static size_t threads_cnt;
+static uint16_t ratios[TRACING_FILTER_TYPE_COUNT];
+
+static const char *const type_names[] = {
+	[TRACING_FILTER_TYPE_THREAD] = "thread",
+	[TRACING_FILTER_TYPE_WORK] = "work",
+	[TRACING_FILTER_TYPE_POLL] = "poll",
+	[TRACING_FILTER_TYPE_SEMAPHORE] = "sem",
+	[TRACING_FILTER_TYPE_MUTEX] = "mutex",
+	[TRACING_FILTER_TYPE_CONDVAR] = "condvar",
+	[TRACING_FILTER_TYPE_QUEUE] = "queue",
+	[TRACING_FILTER_TYPE_FIFO] = "fifo",
+	[TRACING_FILTER_TYPE_LIFO] = "lifo",
+	[TRACING_FILTER_TYPE_STACK] = "stack",
+	[TRACING_FILTER_TYPE_MSGQ] = "msgq",
+	[TRACING_FILTER_TYPE_MBOX] = "mbox",
+	[TRACING_FILTER_TYPE_PIPE] = "pipe",
+	[TRACING_FILTER_TYPE_HEAP] = "heap",
+	[TRACING_FILTER_TYPE_MEM_SLAB] = "mem_slab",
+	[TRACING_FILTER_TYPE_TIMER] = "timer",
+	[TRACING_FILTER_TYPE_EVENT] = "event",
+	[TRACING_FILTER_TYPE_PM] = "pm",
+};
+
+BUILD_ASSERT(ARRAY_SIZE(type_names) == TRACING_FILTER_TYPE_COUNT,
+	     "Missing type names");
+
+static bool type_is_valid(enum tracing_filter_type type)
+{
+	return (unsigned int)type < TRACING_FILTER_TYPE_COUNT;
+}
+
+static bool thread_pass(enum tracing_filter_type type)
+{
+	struct k_thread *current;
+
+	/* Thread events, like a context switch, can be raised from an
+	 * interrupt (e.g. PendSV) on behalf of the current thread.
+	 */
+	if (type != TRACING_FILTER_TYPE_THREAD && k_is_in_isr()) {
+		return false;
+	}
+
+	current = _current;
+
+	/* Not locked, the table can change while it is read but a thread
+	 * pointer is written at once.
+	 */
+	for (size_t i = 0; i < threads_cnt; i++) {
+		if (threads[i] == current) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static bool sample_pass(enum tracing_filter_type type, uint16_t *cnt)
+{
+	uint16_t ratio = ratios[type];
+	uint16_t n = *cnt;
+
+	if (ratio <= 1) {
+		return true;
+	}
+
+	*cnt = (n + 1 >= ratio) ? 0 : n + 1;
+
+	return n == 0;
+}
+
+bool z_tracing_filter_check(enum tracing_filter_type type, uint16_t *cnt)
+{
+	atomic_val_t filter = atomic_get(&z_tracing_filter);
+
+	if ((filter & Z_TRACING_FILTER_THREADS) && !thread_pass(type)) {
+		return false;
+	}
+
+	if ((filter & Z_TRACING_FILTER_SAMPLING) && !sample_pass(type, cnt)) {
+		return false;
+	}
+
+	return true;
+}
+
+int tracing_filter_type_set(enum tracing_filter_type type, bool enable)
+{
+	if (!type_is_valid(type)) {
+		return -EINVAL;
+	}
+
+	if (enable) {
+		atomic_and(&z_tracing_filter, ~BIT(type));
+	} else {
+		atomic_or(&z_tracing_filter, BIT(type));
+	}
+
+	return 0;
+}
+
+bool tracing_filter_type_is_enabled(enum tracing_filter_type type)
+{
+	if (!type_is_valid(type)) {
+		return false;
+	}
+
+	return (atomic_get(&z_tracing_filter) & BIT(type)) == 0;
+}
+
+const char *tracing_filter_type_name(enum tracing_filter_type type)
+{
+	return type_is_valid(type) ? type_names[type] : NULL;
+}
+
+int tracing_filter_type_from_name(const char *name)
+{
+	for (int i = 0; i < TRACING_FILTER_TYPE_COUNT; i++) {
+		if (strcmp(name, type_names[i]) == 0) {
+			return i;
+		}
+	}
+
+	return -EINVAL;
+}
+
+/* Must be called with the lock held. */
+static void sampling_flag_update(void)
+{
+	for (int i = 0; i < TRACING_FILTER_TYPE_COUNT; i++) {
+		if (ratios[i] > 1) {
+			atomic_or(&z_tracing_filter, Z_TRACING_FILTER_SAMPLING);
+			return;
+		}
+	}
+
+	atomic_and(&z_tracing_filter, ~Z_TRACING_FILTER_SAMPLING);
+}
+
+int tracing_filter_sampling_set(enum tracing_filter_type type,
+				uint16_t ratio)
+{
+	k_spinlock_key_t key;
+
+	if (!type_is_valid(type)) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&lock);
+	ratios[type] = ratio;
+	sampling_flag_update();
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+uint16_t tracing_filter_sampling_get(enum tracing_filter_type type)
+{
+	if (!type_is_valid(type)) {
+		return 1;
+	}
+
+	return MAX(ratios[type], 1);
+}
+
+int tracing_filter_thread_add(struct k_thread *thread)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	int err = 0;
+
+	for (size_t i = 0; i < threads_cnt; i++) {
+		if (threads[i] == thread) {
+			goto out;
+		}
+	}
+
+	if (threads_cnt == ARRAY_SIZE(threads)) {
+		err = -ENOMEM;
+		goto out;
+	}
+
+	threads[threads_cnt++] = thread;
+	atomic_or(&z_tracing_filter, Z_TRACING_FILTER_THREADS);
+
+out:
+	k_spin_unlock(&lock, key);
+
+	return err;
+}
+
+int tracing_filter_thread_remove(struct k_thread *thread)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	int err = -ENOENT;
+
+	for (size_t i = 0; i < threads_cnt; i++) {
+		if (threads[i] == thread) {
+			threads[i] = threads[--threads_cnt];
+			err = 0;
+			break;
+		}
+	}
+
+	if (threads_cnt == 0) {
+		atomic_and(&z_tracing_filter, ~Z_TRACING_FILTER_THREADS);
+	}
+
+	k_spin_unlock(&lock, key);
+
+	return err;
+}
+
+void tracing_filter_thread_clear(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	atomic_and(&z_tracing_filter, ~Z_TRACING_FILTER_THREADS);
+	threads_cnt = 0;
+
+	k_spin_unlock(&lock, key);
+}
+
+void tracing_filter_event_set(uint8_t id, bool enable)
+{
+	atomic_set_bit_to(z_tracing_filter_events, id, !enable);
+}
+
+void tracing_filter_reset(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	atomic_clear(&z_tracing_filter);
+	threads_cnt = 0;
+	memset(ratios, 0, sizeof(ratios));
+
+	for (size_t i = 0; i < ARRAY_SIZE(z_tracing_filter_events); i++) {
+		atomic_clear(&z_tracing_filter_events[i]);
+	}
+
+	k_spin_unlock(&lock, key);
+}
+
+size_t tracing_filter_threads_get(struct k_thread **buf, size_t len)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	size_t cnt = MIN(len, threads_cnt);
+
+	memcpy(buf, threads, cnt * sizeof(threads[0]));
+	k_spin_unlock(&lock, key);
+
+	return cnt;
+}
+
+struct thread_find_data {
+	const char *name;
+	struct k_thread *thread;
+};
+
+static void thread_find_cb(const struct k_thread *thread, void *user_data)
+{
+	struct thread_find_data *data = user_data;
+	const char *name = k_thread_name_get((k_tid_t)thread);
+
+	if (data->thread == NULL && name != NULL &&
+	    strcmp(name, data->name) == 0) {
+		data->thread = (struct k_thread *)thread;
+	}
+}
+
+/* Thread given by name or address, e.g. "main" or "0x20000100". */
+static struct k_thread *thread_find(const char *str)
+{
+	struct thread_find_data data = {
+		.name = str,
+	};
+
+	if (strncmp(str, "0x", 2) == 0) {
+		char *end;
+		uintptr_t addr = strtoul(str, &end, 16);
+
+		return (*end == '\0') ? (struct k_thread *)addr : NULL;
+	}
+
+	if (IS_ENABLED(CONFIG_THREAD_MONITOR) &&
+	    IS_ENABLED(CONFIG_THREAD_NAME)) {
+		k_thread_foreach(thread_find_cb, &data);
+	}
+
+	return data.thread;
+}
+
+static int parse_on_off(const char *str, bool *on)
+{
+	if (strcmp(str, "on") == 0) {
+		*on = true;
+	} else if (strcmp(str, "off") == 0) {
+		*on = false;
+	} else {
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+/* Range of types given by name or "all". */
+static int parse_types(const char *str, int *first, int *last)
+{
+	if (strcmp(str, "all") == 0) {
+		*first = 0;
+		*last = TRACING_FILTER_TYPE_COUNT - 1;
+		return 0;
+	}
+
+	*first = tracing_filter_type_from_name(str);
+	*last = *first;
+
+	return *first;
+}
+
+static int cmd_type(const char *type, const char *value)
+{
+	int first, last;
+	bool on;
+
+	if (parse_on_off(value, &on) < 0 ||
+	    parse_types(type, &first, &last) < 0) {
+		return -EINVAL;
+	}
+
+	for (int i = first; i <= last; i++) {
+		(void)tracing_filter_type_set(i, on);
+	}
+
+	return 0;
+}
+
+static int cmd_sample(const char *type, const char *value)
+{
+	int first, last;
+	unsigned long ratio;
+	char *end;
+
+	ratio = strtoul(value, &end, 10);
+	if (end == value || *end != '\0' || ratio > UINT16_MAX ||
+	    parse_types(type, &first, &last) < 0) {
+		return -EINVAL;
+	}
+
+	for (int i = first; i <= last; i++) {
+		(void)tracing_filter_sampling_set(i, ratio);
+	}
+
+	return 0;
+}
+
+static int cmd_event(const char *id_str, const char *value)
+{
+	unsigned long id;
+	char *end;
+	bool on;
+
+	id = strtoul(id_str, &end, 0);
+	if (end == id_str || *end != '\0' || id > UINT8_MAX ||
+	    parse_on_off(value, &on) < 0) {
+		return -EINVAL;
+	}
+
+	tracing_filter_event_set(id, on);
+
+	return 0;
+}
+
+static int cmd_thread(const char *name, const char *value)
+{
+	struct k_thread *thread;
+	bool on;
+
+	if (parse_on_off(value, &on) < 0) {
+		return -EINVAL;
+	}
+
+	if (strcmp(name, "all") == 0) {
+		if (!on) {
+			return -EINVAL;
+		}
+
+		tracing_filter_thread_clear();
+		return 0;
+	}
+
+	thread = thread_find(name);
+	if (thread == NULL) {
+		return -ENOENT;
+	}
+
+	return on ? tracing_filter_thread_add(thread) :
+		    tracing_filter_thread_remove(thread);
+}
+
+int tracing_filter_cmd(size_t argc, char **argv)
+{
+	if (argc == 1 && strcmp(argv[0], "reset") == 0) {
+		tracing_filter_reset();
+		return 0;
+	}
+
+	if (argc != 3) {
+		return -EINVAL;
+	}
+
+	if (strcmp(argv[0], "type") == 0) {
+		return cmd_type(argv[1], argv[2]);
+	} else if (strcmp(argv[0], "sample") == 0) {
+		return cmd_sample(argv[1], argv[2]);
+	} else if (strcmp(argv[0], "event") == 0) {
+		return cmd_event(argv[1], argv[2]);
+	} else if (strcmp(argv[0], "thread") == 0) {
+		return cmd_thread(argv[1], argv[2]);
+	}
+
+	return -EINVAL;
+}
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/shell/shell.h>
+#include <zephyr/tracing/tracing_filter.h>
+
+static int cmd_filter_show(const struct shell *sh, size_t argc, char **argv)
+{
+	struct k_thread *threads[CONFIG_TRACING_FILTER_THREADS];
+	size_t cnt;
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	shell_print(sh, "%-10s | %-5s | %s", "type", "state", "sampling");
+	shell_print(sh, "---------------------------------");
+
+	for (int i = 0; i < TRACING_FILTER_TYPE_COUNT; i++) {
+		shell_print(sh, "%-10s | %-5s | 1/%u",
+			    tracing_filter_type_name(i),
+			    tracing_filter_type_is_enabled(i) ? "on" : "off",
+			    tracing_filter_sampling_get(i));
+	}
+
+	cnt = tracing_filter_threads_get(threads, ARRAY_SIZE(threads));
+	if (cnt == 0) {
+		shell_print(sh, "threads: all");
+	}
+
+	for (size_t i = 0; i < cnt; i++) {
+		const char *name = k_thread_name_get(threads[i]);
+
+		shell_print(sh, "thread: %p %s", threads[i], name ? name : "");
+	}
+
+	for (int id = 0; id <= UINT8_MAX; id++) {
+		if (!tracing_filter_event_is_enabled(id)) {
+			shell_print(sh, "event off: 0x%02x", id);
+		}
+	}
+
+	return 0;
+}
+
+static int cmd_filter(const struct shell *sh, size_t argc, char **argv)
+{
+	int err;
+
+	err = tracing_filter_cmd(argc, argv);
+	if (err == -ENOENT) {
+		shell_error(sh, "Thread %s not found", argv[1]);
+	} else if (err == -ENOMEM) {
+		shell_error(sh, "Thread filter is full");
+	} else if (err < 0) {
+		shell_error(sh, "Invalid arguments");
+	}
+
+	return err;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_tracing_filter,
+	SHELL_CMD_ARG(show, NULL, "Show filters.", cmd_filter_show, 1, 0),
+	SHELL_CMD_ARG(type, NULL,
+		      "Enable or disable object type.\n"
+		      "usage: type <type|all> <on|off>", cmd_filter, 3, 0),
+	SHELL_CMD_ARG(sample, NULL,
+		      "Trace one in <ratio> events of object type.\n"
+		      "usage: sample <type|all> <ratio>", cmd_filter, 3, 0),
+	SHELL_CMD_ARG(event, NULL,
+		      "Enable or disable event of the tracing format.\n"
+		      "usage: event <id> <on|off>", cmd_filter, 3, 0),
+	SHELL_CMD_ARG(thread, NULL,
+		      "Trace only events of given threads.\n"
+		      "usage: thread <name|address|all> <on|off>",
+		      cmd_filter, 3, 0),
+	SHELL_CMD_ARG(reset, NULL, "Trace all events.", cmd_filter, 1, 0),
+	SHELL_SUBCMD_SET_END
+);
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_tracing,
+	SHELL_CMD(filter, &sub_tracing_filter, "Tracing filters.", NULL),
+	SHELL_SUBCMD_SET_END
+);
+
+SHELL_CMD_REGISTER(tracing, &sub_tracing, "Tracing commands", NULL);
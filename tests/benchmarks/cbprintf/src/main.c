@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <ztest.h>
+#include <string.h>
+
+#include <zephyr/sys/cbprintf.h>
+
+#define ITERATIONS 10000
+
+/* A typical log line with its prefix, roughly 100 characters */
+#define FMT "[%08u] <%s> %s: connection %d to %s port %u: %u bytes queued, " \
+	    "state %s\n"
+#define ARGS 123456U, "inf", "net_tcp", 3, "192.0.2.1", 4242U, 1460U, \
+	     "ESTABLISHED"
+
+struct out_buffer {
+	char buf[256];
+	size_t idx;
+	size_t calls;
+};
+
+static struct out_buffer outbuf;
+
+static int char_out(int c, void *ctx)
+{
+	struct out_buffer *out = ctx;
+
+	out->calls++;
+	if (out->idx < sizeof(out->buf)) {
+		out->buf[out->idx++] = (char)c;
+	}
+
+	return c;
+}
+
+static int str_out(const char *str, size_t len, void *ctx)
+{
+	struct out_buffer *out = ctx;
+	size_t n = MIN(len, sizeof(out->buf) - out->idx);
+
+	out->calls++;
+	memcpy(&out->buf[out->idx], str, n);
+	out->idx += n;
+
+	return 0;
+}
+
+static void char_prf(const char *fmt, ...)
+{
+	va_list ap;
+
+	va_start(ap, fmt);
+	(void)cbvprintf(char_out, &outbuf, fmt, ap);
+	va_end(ap);
+}
+
+static void str_prf(const char *fmt, ...)
+{
+	va_list ap;
+
+	va_start(ap, fmt);
+	(void)cbvprintf_str(str_out, &outbuf, fmt, ap);
+	va_end(ap);
+}
+
+static void run(const char *name, void (*prf)(const char *fmt, ...))
+{
+	uint32_t start, cycles;
+	size_t len = 0, calls = 0;
+	int i;
+
+	start = k_cycle_get_32();
+
+	for (i = 0; i < ITERATIONS; i++) {
+		outbuf.idx = 0;
+		outbuf.calls = 0;
+		prf(FMT, ARGS);
+		len += outbuf.idx;
+		calls += outbuf.calls;
+	}
+
+	cycles = k_cycle_get_32() - start;
+
+	printk("cbprintf %s: %zu chars in %zu calls, %u cycles "
+	       "(%u cycles/line)\n", name, len / ITERATIONS,
+	       calls / ITERATIONS, cycles, cycles / ITERATIONS);
+}
+
+static void test_format(void)
+{
+	char expected[sizeof(outbuf.buf)];
+	size_t len;
+
+	len = snprintk(expected, sizeof(expected), FMT, ARGS);
+
+	run("char", char_prf);
+	zassert_equal(outbuf.idx, len, "Invalid length");
+	zassert_mem_equal(outbuf.buf, expected, len, "Invalid output");
+
+	run("str", str_prf);
+	zassert_equal(outbuf.idx, len, "Invalid length");
+	zassert_mem_equal(outbuf.buf, expected, len, "Invalid output");
+}
+
+void test_main(void)
+{
+	ztest_test_suite(cbprintf_benchmark,
+			 ztest_unit_test(test_format));
+
+	ztest_run_test_suite(cbprintf_benchmark);
+}
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <ztest.h>
+
+#include <zephyr/net/http_parser.h>
+
+#define PARSE_COUNT 2000
+
+/* Fed to the parser in chunks of this size, like a receive buffer. */
+#define CHUNK_SIZE 512
+
+static const char response[] =
+	"HTTP/1.1 200 OK\r\n"
+	"Date: Mon, 27 Jul 2009 12:28:53 GMT\r\n"
+	"Server: Apache/2.2.14 (Win32)\r\n"
+	"Last-Modified: Wed, 22 Jul 2009 19:15:56 GMT\r\n"
+	"ETag: \"34aa387-d-1568eb00\"\r\n"
+	"Accept-Ranges: bytes\r\n"
+	"Cache-Control: private, max-age=0, must-revalidate\r\n"
+	"Vary: Accept-Encoding, User-Agent\r\n"
+	"Content-Type: application/json; charset=utf-8\r\n"
+	"X-Content-Type-Options: nosniff\r\n"
+	"X-Frame-Options: SAMEORIGIN\r\n"
+	"Strict-Transport-Security: max-age=31536000; includeSubDomains\r\n"
+	"Set-Cookie: session=0123456789abcdef0123456789abcdef; Path=/\r\n"
+	"Connection: keep-alive\r\n"
+	"Content-Length: 13\r\n"
+	"\r\n"
+	"Hello, World!";
+
+static struct http_parser parser;
+static size_t header_bytes;
+static size_t body_bytes;
+static bool complete;
+
+static int on_header_field(struct http_parser *p, const char *at,
+			   size_t length)
+{
+	header_bytes += length;
+	return 0;
+}
+
+static int on_header_value(struct http_parser *p, const char *at,
+			   size_t length)
+{
+	header_bytes += length;
+	return 0;
+}
+
+static int on_body(struct http_parser *p, const char *at, size_t length)
+{
+	body_bytes += length;
+	return 0;
+}
+
+static int on_message_complete(struct http_parser *p)
+{
+	complete = true;
+	return 0;
+}
+
+static void parse_response(const struct http_parser_settings *settings)
+{
+	size_t len = sizeof(response) - 1;
+	size_t pos = 0;
+	size_t parsed;
+	size_t chunk;
+
+	http_parser_init(&parser, HTTP_RESPONSE);
+	complete = false;
+
+	while (pos < len) {
+		chunk = MIN(len - pos, CHUNK_SIZE);
+		parsed = http_parser_execute(&parser, settings,
+					     response + pos, chunk);
+		zassert_equal(parsed, chunk, "Parse error %s",
+			      http_errno_name(HTTP_PARSER_ERRNO(&parser)));
+		pos += chunk;
+	}
+
+	zassert_true(complete, "Message not complete");
+	zassert_equal(parser.status_code, 200, "Wrong status");
+	zassert_equal(parser.content_length, 0, "Body not consumed");
+	zassert_true(http_should_keep_alive(&parser), "Keep-alive not seen");
+}
+
+static void run(const char *name, const struct http_parser_settings *settings)
+{
+	size_t bytes = PARSE_COUNT * (sizeof(response) - 1);
+	uint32_t start, ms;
+
+	header_bytes = 0;
+	body_bytes = 0;
+
+	start = k_uptime_get_32();
+
+	for (int i = 0; i < PARSE_COUNT; i++) {
+		parse_response(settings);
+	}
+
+	ms = k_uptime_get_32() - start;
+
+	zassert_equal(body_bytes, PARSE_COUNT * 13, "Wrong body length");
+
+	printk("http_parser %s: %zu bytes in %u ms (%u kB/s)\n", name, bytes,
+	       ms, ms ? (uint32_t)(bytes / ms) : 0);
+}
+
+static void test_http_parser_headers_skipped(void)
+{
+	const struct http_parser_settings settings = {
+		.on_body = on_body,
+		.on_message_complete = on_message_complete,
+	};
+
+	run("no header callbacks", &settings);
+	zassert_equal(header_bytes, 0, "Header callbacks called");
+}
+
+static void test_http_parser_headers(void)
+{
+	const struct http_parser_settings settings = {
+		.on_header_field = on_header_field,
+		.on_header_value = on_header_value,
+		.on_body = on_body,
+		.on_message_complete = on_message_complete,
+	};
+
+	run("header callbacks", &settings);
+	zassert_not_equal(header_bytes, 0, "Header callbacks not called");
+}
+
+void test_main(void)
+{
+	ztest_test_suite(http_parser_benchmark,
+			 ztest_unit_test(test_http_parser_headers_skipped),
+			 ztest_unit_test(test_http_parser_headers));
+
+	ztest_run_test_suite(http_parser_benchmark);
+}
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_test, LOG_LEVEL_INF);
+
+#include <ztest.h>
+
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/net/dummy.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_ip.h>
+
+#include "net_private.h"
+#include "ipv4.h"
+#include "udp_internal.h"
+
+#define TEST_PORT 4242
+#define FRAG_COUNT CONFIG_NET_IPV4_FRAGMENT_MAX_PKT
+#define FRAG_LEN 512
+#define DATAGRAM_LEN (FRAG_COUNT * FRAG_LEN)
+#define DATAGRAM_COUNT 1000
+
+#define WAIT_TIME K_SECONDS(1)
+#define ALLOC_TIMEOUT K_MSEC(500)
+
+static struct in_addr my_addr = { { { 192, 0, 2, 1 } } };
+static struct in_addr peer_addr = { { { 192, 0, 2, 2 } } };
+
+static uint8_t payload[FRAG_LEN];
+static struct net_if *iface;
+static struct k_sem received;
+static uint16_t next_id;
+
+static int dummy_dev_init(const struct device *dev)
+{
+	return 0;
+}
+
+static int dummy_send(const struct device *dev, struct net_pkt *pkt)
+{
+	return 0;
+}
+
+static void dummy_iface_init(struct net_if *iface)
+{
+	static uint8_t mac[] = { 0x00, 0x00, 0x5e, 0x00, 0x53, 0x01 };
+
+	net_if_set_link_addr(iface, mac, sizeof(mac), NET_LINK_ETHERNET);
+}
+
+static struct dummy_api dummy_api = {
+	.iface_api.init = dummy_iface_init,
+	.send = dummy_send,
+};
+
+NET_DEVICE_INIT(ipv4_frag_bench, "ipv4_frag_bench", dummy_dev_init, NULL,
+		NULL, NULL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT, &dummy_api,
+		DUMMY_L2, NET_L2_GET_CTX_TYPE(DUMMY_L2), 576);
+
+static enum net_verdict udp_received(struct net_conn *conn,
+				     struct net_pkt *pkt,
+				     union net_ip_header *ip_hdr,
+				     union net_proto_header *proto_hdr,
+				     void *user_data)
+{
+	zassert_equal(net_pkt_remaining_data(pkt),
+		      DATAGRAM_LEN - NET_UDPH_LEN, "Invalid length");
+
+	net_pkt_unref(pkt);
+	k_sem_give(&received);
+
+	return NET_OK;
+}
+
+/* Build fragment idx of the datagram with the given id, the UDP header is
+ * at the start of the first fragment.
+ */
+static struct net_pkt *make_fragment(uint16_t id, int idx)
+{
+	struct net_ipv4_hdr *hdr;
+	struct net_pkt *pkt;
+	uint16_t flags;
+
+	pkt = net_pkt_rx_alloc_with_buffer(iface, NET_IPV4H_LEN + FRAG_LEN,
+					   AF_UNSPEC, 0, ALLOC_TIMEOUT);
+	zassert_not_null(pkt, "Cannot allocate fragment");
+
+	net_pkt_set_family(pkt, AF_INET);
+
+	flags = idx * FRAG_LEN / 8;
+	if (idx < FRAG_COUNT - 1) {
+		flags |= NET_IPV4_FRAGH_MF;
+	}
+
+	zassert_ok(net_ipv4_create_full(pkt, &peer_addr, &my_addr, 0, id,
+					flags >> 13, flags & 0x1fff, 64),
+		   "Cannot create header");
+
+	if (idx == 0) {
+		struct net_udp_hdr udp = {
+			.src_port = htons(TEST_PORT),
+			.dst_port = htons(TEST_PORT),
+			.len = htons(DATAGRAM_LEN),
+		};
+
+		zassert_ok(net_pkt_write(pkt, &udp, sizeof(udp)), "UDP");
+		zassert_ok(net_pkt_write(pkt, payload,
+					 FRAG_LEN - sizeof(udp)), "data");
+	} else {
+		zassert_ok(net_pkt_write(pkt, payload, FRAG_LEN), "data");
+	}
+
+	hdr = NET_IPV4_HDR(pkt);
+	hdr->len = htons(net_pkt_get_len(pkt));
+	hdr->proto = IPPROTO_UDP;
+	hdr->chksum = net_calc_chksum_ipv4(pkt);
+
+	return pkt;
+}
+
+/* Feed the fragments of spread datagrams at a time, interleaving them, and
+ * wait until all of them have been reassembled.
+ */
+static void run(const char *name, int spread, bool reverse)
+{
+	struct net_pkt *pkt;
+	uint32_t start, ms;
+	size_t bytes = 0;
+	int i, j, k;
+
+	start = k_uptime_get_32();
+
+	for (i = 0; i < DATAGRAM_COUNT; i += spread) {
+		uint16_t id = next_id;
+
+		next_id += spread;
+
+		for (k = 0; k < FRAG_COUNT; k++) {
+			int idx = reverse ? FRAG_COUNT - 1 - k : k;
+
+			for (j = 0; j < spread; j++) {
+				pkt = make_fragment(id + j, idx);
+				zassert_ok(net_recv_data(iface, pkt),
+					   "Cannot receive fragment");
+			}
+		}
+
+		for (j = 0; j < spread; j++) {
+			zassert_ok(k_sem_take(&received, WAIT_TIME),
+				   "Datagram %d not reassembled", i + j);
+		}
+
+		bytes += spread * DATAGRAM_LEN;
+	}
+
+	ms = k_uptime_get_32() - start;
+
+	printk("ipv4_fragment %s: %zu bytes in %u ms (%u kB/s)\n", name,
+	       bytes, ms, ms ? (uint32_t)(bytes / ms) : 0);
+}
+
+static void test_setup(void)
+{
+	struct sockaddr local_addr = { 0 };
+	struct net_conn_handle *handle;
+	int i;
+
+	k_sem_init(&received, 0, UINT_MAX);
+
+	for (i = 0; i < sizeof(payload); i++) {
+		payload[i] = i;
+	}
+
+	iface = net_if_get_first_by_type(&NET_L2_GET_NAME(DUMMY));
+	zassert_not_null(iface, "No interface");
+
+	zassert_not_null(net_if_ipv4_addr_add(iface, &my_addr,
+					      NET_ADDR_MANUAL, 0),
+			 "Cannot add address");
+
+	local_addr.sa_family = AF_INET;
+	net_sin(&local_addr)->sin_port = htons(TEST_PORT);
+
+	zassert_ok(net_udp_register(AF_INET, NULL, &local_addr, 0, TEST_PORT,
+				    NULL, udp_received, NULL, &handle),
+		   "Cannot register UDP handler");
+}
+
+static void test_reassembly(void)
+{
+	run("in order", 1, false);
+	run("reverse order", 1, true);
+	run("interleaved", CONFIG_NET_IPV4_FRAGMENT_MAX_COUNT, false);
+	run("interleaved reverse", CONFIG_NET_IPV4_FRAGMENT_MAX_COUNT, true);
+}
+
+void test_main(void)
+{
+	ztest_test_suite(ipv4_fragment_benchmark,
+			 ztest_unit_test(test_setup),
+			 ztest_unit_test(test_reassembly));
+
+	ztest_run_test_suite(ipv4_fragment_benchmark);
+}
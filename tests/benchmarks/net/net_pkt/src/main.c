@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_test, LOG_LEVEL_INF);
+
+#include <ztest.h>
+
+#include <zephyr/net/dummy.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_ip.h>
+#include <zephyr/net/net_pkt.h>
+
+#define PKT_LEN 512
+#define ITERATIONS 100000
+
+/* Headers that straddle the first two buffers */
+#define SPLIT_OFFSET (CONFIG_NET_BUF_DATA_SIZE - NET_IPV4H_LEN / 2)
+
+static struct net_pkt *pkt;
+static volatile uint32_t sink;
+
+static int dummy_dev_init(const struct device *dev)
+{
+	return 0;
+}
+
+static int dummy_send(const struct device *dev, struct net_pkt *pkt)
+{
+	return 0;
+}
+
+static void dummy_iface_init(struct net_if *iface)
+{
+	static uint8_t mac[] = { 0x00, 0x00, 0x5e, 0x00, 0x53, 0x01 };
+
+	net_if_set_link_addr(iface, mac, sizeof(mac), NET_LINK_ETHERNET);
+}
+
+static struct dummy_api dummy_api = {
+	.iface_api.init = dummy_iface_init,
+	.send = dummy_send,
+};
+
+NET_DEVICE_INIT(net_pkt_bench, "net_pkt_bench", dummy_dev_init, NULL, NULL,
+		NULL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT, &dummy_api,
+		DUMMY_L2, NET_L2_GET_CTX_TYPE(DUMMY_L2), 1500);
+
+/* Go through the IPv4 and UDP headers the way the input path does */
+static uint32_t get_headers(void)
+{
+	NET_PKT_DATA_ACCESS_DEFINE(ipv4_access, struct net_ipv4_hdr);
+	NET_PKT_DATA_ACCESS_DEFINE(udp_access, struct net_udp_hdr);
+	struct net_ipv4_hdr *ipv4_hdr;
+	struct net_udp_hdr *udp_hdr;
+
+	ipv4_hdr = net_pkt_get_data(pkt, &ipv4_access);
+	zassert_not_null(ipv4_hdr, "IPv4 header");
+	net_pkt_acknowledge_data(pkt, &ipv4_access);
+
+	udp_hdr = net_pkt_get_data(pkt, &udp_access);
+	zassert_not_null(udp_hdr, "UDP header");
+	net_pkt_acknowledge_data(pkt, &udp_access);
+
+	return ipv4_hdr->proto + udp_hdr->dst_port;
+}
+
+/* Same headers read field by field */
+static uint32_t read_fields(void)
+{
+	uint32_t sum = 0U, val32;
+	uint16_t val16;
+	uint8_t val8;
+	int i, ret = 0;
+
+	for (i = 0; i < 2; i++) {
+		ret |= net_pkt_read_u8(pkt, &val8);
+		sum += val8;
+	}
+
+	for (i = 0; i < 3; i++) {
+		ret |= net_pkt_read_be16(pkt, &val16);
+		sum += val16;
+	}
+
+	for (i = 0; i < 2; i++) {
+		ret |= net_pkt_read_u8(pkt, &val8);
+		sum += val8;
+	}
+
+	ret |= net_pkt_read_be16(pkt, &val16);
+	sum += val16;
+
+	for (i = 0; i < 2; i++) {
+		ret |= net_pkt_read_be32(pkt, &val32);
+		sum += val32;
+	}
+
+	for (i = 0; i < 4; i++) {
+		ret |= net_pkt_read_be16(pkt, &val16);
+		sum += val16;
+	}
+
+	zassert_ok(ret, "Read failed");
+
+	return sum;
+}
+
+/* Same headers written field by field */
+static uint32_t write_fields(void)
+{
+	int i, ret = 0;
+
+	ret |= net_pkt_write_u8(pkt, 0x45);
+	ret |= net_pkt_write_u8(pkt, 0);
+	ret |= net_pkt_write_be16(pkt, PKT_LEN);
+	ret |= net_pkt_write_be16(pkt, 0);
+	ret |= net_pkt_write_be16(pkt, 0);
+	ret |= net_pkt_write_u8(pkt, 64);
+	ret |= net_pkt_write_u8(pkt, IPPROTO_UDP);
+	ret |= net_pkt_write_be16(pkt, 0);
+	ret |= net_pkt_write_be32(pkt, 0xc0000201);
+	ret |= net_pkt_write_be32(pkt, 0xc0000202);
+
+	for (i = 0; i < 4; i++) {
+		ret |= net_pkt_write_be16(pkt, 4242);
+	}
+
+	zassert_ok(ret, "Write failed");
+
+	return 0;
+}
+
+static void run(const char *name, uint32_t (*op)(void), size_t offset)
+{
+	uint32_t start, cycles;
+	int i;
+
+	start = k_cycle_get_32();
+
+	for (i = 0; i < ITERATIONS; i++) {
+		net_pkt_cursor_init(pkt);
+		zassert_ok(net_pkt_skip(pkt, offset), "Skip failed");
+
+		sink += op();
+	}
+
+	cycles = k_cycle_get_32() - start;
+
+	printk("net_pkt %s%s: %u packets in %u cycles (%u cycles/packet)\n",
+	       name, offset ? " split" : "", ITERATIONS, cycles,
+	       cycles / ITERATIONS);
+}
+
+static void test_setup(void)
+{
+	struct net_if *iface;
+
+	iface = net_if_get_first_by_type(&NET_L2_GET_NAME(DUMMY));
+	zassert_not_null(iface, "No interface");
+
+	pkt = net_pkt_rx_alloc_with_buffer(iface, PKT_LEN, AF_UNSPEC, 0,
+					   K_NO_WAIT);
+	zassert_not_null(pkt, "Cannot allocate pkt");
+	zassert_not_null(pkt->buffer->frags, "Packet is not fragmented");
+
+	zassert_ok(net_pkt_memset(pkt, 0, PKT_LEN), "Cannot fill pkt");
+
+	net_pkt_set_overwrite(pkt, true);
+}
+
+static void test_access(void)
+{
+	run("write fields", write_fields, 0);
+	run("write fields", write_fields, SPLIT_OFFSET);
+	run("read fields", read_fields, 0);
+	run("read fields", read_fields, SPLIT_OFFSET);
+	run("get headers", get_headers, 0);
+	run("get headers", get_headers, SPLIT_OFFSET);
+}
+
+void test_main(void)
+{
+	ztest_test_suite(net_pkt_benchmark,
+			 ztest_unit_test(test_setup),
+			 ztest_unit_test(test_access));
+
+	ztest_run_test_suite(net_pkt_benchmark);
+}
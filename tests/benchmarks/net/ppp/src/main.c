@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_test, LOG_LEVEL_INF);
+
+#include <ztest.h>
+
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/net/ppp.h>
+
+#include "ppp_hdlc.h"
+
+#define PAYLOAD_LEN 1400
+#define FRAME_COUNT 1000
+
+#define WAIT_TIME K_SECONDS(1)
+
+typedef enum net_verdict (*ppp_l2_callback_t)(struct net_if *iface,
+					      struct net_pkt *pkt);
+void ppp_l2_register_pkt_cb(ppp_l2_callback_t cb); /* found in ppp_l2.c */
+void ppp_driver_feed_data(uint8_t *data, int data_len);
+
+/* Worst case every byte is escaped, plus the flag bytes */
+static uint8_t frame[2 * (4 + PAYLOAD_LEN + 2) + 2];
+static uint8_t payload[PAYLOAD_LEN];
+static uint8_t recv_payload[PAYLOAD_LEN];
+
+static struct net_if *iface;
+static struct k_sem received;
+static bool verify;
+
+static enum net_verdict ppp_recv(struct net_if *iface, struct net_pkt *pkt)
+{
+	uint16_t protocol;
+
+	zassert_equal(net_pkt_get_len(pkt), sizeof(protocol) + PAYLOAD_LEN,
+		      "Invalid length");
+
+	if (verify) {
+		zassert_ok(net_pkt_read_be16(pkt, &protocol), "protocol");
+		zassert_equal(protocol, PPP_IP, "Invalid protocol");
+		zassert_ok(net_pkt_read(pkt, recv_payload, PAYLOAD_LEN),
+			   "payload");
+		zassert_mem_equal(recv_payload, payload, PAYLOAD_LEN,
+				  "Payload mismatch");
+		verify = false;
+	}
+
+	k_sem_give(&received);
+
+	return NET_DROP;
+}
+
+static size_t escape(const uint8_t *data, size_t len, size_t off,
+		     uint16_t *fcs)
+{
+	size_t consumed = len;
+
+	off += ppp_hdlc_escape(data, &consumed, &frame[off],
+			       sizeof(frame) - off, fcs);
+	zassert_equal(consumed, len, "Frame buffer too small");
+
+	return off;
+}
+
+/* Frame the payload the same way the driver does when sending */
+static size_t make_frame(void)
+{
+	static const uint8_t hdr[] = { 0xff, 0x03, PPP_IP >> 8, PPP_IP & 0xff };
+	uint16_t fcs = PPP_HDLC_FCS_INIT;
+	uint16_t fcs_le, unused = 0U;
+	size_t off = 0;
+
+	frame[off++] = PPP_HDLC_FLAG;
+
+	off = escape(hdr, sizeof(hdr), off, &fcs);
+	off = escape(payload, sizeof(payload), off, &fcs);
+
+	fcs_le = sys_cpu_to_le16(fcs ^ 0xffff);
+	off = escape((const uint8_t *)&fcs_le, sizeof(fcs_le), off, &unused);
+
+	frame[off++] = PPP_HDLC_FLAG;
+
+	return off;
+}
+
+/* Loop the framed payload back to the driver and wait until each frame
+ * has gone through the receive path.
+ */
+static void run(const char *name)
+{
+	uint32_t start, ms;
+	size_t bytes = 0;
+	size_t len;
+	int i;
+
+	verify = true;
+
+	start = k_uptime_get_32();
+
+	for (i = 0; i < FRAME_COUNT; i++) {
+		len = make_frame();
+
+		ppp_driver_feed_data(frame, len);
+
+		zassert_ok(k_sem_take(&received, WAIT_TIME),
+			   "Frame %d not received", i);
+
+		bytes += len;
+	}
+
+	ms = k_uptime_get_32() - start;
+
+	zassert_false(verify, "Payload not verified");
+
+	printk("ppp %s: %zu bytes in %u ms (%u kB/s)\n", name,
+	       bytes, ms, ms ? (uint32_t)(bytes / ms) : 0);
+}
+
+static void test_setup(void)
+{
+	k_sem_init(&received, 0, UINT_MAX);
+
+	iface = net_if_get_first_by_type(&NET_L2_GET_NAME(PPP));
+	zassert_not_null(iface, "No interface");
+
+	ppp_l2_register_pkt_cb(ppp_recv);
+
+	net_if_up(iface);
+}
+
+static void test_loopback(void)
+{
+	uint32_t seed = 1U;
+	int i;
+
+	/* Printable data, nothing to escape */
+	for (i = 0; i < sizeof(payload); i++) {
+		payload[i] = 0x20 + i % 0x5d;
+	}
+
+	run("no escapes");
+
+	/* Pseudo random data, about one byte in eight is escaped */
+	for (i = 0; i < sizeof(payload); i++) {
+		seed = seed * 1103515245U + 12345U;
+		payload[i] = seed >> 16;
+	}
+
+	run("random");
+
+	/* Control characters only, every byte is escaped */
+	for (i = 0; i < sizeof(payload); i++) {
+		payload[i] = i % 0x20;
+	}
+
+	run("all escaped");
+}
+
+void test_main(void)
+{
+	ztest_test_suite(ppp_benchmark,
+			 ztest_unit_test(test_setup),
+			 ztest_unit_test(test_loopback));
+
+	ztest_run_test_suite(ppp_benchmark);
+}
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_test, LOG_LEVEL_INF);
+
+#include <ztest.h>
+
+#include <zephyr/net/dummy.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_ip.h>
+
+#include "ipv6.h"
+#include "nbr.h"
+#include "route.h"
+
+#define ROUTE_COUNT CONFIG_NET_MAX_ROUTES
+#define NEXTHOP_COUNT CONFIG_NET_IPV6_MAX_NEIGHBORS
+#define LOOKUP_COUNT 20000
+
+static struct in6_addr my_addr = { { { 0x20, 0x01, 0x0d, 0xb8, 0xff, 0xff,
+				       0, 0, 0, 0, 0, 0, 0, 0, 0, 0x1 } } };
+
+static uint8_t nexthop_mac[NEXTHOP_COUNT][6];
+static struct net_route_entry *routes[ROUTE_COUNT];
+static struct net_if *iface;
+
+static int dummy_dev_init(const struct device *dev)
+{
+	return 0;
+}
+
+static int dummy_send(const struct device *dev, struct net_pkt *pkt)
+{
+	return 0;
+}
+
+static void dummy_iface_init(struct net_if *iface)
+{
+	static uint8_t mac[] = { 0x00, 0x00, 0x5e, 0x00, 0x53, 0x01 };
+
+	net_if_set_link_addr(iface, mac, sizeof(mac), NET_LINK_ETHERNET);
+}
+
+static struct dummy_api dummy_api = {
+	.iface_api.init = dummy_iface_init,
+	.send = dummy_send,
+};
+
+NET_DEVICE_INIT(route_bench, "route_bench", dummy_dev_init, NULL, NULL, NULL,
+		CONFIG_KERNEL_INIT_PRIORITY_DEFAULT, &dummy_api,
+		DUMMY_L2, NET_L2_GET_CTX_TYPE(DUMMY_L2), 1280);
+
+static void nexthop_addr(int idx, struct in6_addr *addr)
+{
+	net_ipv6_addr_create(addr, 0xfe80, 0, 0, 0, 0, 0, 0, idx + 1);
+}
+
+/* Every other route is a /64 inside the /48 of the route before it, so
+ * that the longest match is not simply the only match.
+ */
+static void route_prefix(int idx, struct in6_addr *addr, uint8_t *len)
+{
+	net_ipv6_addr_create(addr, 0x2001, 0x0db8, idx / 2,
+			     (idx % 2) ? 1 : 0, 0, 0, 0, 0);
+	*len = (idx % 2) ? 64 : 48;
+}
+
+static void route_dst(int idx, int host, struct in6_addr *addr)
+{
+	uint8_t len;
+
+	route_prefix(idx, addr, &len);
+	addr->s6_addr[15] = host;
+	addr->s6_addr[7] |= (idx % 2) ? 0 : 2;
+}
+
+static void test_setup(void)
+{
+	struct net_linkaddr lladdr = { .len = 6, .type = NET_LINK_ETHERNET };
+	struct net_if_addr *ifaddr;
+	struct in6_addr addr;
+	uint8_t len;
+	int i;
+
+	iface = net_if_get_first_by_type(&NET_L2_GET_NAME(DUMMY));
+	zassert_not_null(iface, "No interface");
+
+	ifaddr = net_if_ipv6_addr_add(iface, &my_addr, NET_ADDR_MANUAL, 0);
+	zassert_not_null(ifaddr, "Cannot add address");
+
+	for (i = 0; i < NEXTHOP_COUNT; i++) {
+		nexthop_mac[i][0] = 0x02;
+		nexthop_mac[i][5] = i + 1;
+		lladdr.addr = nexthop_mac[i];
+
+		nexthop_addr(i, &addr);
+		zassert_not_null(net_ipv6_nbr_add(iface, &addr, &lladdr, false,
+						  NET_IPV6_NBR_STATE_STATIC),
+				 "Cannot add neighbor %d", i);
+	}
+
+	for (i = 0; i < ROUTE_COUNT; i++) {
+		struct in6_addr nexthop;
+
+		route_prefix(i, &addr, &len);
+		nexthop_addr(i % NEXTHOP_COUNT, &nexthop);
+
+		routes[i] = net_route_add(iface, &addr, len, &nexthop,
+					  NET_IPV6_ND_INFINITE_LIFETIME,
+					  NET_ROUTE_PREFERENCE_MEDIUM);
+		zassert_not_null(routes[i], "Cannot add route %d", i);
+	}
+}
+
+static void check_routes(void)
+{
+	struct net_route_entry *route;
+	struct in6_addr dst;
+	int i;
+
+	for (i = 0; i < ROUTE_COUNT; i++) {
+		route_dst(i, i, &dst);
+		route = net_route_lookup(iface, &dst);
+
+		if (routes[i]) {
+			zassert_equal_ptr(route, routes[i],
+					  "Wrong route for %d", i);
+		} else if (i % 2) {
+			/* The covering /48 if it is still there */
+			zassert_equal_ptr(route, routes[i - 1],
+					  "Wrong route for %d", i);
+		} else {
+			zassert_is_null(route, "Deleted route %d found", i);
+		}
+	}
+}
+
+static void test_route_lookup(void)
+{
+	check_routes();
+}
+
+static void run(const char *name, int spread)
+{
+	struct net_route_entry *route;
+	struct in6_addr *nexthop;
+	struct in6_addr dst;
+	uint32_t start, ms;
+	int i;
+
+	start = k_uptime_get_32();
+
+	for (i = 0; i < LOOKUP_COUNT; i++) {
+		route_dst(i % spread, i, &dst);
+
+		zassert_true(net_route_get_info(iface, &dst, &route, &nexthop),
+			     "No route");
+	}
+
+	ms = k_uptime_get_32() - start;
+
+	printk("route %s: %d routes, %d lookups in %u ms (%u lookups/ms)\n",
+	       name, ROUTE_COUNT, LOOKUP_COUNT, ms,
+	       ms ? LOOKUP_COUNT / ms : 0);
+}
+
+static void test_route_forwarding(void)
+{
+	run("all destinations", ROUTE_COUNT);
+	run("one destination", 1);
+}
+
+static void test_route_del(void)
+{
+	int i;
+
+	/* Remove every third route, both covering and covered ones */
+	for (i = 0; i < ROUTE_COUNT; i += 3) {
+		zassert_equal(net_route_del(routes[i]), 0,
+			      "Cannot delete route %d", i);
+		routes[i] = NULL;
+	}
+
+	check_routes();
+
+	for (i = 0; i < ROUTE_COUNT; i++) {
+		if (routes[i]) {
+			zassert_equal(net_route_del(routes[i]), 0,
+				      "Cannot delete route %d", i);
+			routes[i] = NULL;
+		}
+	}
+
+	check_routes();
+}
+
+void test_main(void)
+{
+	ztest_test_suite(route_benchmark,
+			 ztest_unit_test(test_setup),
+			 ztest_unit_test(test_route_lookup),
+			 ztest_unit_test(test_route_forwarding),
+			 ztest_unit_test(test_route_del));
+
+	ztest_run_test_suite(route_benchmark);
+}
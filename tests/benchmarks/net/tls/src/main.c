@@ -0,0 +1,261 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_test, LOG_LEVEL_INF);
+
+#include <ztest.h>
+
+#include <zephyr/net/net_ip.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/net/tls_credentials.h>
+
+#define SERVER_PORT 4242
+#define SERVER_STACK_SIZE 4096
+#define SERVER_PRIORITY K_PRIO_PREEMPT(8)
+
+#define PSK_TAG 1
+
+/* The client sends every message as a set of short buffers, the way a
+ * protocol header and its payload pieces usually are.
+ */
+#define MSG_SIZE 1024
+#define MSG_CHUNK 64
+#define MSG_CHUNKS (MSG_SIZE / MSG_CHUNK)
+#define MSG_COUNT 256
+
+static const char server_addr[] = "2001:db8::1";
+
+static const unsigned char psk[] = {
+	0x01, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+	0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f
+};
+static const char psk_id[] = "test_identity";
+
+static uint8_t client_buf[MSG_SIZE];
+static uint8_t server_buf[MSG_SIZE];
+
+static K_THREAD_STACK_DEFINE(server_stack, SERVER_STACK_SIZE);
+static struct k_thread server_thread;
+static K_SEM_DEFINE(server_ready, 0, 1);
+static K_SEM_DEFINE(server_done, 0, 1);
+
+static size_t server_received;
+static size_t server_errors;
+
+static void fill_pattern(uint8_t *buf, size_t len)
+{
+	for (size_t i = 0; i < len; i++) {
+		buf[i] = (uint8_t)i;
+	}
+}
+
+static int set_psk(int sock)
+{
+	sec_tag_t sec_tag_list[] = {
+		PSK_TAG
+	};
+
+	return setsockopt(sock, SOL_TLS, TLS_SEC_TAG_LIST, sec_tag_list,
+			  sizeof(sec_tag_list));
+}
+
+static int server_recv(int sock)
+{
+	int ret;
+
+	while (server_received < MSG_SIZE * MSG_COUNT) {
+		ret = recv(sock, server_buf, sizeof(server_buf), 0);
+		if (ret <= 0) {
+			return -EIO;
+		}
+
+		for (int i = 0; i < ret; i++) {
+			if (server_buf[i] !=
+			    (uint8_t)((server_received + i) % MSG_SIZE)) {
+				server_errors++;
+			}
+		}
+
+		server_received += ret;
+	}
+
+	return 0;
+}
+
+static int server_send(int sock)
+{
+	size_t pos;
+	int ret;
+
+	fill_pattern(server_buf, sizeof(server_buf));
+
+	for (int i = 0; i < MSG_COUNT; i++) {
+		pos = 0;
+
+		while (pos < sizeof(server_buf)) {
+			ret = send(sock, server_buf + pos,
+				   sizeof(server_buf) - pos, 0);
+			if (ret < 0) {
+				return -errno;
+			}
+
+			pos += ret;
+		}
+	}
+
+	return 0;
+}
+
+static void server(void *p1, void *p2, void *p3)
+{
+	struct sockaddr_in6 addr = {
+		.sin6_family = AF_INET6,
+		.sin6_port = htons(SERVER_PORT),
+	};
+	int sock, client, ret;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	inet_pton(AF_INET6, server_addr, &addr.sin6_addr);
+
+	sock = socket(AF_INET6, SOCK_STREAM, IPPROTO_TLS_1_2);
+	zassert_true(sock >= 0, "Cannot create server socket (%d)", errno);
+
+	ret = set_psk(sock);
+	zassert_equal(ret, 0, "Cannot set server PSK (%d)", errno);
+
+	ret = bind(sock, (struct sockaddr *)&addr, sizeof(addr));
+	zassert_equal(ret, 0, "Cannot bind (%d)", errno);
+
+	ret = listen(sock, 1);
+	zassert_equal(ret, 0, "Cannot listen (%d)", errno);
+
+	k_sem_give(&server_ready);
+
+	client = accept(sock, NULL, NULL);
+	zassert_true(client >= 0, "Cannot accept (%d)", errno);
+
+	ret = server_recv(client);
+	zassert_equal(ret, 0, "Cannot receive (%d)", ret);
+
+	k_sem_give(&server_done);
+
+	ret = server_send(client);
+	zassert_equal(ret, 0, "Cannot send (%d)", ret);
+
+	k_sem_take(&server_done, K_FOREVER);
+
+	close(client);
+	close(sock);
+}
+
+static void print_result(const char *name, size_t bytes, uint32_t ms)
+{
+	printk("tls %s: %zu bytes in %u ms (%u kB/s)\n", name, bytes,
+	       ms, ms ? (uint32_t)(bytes / ms) : 0);
+}
+
+static void test_tls_throughput(void)
+{
+	struct sockaddr_in6 addr = {
+		.sin6_family = AF_INET6,
+		.sin6_port = htons(SERVER_PORT),
+	};
+	struct iovec iov[MSG_CHUNKS];
+	struct msghdr msg = {
+		.msg_iov = iov,
+		.msg_iovlen = ARRAY_SIZE(iov),
+	};
+	size_t received = 0;
+	uint32_t tx_ms, rx_ms;
+	int64_t start;
+	int sock, ret, i;
+
+	fill_pattern(client_buf, sizeof(client_buf));
+
+	for (i = 0; i < ARRAY_SIZE(iov); i++) {
+		iov[i].iov_base = client_buf + i * MSG_CHUNK;
+		iov[i].iov_len = MSG_CHUNK;
+	}
+
+	(void)tls_credential_delete(PSK_TAG, TLS_CREDENTIAL_PSK);
+	(void)tls_credential_delete(PSK_TAG, TLS_CREDENTIAL_PSK_ID);
+
+	ret = tls_credential_add(PSK_TAG, TLS_CREDENTIAL_PSK, psk, sizeof(psk));
+	zassert_equal(ret, 0, "Cannot register PSK (%d)", ret);
+
+	ret = tls_credential_add(PSK_TAG, TLS_CREDENTIAL_PSK_ID, psk_id,
+				 strlen(psk_id));
+	zassert_equal(ret, 0, "Cannot register PSK ID (%d)", ret);
+
+	k_thread_create(&server_thread, server_stack,
+			K_THREAD_STACK_SIZEOF(server_stack), server,
+			NULL, NULL, NULL, SERVER_PRIORITY, 0, K_NO_WAIT);
+
+	k_sem_take(&server_ready, K_FOREVER);
+
+	inet_pton(AF_INET6, server_addr, &addr.sin6_addr);
+
+	sock = socket(AF_INET6, SOCK_STREAM, IPPROTO_TLS_1_2);
+	zassert_true(sock >= 0, "Cannot create socket (%d)", errno);
+
+	ret = set_psk(sock);
+	zassert_equal(ret, 0, "Cannot set client PSK (%d)", errno);
+
+	ret = connect(sock, (struct sockaddr *)&addr, sizeof(addr));
+	zassert_equal(ret, 0, "Cannot connect (%d)", errno);
+
+	start = k_uptime_get();
+
+	for (i = 0; i < MSG_COUNT; i++) {
+		ret = sendmsg(sock, &msg, 0);
+		zassert_equal(ret, MSG_SIZE, "Cannot send (%d)", errno);
+	}
+
+	k_sem_take(&server_done, K_FOREVER);
+
+	tx_ms = k_uptime_get() - start;
+	start = k_uptime_get();
+
+	while (received < MSG_SIZE * MSG_COUNT) {
+		ret = recv(sock, client_buf, sizeof(client_buf), 0);
+		zassert_true(ret > 0, "Cannot receive (%d)", errno);
+
+		for (i = 0; i < ret; i++) {
+			zassert_equal(client_buf[i],
+				      (uint8_t)((received + i) % MSG_SIZE),
+				      "Invalid data at %zu", received + i);
+		}
+
+		received += ret;
+	}
+
+	rx_ms = k_uptime_get() - start;
+
+	k_sem_give(&server_done);
+
+	print_result("sendmsg TX", server_received, tx_ms);
+	print_result("RX", received, rx_ms);
+
+	zassert_equal(server_received, MSG_SIZE * MSG_COUNT,
+		      "Server received %zu bytes", server_received);
+	zassert_equal(server_errors, 0, "Server got %zu invalid bytes",
+		      server_errors);
+
+	close(sock);
+	k_thread_join(&server_thread, K_FOREVER);
+}
+
+void test_main(void)
+{
+	ztest_test_suite(tls_benchmark,
+			 ztest_unit_test(test_tls_throughput));
+
+	ztest_run_test_suite(tls_benchmark);
+}
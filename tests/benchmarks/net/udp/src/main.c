@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_test, LOG_LEVEL_INF);
+
+#include <ztest.h>
+
+#include <zephyr/net/socket.h>
+
+#define PORT 4242
+#define ITERATIONS 10000
+
+static int tx_sock, rx_sock;
+
+/* Connected sockets sending datagrams to each other over the loopback */
+static void run(size_t len)
+{
+	static uint8_t tx_buf[512], rx_buf[512];
+	uint32_t start, cycles;
+	ssize_t ret;
+	int i, j;
+
+	for (j = 0; j < len; j++) {
+		tx_buf[j] = j;
+	}
+
+	start = k_cycle_get_32();
+
+	for (i = 0; i < ITERATIONS; i++) {
+		tx_buf[0] = i;
+
+		ret = send(tx_sock, tx_buf, len, 0);
+		zassert_equal(ret, len, "send failed (%d)", errno);
+
+		ret = recv(rx_sock, rx_buf, sizeof(rx_buf), 0);
+		zassert_equal(ret, len, "recv failed (%d)", errno);
+		zassert_mem_equal(rx_buf, tx_buf, len, "Invalid data");
+	}
+
+	cycles = k_cycle_get_32() - start;
+
+	printk("udp send %zu: %u packets in %u cycles (%u cycles/packet)\n",
+	       len, ITERATIONS, cycles, cycles / ITERATIONS);
+}
+
+static int connected_socket(uint16_t port, uint16_t peer_port)
+{
+	struct sockaddr_in addr = {
+		.sin_family = AF_INET,
+		.sin_addr = { { { 127, 0, 0, 1 } } },
+	};
+	int sock;
+
+	sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	zassert_true(sock >= 0, "Cannot create socket (%d)", errno);
+
+	addr.sin_port = htons(port);
+	zassert_ok(bind(sock, (struct sockaddr *)&addr, sizeof(addr)),
+		   "Cannot bind (%d)", errno);
+
+	addr.sin_port = htons(peer_port);
+	zassert_ok(connect(sock, (struct sockaddr *)&addr, sizeof(addr)),
+		   "Cannot connect (%d)", errno);
+
+	return sock;
+}
+
+static void test_setup(void)
+{
+	tx_sock = connected_socket(PORT, PORT + 1);
+	rx_sock = connected_socket(PORT + 1, PORT);
+}
+
+static void test_send(void)
+{
+	run(1);
+	run(32);
+	run(512);
+}
+
+static void test_teardown(void)
+{
+	zassert_ok(close(tx_sock), "Cannot close (%d)", errno);
+	zassert_ok(close(rx_sock), "Cannot close (%d)", errno);
+}
+
+void test_main(void)
+{
+	ztest_test_suite(udp_benchmark,
+			 ztest_unit_test(test_setup),
+			 ztest_unit_test(test_send),
+			 ztest_unit_test(test_teardown));
+
+	ztest_run_test_suite(udp_benchmark);
+}
@@ -0,0 +1,342 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_test, LOG_LEVEL_INF);
+
+#include <ztest.h>
+
+#include <zephyr/net/net_ip.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/net/websocket.h>
+#include <zephyr/sys/base64.h>
+#include <zephyr/sys/byteorder.h>
+#include <mbedtls/sha1.h>
+
+#include "websocket_internal.h"
+
+#define SERVER_PORT 8080
+#define SERVER_STACK_SIZE 2048
+#define SERVER_PRIORITY K_PRIO_PREEMPT(8)
+
+#define MSG_SIZE 1024
+#define MSG_COUNT 256
+
+static const char server_addr[] = "2001:db8::1";
+
+static uint8_t client_tmp_buf[512];
+static uint8_t client_buf[MSG_SIZE];
+static uint8_t server_buf[MSG_SIZE + 16];
+static uint8_t server_payload[MSG_SIZE];
+
+static K_THREAD_STACK_DEFINE(server_stack, SERVER_STACK_SIZE);
+static struct k_thread server_thread;
+static K_SEM_DEFINE(server_ready, 0, 1);
+static K_SEM_DEFINE(server_done, 0, 1);
+
+static size_t server_received;
+static uint32_t rx_ms;
+
+static int recv_all(int sock, uint8_t *buf, size_t len)
+{
+	size_t pos = 0;
+	int ret;
+
+	while (pos < len) {
+		ret = recv(sock, buf + pos, len - pos, 0);
+		if (ret <= 0) {
+			return -EIO;
+		}
+
+		pos += ret;
+	}
+
+	return 0;
+}
+
+static int send_all(int sock, const uint8_t *buf, size_t len)
+{
+	size_t pos = 0;
+	int ret;
+
+	while (pos < len) {
+		ret = send(sock, buf + pos, len - pos, 0);
+		if (ret < 0) {
+			return -errno;
+		}
+
+		pos += ret;
+	}
+
+	return 0;
+}
+
+/* Read the HTTP upgrade request and reply with the handshake response */
+static int server_handshake(int sock)
+{
+	static const char key_hdr[] = "Sec-WebSocket-Key: ";
+	char req[512];
+	char rsp[160];
+	char accept[32];
+	char key[64];
+	uint8_t sha1[WS_SHA1_OUTPUT_LEN];
+	size_t pos = 0, olen;
+	char *start, *end;
+	int ret;
+
+	do {
+		ret = recv(sock, req + pos, sizeof(req) - 1 - pos, 0);
+		if (ret <= 0) {
+			return -EIO;
+		}
+
+		pos += ret;
+		req[pos] = '\0';
+	} while (strstr(req, "\r\n\r\n") == NULL && pos < sizeof(req) - 1);
+
+	start = strstr(req, key_hdr);
+	if (start == NULL) {
+		return -EINVAL;
+	}
+
+	start += sizeof(key_hdr) - 1;
+	end = strstr(start, "\r\n");
+	if (end == NULL || end - start + sizeof(WS_MAGIC) > sizeof(key)) {
+		return -EINVAL;
+	}
+
+	memcpy(key, start, end - start);
+	memcpy(key + (end - start), WS_MAGIC, sizeof(WS_MAGIC));
+
+	mbedtls_sha1(key, strlen(key), sha1);
+
+	ret = base64_encode(accept, sizeof(accept), &olen, sha1, sizeof(sha1));
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = snprintk(rsp, sizeof(rsp),
+		       "HTTP/1.1 101 Switching Protocols\r\n"
+		       "Upgrade: websocket\r\n"
+		       "Connection: Upgrade\r\n"
+		       "Sec-WebSocket-Accept: %s\r\n\r\n", accept);
+
+	return send_all(sock, rsp, ret);
+}
+
+/* Receive the client frames and count the payload bytes */
+static int server_recv_frames(int sock)
+{
+	uint64_t len;
+	int ret;
+
+	while (server_received < MSG_SIZE * MSG_COUNT) {
+		ret = recv_all(sock, server_buf, 2);
+		if (ret < 0) {
+			return ret;
+		}
+
+		len = server_buf[1] & 0x7f;
+
+		if (len == 126) {
+			ret = recv_all(sock, server_buf, 2);
+			len = sys_get_be16(server_buf);
+		} else if (len == 127) {
+			ret = recv_all(sock, server_buf, 8);
+			len = sys_get_be64(server_buf);
+		}
+
+		/* Skip the masking key, the data is only counted */
+		ret = recv_all(sock, server_buf, sizeof(uint32_t));
+		if (ret < 0 || len > MSG_SIZE) {
+			return -EIO;
+		}
+
+		ret = recv_all(sock, server_buf, len);
+		if (ret < 0) {
+			return ret;
+		}
+
+		server_received += len;
+	}
+
+	return 0;
+}
+
+/* Send masked frames to the client so that it needs to unmask them */
+static int server_send_frames(int sock)
+{
+	int ret, i;
+
+	server_buf[0] = BIT(7) | WEBSOCKET_OPCODE_DATA_BINARY;
+	server_buf[1] = BIT(7) | 126;
+	sys_put_be16(MSG_SIZE, &server_buf[2]);
+	sys_put_be32(0x12345678, &server_buf[4]);
+
+	for (i = 0; i < MSG_SIZE; i++) {
+		server_payload[i] = (uint8_t)i ^ server_buf[4 + i % 4];
+	}
+
+	for (i = 0; i < MSG_COUNT; i++) {
+		ret = send_all(sock, server_buf, 8);
+		if (ret < 0) {
+			return ret;
+		}
+
+		ret = send_all(sock, server_payload, MSG_SIZE);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	return 0;
+}
+
+static void server(void *p1, void *p2, void *p3)
+{
+	struct sockaddr_in6 addr = {
+		.sin6_family = AF_INET6,
+		.sin6_port = htons(SERVER_PORT),
+	};
+	int sock, client, ret;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	inet_pton(AF_INET6, server_addr, &addr.sin6_addr);
+
+	sock = socket(AF_INET6, SOCK_STREAM, IPPROTO_TCP);
+	zassert_true(sock >= 0, "Cannot create server socket (%d)", errno);
+
+	ret = bind(sock, (struct sockaddr *)&addr, sizeof(addr));
+	zassert_equal(ret, 0, "Cannot bind (%d)", errno);
+
+	ret = listen(sock, 1);
+	zassert_equal(ret, 0, "Cannot listen (%d)", errno);
+
+	k_sem_give(&server_ready);
+
+	client = accept(sock, NULL, NULL);
+	zassert_true(client >= 0, "Cannot accept (%d)", errno);
+
+	ret = server_handshake(client);
+	zassert_equal(ret, 0, "Handshake failed (%d)", ret);
+
+	ret = server_recv_frames(client);
+	zassert_equal(ret, 0, "Cannot receive frames (%d)", ret);
+
+	k_sem_give(&server_done);
+
+	ret = server_send_frames(client);
+	zassert_equal(ret, 0, "Cannot send frames (%d)", ret);
+
+	k_sem_take(&server_done, K_FOREVER);
+
+	close(client);
+	close(sock);
+}
+
+static void print_result(const char *name, size_t bytes, uint32_t ms)
+{
+	printk("websocket %s: %zu bytes in %u ms (%u kB/s)\n", name, bytes,
+	       ms, ms ? (uint32_t)(bytes / ms) : 0);
+}
+
+static void test_websocket_throughput(void)
+{
+	struct sockaddr_in6 addr = {
+		.sin6_family = AF_INET6,
+		.sin6_port = htons(SERVER_PORT),
+	};
+	struct websocket_request req = {
+		.host = server_addr,
+		.url = "/",
+		.tmp_buf = client_tmp_buf,
+		.tmp_buf_len = sizeof(client_tmp_buf),
+	};
+	uint64_t remaining;
+	uint32_t message_type;
+	size_t received = 0;
+	int64_t start;
+	uint32_t tx_ms;
+	int sock, ws_sock, ret, i;
+
+	for (i = 0; i < sizeof(client_buf); i++) {
+		client_buf[i] = i;
+	}
+
+	k_thread_create(&server_thread, server_stack,
+			K_THREAD_STACK_SIZEOF(server_stack), server,
+			NULL, NULL, NULL, SERVER_PRIORITY, 0, K_NO_WAIT);
+
+	k_sem_take(&server_ready, K_FOREVER);
+
+	inet_pton(AF_INET6, server_addr, &addr.sin6_addr);
+
+	sock = socket(AF_INET6, SOCK_STREAM, IPPROTO_TCP);
+	zassert_true(sock >= 0, "Cannot create socket (%d)", errno);
+
+	ret = connect(sock, (struct sockaddr *)&addr, sizeof(addr));
+	zassert_equal(ret, 0, "Cannot connect (%d)", errno);
+
+	ws_sock = websocket_connect(sock, &req, 1000, NULL);
+	zassert_true(ws_sock >= 0, "Cannot connect websocket (%d)", ws_sock);
+
+	start = k_uptime_get();
+
+	for (i = 0; i < MSG_COUNT; i++) {
+		ret = websocket_send_msg(ws_sock, client_buf, MSG_SIZE,
+					 WEBSOCKET_OPCODE_DATA_BINARY,
+					 true, true, SYS_FOREVER_MS);
+		zassert_equal(ret, MSG_SIZE, "Cannot send (%d)", ret);
+	}
+
+	k_sem_take(&server_done, K_FOREVER);
+
+	tx_ms = k_uptime_get() - start;
+	start = k_uptime_get();
+
+	while (received < MSG_SIZE * MSG_COUNT) {
+		ret = websocket_recv_msg(ws_sock, client_buf, MSG_SIZE,
+					 &message_type, &remaining,
+					 SYS_FOREVER_MS);
+		if (ret == -EAGAIN) {
+			continue;
+		}
+
+		zassert_true(ret >= 0, "Cannot receive (%d)", ret);
+
+		for (i = 0; i < ret; i++) {
+			zassert_equal(client_buf[i],
+				      (uint8_t)((received + i) % MSG_SIZE),
+				      "Invalid data at %zu", received + i);
+		}
+
+		received += ret;
+	}
+
+	rx_ms = k_uptime_get() - start;
+
+	k_sem_give(&server_done);
+
+	print_result("masked TX", server_received, tx_ms);
+	print_result("masked RX", received, rx_ms);
+
+	zassert_equal(server_received, MSG_SIZE * MSG_COUNT,
+		      "Server received %zu bytes", server_received);
+
+	websocket_disconnect(ws_sock);
+	k_thread_join(&server_thread, K_FOREVER);
+}
+
+void test_main(void)
+{
+	ztest_test_suite(websocket_benchmark,
+			 ztest_unit_test(test_websocket_throughput));
+
+	ztest_run_test_suite(websocket_benchmark);
+}
@@ -36,6 +36,7 @@ extern void test_atomic(void);
 extern void test_threads_access_atomic(void);
 extern void test_errno(void);
 extern void test_printk(void);
+extern void test_printk_str(void);
 extern void test_timeout_order(void);
 extern void test_clock_cycle_32(void);
 extern void test_clock_cycle_64(void);
@@ -76,6 +77,11 @@ void test_printk(void)
 {
 	ztest_test_skip();
 }
+
+void test_printk_str(void)
+{
+	ztest_test_skip();
+}
 #endif
 
 /**
@@ -158,6 +164,7 @@ void test_main(void)
 			 ztest_unit_test(test_bitarray_alloc_free),
 			 ztest_unit_test(test_bitarray_region_set_clear),
 			 ztest_unit_test(test_printk),
+			 ztest_unit_test(test_printk_str),
 			 ztest_1cpu_unit_test(test_timeout_order),
 			 ztest_user_unit_test(test_clock_uptime),
 			 ztest_unit_test(test_clock_cycle_32),
@@ -153,6 +153,44 @@ void test_printk(void)
 	pk_console[count] = '\0';
 	zassert_true((strcmp(pk_console, expected) == 0), "snprintk failed");
 }
+
+/**
+ * @brief Test printk() of strings without conversion specifiers
+ *
+ * @details Format strings without conversion specifiers are written without
+ * the formatter, check that the output is the same as with it.
+ *
+ * @see printk()
+ */
+void test_printk_str(void)
+{
+	const char *arg = "runtime";
+	int (*hook)(int);
+
+	if (IS_ENABLED(CONFIG_LOG_PRINTK)) {
+		ztest_test_skip();
+	}
+
+	/* Hook may be still installed by test_printk() */
+	hook = __printk_get_hook();
+	if (hook != ram_console_out) {
+		_old_char_out = hook;
+	}
+	__printk_hook_install(ram_console_out);
+
+	pos = 0;
+	(void)memset(pk_console, 0, sizeof(pk_console));
+
+	printk("plain string\n");
+	printk("100%%\n");
+	printk("%s %%\n", arg);
+
+	__printk_hook_install(hook);
+
+	pk_console[pos] = '\0';
+	zassert_true((strcmp(pk_console, "plain string\n100%\nruntime %\n") == 0),
+		     "printk failed");
+}
 /**
  * @}
  */
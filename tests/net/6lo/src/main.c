@@ -1065,7 +1065,42 @@ static struct net_6lo_data test_data_25 = {
 
 #endif
 
-static void test_6lo(struct net_6lo_data *data)
+/* Move the compressed headers to a new buffer right after a copy of the
+ * link layer source address, like in a received 802.15.4 frame. Only a few
+ * bytes of headroom can then be overwritten when uncompressing.
+ */
+#define LLADDR_GAP 4
+
+static void move_after_lladdr(struct net_pkt *pkt)
+{
+	struct net_buf *old = pkt->buffer;
+	struct net_buf *frag;
+	size_t len;
+
+	frag = net_pkt_get_frag(pkt, K_FOREVER);
+	zassert_not_null(frag, "failed to get frag");
+
+	len = MIN(old->len, frag->size / 2);
+
+	net_buf_reserve(frag, sizeof(src_mac) + LLADDR_GAP);
+	net_buf_add_mem(frag, old->data, len);
+	net_buf_pull(old, len);
+
+	memcpy(frag->__buf, src_mac, sizeof(src_mac));
+	net_pkt_lladdr_src(pkt)->addr = frag->__buf;
+
+	if (old->len) {
+		frag->frags = old;
+	} else {
+		frag->frags = old->frags;
+		old->frags = NULL;
+		net_buf_unref(old);
+	}
+
+	pkt->buffer = frag;
+}
+
+static void test_6lo(struct net_6lo_data *data, bool lladdr)
 {
 	struct net_pkt *pkt;
 	int diff;
@@ -1092,6 +1127,10 @@ static void test_6lo(struct net_6lo_data *data)
 	diff = net_6lo_uncompress_hdr_diff(pkt);
 	zassert_true(diff == data->hdr_diff, "unexpected HDR diff");
 
+	if (lladdr) {
+		move_after_lladdr(pkt);
+	}
+
 	zassert_true(net_6lo_uncompress(pkt),
 		     "uncompression failed");
 #if DEBUG > 0
@@ -1142,10 +1181,21 @@ static const struct {
 #endif
 };
 
-void test_loop(void)
+static void run_tests(bool lladdr)
 {
 	int count;
 
+	for (count = 0; count < ARRAY_SIZE(tests); count++) {
+		TC_START(tests[count].name);
+
+		test_6lo(tests[count].data, lladdr);
+	}
+	net_pkt_print();
+}
+
+void test_loop(void)
+{
+
 	if (IS_ENABLED(CONFIG_NET_TC_THREAD_COOPERATIVE)) {
 		k_thread_priority_set(k_current_get(),
 				K_PRIO_COOP(CONFIG_NUM_COOP_PRIORITIES - 1));
@@ -1160,17 +1210,19 @@ void test_loop(void)
 			    &ctx2);
 #endif
 
-	for (count = 0; count < ARRAY_SIZE(tests); count++) {
-		TC_START(tests[count].name);
+	run_tests(false);
+}
 
-		test_6lo(tests[count].data);
-	}
-	net_pkt_print();
+/* Same as test_loop() but with the link layer address in the headroom */
+void test_loop_lladdr(void)
+{
+	run_tests(true);
 }
 
 /*test case main entry*/
 void test_main(void)
 {
-	ztest_test_suite(test_6lo, ztest_unit_test(test_loop));
+	ztest_test_suite(test_6lo, ztest_unit_test(test_loop),
+			 ztest_unit_test(test_loop_lladdr));
 	ztest_run_test_suite(test_6lo);
 }
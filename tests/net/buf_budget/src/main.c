@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_test, CONFIG_NET_PKT_LOG_LEVEL);
+
+#include <zephyr/types.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <errno.h>
+
+#include <ztest.h>
+
+#include <zephyr/net/dummy.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_ip.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/net/net_context.h>
+
+#include "net_private.h"
+
+#define BUF_SIZE CONFIG_NET_BUF_DATA_SIZE
+#define RX_COUNT CONFIG_NET_BUF_RX_COUNT
+
+static struct net_if *iface1;
+static struct net_if *iface2;
+static struct net_pkt *pkts[RX_COUNT];
+
+static int dummy_dev_init(const struct device *dev)
+{
+	return 0;
+}
+
+static int dummy_send(const struct device *dev, struct net_pkt *pkt)
+{
+	return 0;
+}
+
+static void dummy_iface_init(struct net_if *iface)
+{
+	static uint8_t mac[] = { 0x00, 0x00, 0x5e, 0x00, 0x53, 0x01 };
+
+	net_if_set_link_addr(iface, mac, sizeof(mac), NET_LINK_ETHERNET);
+}
+
+static struct dummy_api dummy_api = {
+	.iface_api.init = dummy_iface_init,
+	.send = dummy_send,
+};
+
+NET_DEVICE_INIT_INSTANCE(budget_test_1, "budget_test_1", 1, dummy_dev_init,
+			 NULL, NULL, NULL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT,
+			 &dummy_api, DUMMY_L2, NET_L2_GET_CTX_TYPE(DUMMY_L2),
+			 1500);
+
+NET_DEVICE_INIT_INSTANCE(budget_test_2, "budget_test_2", 2, dummy_dev_init,
+			 NULL, NULL, NULL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT,
+			 &dummy_api, DUMMY_L2, NET_L2_GET_CTX_TYPE(DUMMY_L2),
+			 1500);
+
+static struct net_pkt *rx_alloc(struct net_if *iface, size_t bufs)
+{
+	return net_pkt_rx_alloc_with_buffer(iface, bufs * BUF_SIZE, AF_UNSPEC,
+					    0, K_NO_WAIT);
+}
+
+static void free_pkts(void)
+{
+	int i;
+
+	for (i = 0; i < ARRAY_SIZE(pkts); i++) {
+		if (pkts[i]) {
+			net_pkt_unref(pkts[i]);
+			pkts[i] = NULL;
+		}
+	}
+}
+
+static void check_pool(uint16_t used, uint16_t unused_reserved)
+{
+	struct net_pkt_budget_info info;
+
+	net_pkt_budget_get_info(false, &info);
+
+	zassert_equal(info.total, RX_COUNT, "Invalid pool size");
+	zassert_equal(info.used, used, "Invalid pool usage %u", info.used);
+	zassert_equal(info.unused_reserved, unused_reserved,
+		      "Invalid reservation %u", info.unused_reserved);
+}
+
+static void test_setup(void)
+{
+	iface1 = net_if_get_by_index(1);
+	iface2 = net_if_get_by_index(2);
+
+	zassert_not_null(iface1, "No interface 1");
+	zassert_not_null(iface2, "No interface 2");
+
+	check_pool(0, 0);
+}
+
+static void test_limit(void)
+{
+	struct net_buf_budget *budget = &iface1->rx_budget;
+	uint32_t denied = budget->denied;
+
+	zassert_ok(net_if_set_buf_budget(iface1, false, 0, 2),
+		   "Cannot set budget");
+
+	pkts[0] = rx_alloc(iface1, 2);
+	zassert_not_null(pkts[0], "Cannot allocate within the limit");
+	zassert_equal(budget->used, 2, "Invalid usage");
+
+	pkts[1] = rx_alloc(iface1, 1);
+	zassert_is_null(pkts[1], "Allocated over the limit");
+	zassert_equal(budget->denied, denied + 1, "Denial not counted");
+
+	/* Other interfaces are not affected */
+	pkts[1] = rx_alloc(iface2, 1);
+	zassert_not_null(pkts[1], "Cannot allocate on other interface");
+
+	check_pool(3, 0);
+
+	free_pkts();
+
+	zassert_equal(budget->used, 0, "Buffers not returned");
+	zassert_equal(budget->peak, 2, "Invalid peak");
+	check_pool(0, 0);
+
+	zassert_ok(net_if_set_buf_budget(iface1, false, 0, 0),
+		   "Cannot clear budget");
+}
+
+static void test_reserve(void)
+{
+	int i;
+
+	zassert_equal(net_if_set_buf_budget(iface1, false, 3, 2), -EINVAL,
+		      "Reservation over the limit accepted");
+	zassert_ok(net_if_set_buf_budget(iface1, false, 3, 0),
+		   "Cannot reserve");
+	zassert_equal(net_if_set_buf_budget(iface2, false, RX_COUNT - 2, 0),
+		      -ENOMEM, "Reserved more than there is");
+
+	check_pool(0, 3);
+
+	/* The other interface gets only the shared buffers */
+	for (i = 0; i < RX_COUNT - 3; i++) {
+		pkts[i] = rx_alloc(iface2, 1);
+		zassert_not_null(pkts[i], "Cannot allocate shared buffer %d",
+				 i);
+	}
+
+	zassert_is_null(rx_alloc(iface2, 1), "Reserved buffer taken");
+
+	/* While the reserved ones are still there */
+	pkts[i++] = rx_alloc(iface1, 2);
+	zassert_not_null(pkts[i - 1], "Cannot allocate reserved buffers");
+	check_pool(RX_COUNT - 1, 1);
+
+	pkts[i++] = rx_alloc(iface1, 1);
+	zassert_not_null(pkts[i - 1], "Cannot allocate reserved buffer");
+	check_pool(RX_COUNT, 0);
+
+	free_pkts();
+	check_pool(0, 3);
+
+	/* Shrinking the reservation gives the buffers back to everybody */
+	zassert_ok(net_if_set_buf_budget(iface1, false, 0, 0),
+		   "Cannot clear reservation");
+	check_pool(0, 0);
+
+	for (i = 0; i < RX_COUNT; i++) {
+		pkts[i] = rx_alloc(iface2, 1);
+		zassert_not_null(pkts[i], "Cannot allocate buffer %d", i);
+	}
+
+	free_pkts();
+}
+
+static void test_context(void)
+{
+	struct sockaddr_in addr = {
+		.sin_family = AF_INET,
+		.sin_port = htons(4242),
+		.sin_addr = { { { 192, 0, 2, 2 } } },
+	};
+	struct sockaddr_in my_addr = {
+		.sin_family = AF_INET,
+		.sin_addr = { { { 192, 0, 2, 1 } } },
+	};
+	static uint8_t data[3 * BUF_SIZE];
+	struct net_context *ctx;
+	int ret;
+
+	zassert_not_null(net_if_ipv4_addr_add(iface1, &my_addr.sin_addr,
+					      NET_ADDR_MANUAL,
+					      0), "Cannot add address");
+
+	zassert_ok(net_context_get(AF_INET, SOCK_DGRAM, IPPROTO_UDP, &ctx),
+		   "Cannot get context");
+	zassert_equal(ctx->tx_budget.limit, CONFIG_NET_PKT_BUDGET_CONTEXT_LIMIT,
+		      "Default limit not set");
+
+	zassert_ok(net_context_bind(ctx, (struct sockaddr *)&my_addr,
+				    sizeof(my_addr)), "Cannot bind");
+
+	/* Does not fit the default limit */
+	ret = net_context_sendto(ctx, data, sizeof(data),
+				 (struct sockaddr *)&addr, sizeof(addr),
+				 NULL, K_NO_WAIT, NULL);
+	zassert_equal(ret, -ENOBUFS, "Sent over the limit (%d)", ret);
+	zassert_equal(ctx->tx_budget.denied, 1, "Denial not counted");
+
+	zassert_ok(net_context_set_buf_budget(ctx, 0, 0),
+		   "Cannot remove limit");
+
+	ret = net_context_sendto(ctx, data, sizeof(data),
+				 (struct sockaddr *)&addr, sizeof(addr),
+				 NULL, K_NO_WAIT, NULL);
+	zassert_equal(ret, sizeof(data), "Cannot send (%d)", ret);
+	zassert_true(ctx->tx_budget.peak > CONFIG_NET_PKT_BUDGET_CONTEXT_LIMIT,
+		     "Invalid peak");
+
+	zassert_ok(net_context_set_buf_budget(ctx, 2, 0), "Cannot reserve");
+
+	net_context_put(ctx);
+
+	zassert_equal(net_context_set_buf_budget(ctx, 2, 0), -EBADF,
+		      "Budget set on released context");
+
+	/* The reservation is given back when the context is released */
+	zassert_ok(net_if_set_buf_budget(iface1, true,
+					 CONFIG_NET_BUF_TX_COUNT, 0),
+		   "Context reservation not released");
+	zassert_ok(net_if_set_buf_budget(iface1, true, 0, 0),
+		   "Cannot clear reservation");
+}
+
+void test_main(void)
+{
+	ztest_test_suite(net_buf_budget_test,
+			 ztest_unit_test(test_setup),
+			 ztest_unit_test(test_limit),
+			 ztest_unit_test(test_reserve),
+			 ztest_unit_test(test_context));
+
+	ztest_run_test_suite(net_buf_budget_test);
+}
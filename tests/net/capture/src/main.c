@@ -0,0 +1,343 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_test, CONFIG_NET_CAPTURE_LOG_LEVEL);
+
+#include <zephyr/types.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include <errno.h>
+
+#include <ztest.h>
+
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/net/dummy.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/net/capture.h>
+
+#define SNAPLEN CONFIG_NET_CAPTURE_RING_SNAPLEN
+#define FRAMES CONFIG_NET_CAPTURE_RING_FRAMES
+
+#define ETH_TYPE_OFFSET 12
+#define ETH_HDR_LEN 14
+#define TEST_PORT 4242
+
+static struct net_if *iface;
+static uint8_t data[2 * SNAPLEN];
+
+static int dummy_dev_init(const struct device *dev)
+{
+	return 0;
+}
+
+static int dummy_send(const struct device *dev, struct net_pkt *pkt)
+{
+	return 0;
+}
+
+static void dummy_iface_init(struct net_if *iface)
+{
+	static uint8_t mac[] = { 0x00, 0x00, 0x5e, 0x00, 0x53, 0x01 };
+
+	net_if_set_link_addr(iface, mac, sizeof(mac), NET_LINK_ETHERNET);
+}
+
+static struct dummy_api dummy_api = {
+	.iface_api.init = dummy_iface_init,
+	.send = dummy_send,
+};
+
+NET_DEVICE_INIT(capture_test, "capture_test", dummy_dev_init, NULL, NULL,
+		NULL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT, &dummy_api,
+		DUMMY_L2, NET_L2_GET_CTX_TYPE(DUMMY_L2), 1500);
+
+/* Ethernet frame with an IPv4 header and a UDP header, the rest of the
+ * data is a running counter.
+ */
+static void make_data(uint16_t type, uint8_t proto, uint16_t port)
+{
+	int i;
+
+	for (i = 0; i < sizeof(data); i++) {
+		data[i] = i;
+	}
+
+	sys_put_be16(type, &data[ETH_TYPE_OFFSET]);
+	data[ETH_HDR_LEN] = 0x45;
+	data[ETH_HDR_LEN + 9] = proto;
+	sys_put_be16(port, &data[ETH_HDR_LEN + 20 + 2]);
+}
+
+static void capture(size_t len)
+{
+	struct net_pkt *pkt;
+
+	pkt = net_pkt_rx_alloc_with_buffer(iface, len, AF_UNSPEC, 0,
+					   K_NO_WAIT);
+	zassert_not_null(pkt, "Cannot allocate pkt");
+
+	zassert_ok(net_pkt_write(pkt, data, len), "Cannot write data");
+
+	net_capture_pkt(iface, pkt);
+
+	net_pkt_unref(pkt);
+}
+
+static void check_frame(size_t len, size_t caplen)
+{
+	struct net_capture_frame *frame;
+
+	frame = net_capture_ring_get(K_NO_WAIT);
+	zassert_not_null(frame, "No frame");
+
+	zassert_equal(frame->len, len, "Invalid length");
+	zassert_equal(frame->caplen, caplen, "Invalid capture length");
+	zassert_equal(frame->iface, net_if_get_by_iface(iface),
+		      "Invalid interface");
+	zassert_mem_equal(frame->data, data, caplen, "Invalid data");
+
+	net_capture_ring_release(frame);
+}
+
+static void test_setup(void)
+{
+	iface = net_if_get_first_by_type(&NET_L2_GET_NAME(DUMMY));
+	zassert_not_null(iface, "No interface");
+
+	make_data(0x0800, 17, TEST_PORT);
+}
+
+static void test_ring(void)
+{
+	struct net_capture_ring_stats stats;
+
+	/* Nothing is captured before the ring is enabled */
+	capture(32);
+	zassert_is_null(net_capture_ring_get(K_NO_WAIT), "Frame captured");
+
+	zassert_ok(net_capture_ring_enable(iface), "Cannot enable");
+	zassert_equal(net_capture_ring_enable(iface), -EALREADY,
+		      "Enabled twice");
+
+	capture(32);
+	capture(SNAPLEN);
+	capture(SNAPLEN + 1);
+
+	check_frame(32, 32);
+	check_frame(SNAPLEN, SNAPLEN);
+	check_frame(SNAPLEN + 1, SNAPLEN);
+
+	zassert_is_null(net_capture_ring_get(K_NO_WAIT), "Extra frame");
+
+	net_capture_ring_get_stats(&stats);
+	zassert_equal(stats.captured, 3, "Invalid captured count");
+	zassert_equal(stats.dropped, 0, "Invalid dropped count");
+}
+
+static void test_ring_full(void)
+{
+	struct net_capture_ring_stats before, after;
+	int i;
+
+	net_capture_ring_get_stats(&before);
+
+	for (i = 0; i < FRAMES + 2; i++) {
+		capture(40);
+	}
+
+	net_capture_ring_get_stats(&after);
+	zassert_equal(after.captured - before.captured, FRAMES,
+		      "Invalid captured count");
+	zassert_equal(after.dropped - before.dropped, 2,
+		      "Invalid dropped count");
+
+	/* Wrap around the end of the ring */
+	for (i = 0; i < FRAMES; i++) {
+		check_frame(40, 40);
+	}
+
+	capture(41);
+	check_frame(41, 41);
+}
+
+static void test_filter_invalid(void)
+{
+	static const struct net_capture_filter_insn no_ret[] = {
+		{ 0x28, 0, 0, ETH_TYPE_OFFSET },	/* ldh [12] */
+	};
+	static const struct net_capture_filter_insn bad_jump[] = {
+		{ 0x15, 0, 2, 0x0800 },			/* jeq #0x800, +0, +2 */
+		{ 0x06, 0, 0, 0 },			/* ret #0 */
+	};
+	static const struct net_capture_filter_insn div_zero[] = {
+		{ 0x34, 0, 0, 0 },			/* div #0 */
+		{ 0x06, 0, 0, 0 },			/* ret #0 */
+	};
+	static const struct net_capture_filter_insn bad_mem[] = {
+		{ 0x02, 0, 0, 16 },			/* st M[16] */
+		{ 0x06, 0, 0, 0 },			/* ret #0 */
+	};
+	struct net_capture_filter_insn too_long[
+		CONFIG_NET_CAPTURE_FILTER_MAX_LEN + 1] = { 0 };
+
+	zassert_equal(net_capture_filter_set(no_ret, ARRAY_SIZE(no_ret)),
+		      -EINVAL, "Program without return accepted");
+	zassert_equal(net_capture_filter_set(bad_jump, ARRAY_SIZE(bad_jump)),
+		      -EINVAL, "Jump out of program accepted");
+	zassert_equal(net_capture_filter_set(div_zero, ARRAY_SIZE(div_zero)),
+		      -EINVAL, "Division by zero accepted");
+	zassert_equal(net_capture_filter_set(bad_mem, ARRAY_SIZE(bad_mem)),
+		      -EINVAL, "Invalid scratch memory accepted");
+	zassert_equal(net_capture_filter_set(too_long, ARRAY_SIZE(too_long)),
+		      -ENOMEM, "Too long program accepted");
+}
+
+static void test_filter(void)
+{
+	/* "ip and udp dst port 4242", capture the first 48 bytes */
+	static const struct net_capture_filter_insn prog[] = {
+		{ 0x28, 0, 0, ETH_TYPE_OFFSET },	/* ldh [12] */
+		{ 0x15, 0, 6, 0x0800 },			/* jeq #0x800 */
+		{ 0x30, 0, 0, ETH_HDR_LEN + 9 },	/* ldb [23] */
+		{ 0x15, 0, 4, 17 },			/* jeq #17 */
+		{ 0xb1, 0, 0, ETH_HDR_LEN },		/* ldxb 4*([14]&0xf) */
+		{ 0x48, 0, 0, ETH_HDR_LEN + 2 },	/* ldh [x + 16] */
+		{ 0x15, 0, 1, TEST_PORT },		/* jeq #4242 */
+		{ 0x06, 0, 0, 48 },			/* ret #48 */
+		{ 0x06, 0, 0, 0 },			/* ret #0 */
+	};
+	struct net_capture_ring_stats before, after;
+
+	zassert_ok(net_capture_filter_set(prog, ARRAY_SIZE(prog)),
+		   "Cannot set filter");
+
+	net_capture_ring_get_stats(&before);
+
+	make_data(0x0800, 17, TEST_PORT);
+	capture(SNAPLEN);
+
+	make_data(0x86dd, 17, TEST_PORT);
+	capture(SNAPLEN);
+
+	make_data(0x0800, 6, TEST_PORT);
+	capture(SNAPLEN);
+
+	make_data(0x0800, 17, TEST_PORT + 1);
+	capture(SNAPLEN);
+
+	/* Too short for the port to be loaded */
+	make_data(0x0800, 17, TEST_PORT);
+	capture(ETH_HDR_LEN + 20 + 2);
+
+	net_capture_ring_get_stats(&after);
+	zassert_equal(after.captured - before.captured, 1,
+		      "Invalid captured count");
+	zassert_equal(after.filtered - before.filtered, 4,
+		      "Invalid filtered count");
+
+	check_frame(SNAPLEN, 48);
+	zassert_is_null(net_capture_ring_get(K_NO_WAIT), "Extra frame");
+
+	zassert_ok(net_capture_filter_set(NULL, 0), "Cannot clear filter");
+
+	capture(SNAPLEN);
+	check_frame(SNAPLEN, SNAPLEN);
+}
+
+static uint8_t pcapng[1024];
+static size_t pcapng_len;
+
+static int write_cb(const void *buf, size_t len, void *user_data)
+{
+	if (len > sizeof(pcapng) - pcapng_len) {
+		return -ENOSPC;
+	}
+
+	memcpy(&pcapng[pcapng_len], buf, len);
+	pcapng_len += len;
+
+	return 0;
+}
+
+static int count_iface(void)
+{
+	int i = 1;
+
+	while (net_if_get_by_index(i) != NULL) {
+		i++;
+	}
+
+	return i - 1;
+}
+
+static void test_export(void)
+{
+	uint32_t *block;
+	size_t off;
+	int i;
+
+	capture(33);
+	capture(SNAPLEN + 10);
+
+	zassert_equal(net_capture_ring_export(write_cb, NULL), 2,
+		      "Invalid frame count");
+	zassert_is_null(net_capture_ring_get(K_NO_WAIT), "Frames left");
+
+	/* Section header */
+	block = (uint32_t *)pcapng;
+	zassert_equal(block[0], 0x0a0d0d0a, "Invalid section header");
+	zassert_equal(block[2], 0x1a2b3c4d, "Invalid byte order magic");
+	off = block[1];
+
+	/* Interface descriptions */
+	for (i = 0; i < count_iface(); i++) {
+		block = (uint32_t *)&pcapng[off];
+		zassert_equal(block[0], 1, "Invalid interface description");
+		off += block[1];
+	}
+
+	/* Packets, each padded to four bytes */
+	block = (uint32_t *)&pcapng[off];
+	zassert_equal(block[0], 6, "Invalid packet block");
+	zassert_equal(block[1], 28 + 36 + 4, "Invalid packet block length");
+	zassert_equal(block[2], net_if_get_by_iface(iface) - 1,
+		      "Invalid interface id");
+	zassert_equal(block[5], 33, "Invalid capture length");
+	zassert_equal(block[6], 33, "Invalid packet length");
+	zassert_mem_equal(&block[7], data, 33, "Invalid data");
+	zassert_equal(block[block[1] / 4 - 1], block[1],
+		      "Invalid trailing length");
+	off += block[1];
+
+	block = (uint32_t *)&pcapng[off];
+	zassert_equal(block[0], 6, "Invalid packet block");
+	zassert_equal(block[5], SNAPLEN, "Invalid capture length");
+	zassert_equal(block[6], SNAPLEN + 10, "Invalid packet length");
+	off += block[1];
+
+	zassert_equal(off, pcapng_len, "Extra data");
+
+	net_capture_ring_disable();
+
+	capture(32);
+	zassert_is_null(net_capture_ring_get(K_NO_WAIT), "Frame captured");
+}
+
+void test_main(void)
+{
+	ztest_test_suite(net_capture_test,
+			 ztest_unit_test(test_setup),
+			 ztest_unit_test(test_ring),
+			 ztest_unit_test(test_ring_full),
+			 ztest_unit_test(test_filter_invalid),
+			 ztest_unit_test(test_filter),
+			 ztest_unit_test(test_export));
+
+	ztest_run_test_suite(net_capture_test);
+}
@@ -0,0 +1,317 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_test, CONFIG_NET_GPTP_LOG_LEVEL);
+
+#include <zephyr/types.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include <errno.h>
+
+#include <ztest.h>
+
+#include <zephyr/drivers/ptp_clock.h>
+#include <zephyr/net/ethernet.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_pkt.h>
+#include <zephyr/net/gptp.h>
+
+#include "net_private.h"
+#include "gptp_messages.h"
+#include "gptp_data_set.h"
+#include "gptp_private.h"
+
+/* Time of the simulated PTP clock */
+#define CLOCK_SECOND 100
+#define CLOCK_NSEC 500000
+#define RX_LATENCY_NS 1000
+
+struct gptp_frame {
+	struct net_eth_hdr eth;
+	struct gptp_hdr hdr;
+	struct gptp_pdelay_req req;
+} __packed;
+
+static struct net_if *iface;
+static int port;
+static int pdelay_resp_sent;
+
+static struct net_ptp_time clock_time = {
+	.second = CLOCK_SECOND,
+	.nanosecond = CLOCK_NSEC,
+};
+
+static int ptp_clock_test_set(const struct device *dev,
+			      struct net_ptp_time *tm)
+{
+	clock_time = *tm;
+
+	return 0;
+}
+
+static int ptp_clock_test_get(const struct device *dev,
+			      struct net_ptp_time *tm)
+{
+	*tm = clock_time;
+
+	return 0;
+}
+
+static int ptp_clock_test_adjust(const struct device *dev, int increment)
+{
+	clock_time.nanosecond += increment;
+
+	return 0;
+}
+
+static int ptp_clock_test_rate_adjust(const struct device *dev, double ratio)
+{
+	return 0;
+}
+
+static const struct ptp_clock_driver_api ptp_api = {
+	.set = ptp_clock_test_set,
+	.get = ptp_clock_test_get,
+	.adjust = ptp_clock_test_adjust,
+	.rate_adjust = ptp_clock_test_rate_adjust,
+};
+
+static int ptp_clock_test_init(const struct device *dev)
+{
+	return 0;
+}
+
+DEVICE_DEFINE(ptp_clock_test, "PTP_CLOCK_TEST", ptp_clock_test_init,
+	      NULL, NULL, NULL, POST_KERNEL,
+	      CONFIG_APPLICATION_INIT_PRIORITY, &ptp_api);
+
+static void eth_iface_init(struct net_if *iface)
+{
+	static uint8_t mac[] = { 0x00, 0x00, 0x5e, 0x00, 0x53, 0x01 };
+
+	net_if_set_link_addr(iface, mac, sizeof(mac), NET_LINK_ETHERNET);
+
+	ethernet_init(iface);
+}
+
+/* Timestamp the sent messages with the simulated clock the way a driver
+ * with hardware timestamping does.
+ */
+static int eth_tx(const struct device *dev, struct net_pkt *pkt)
+{
+	struct gptp_frame frame;
+
+	if (!net_pkt_is_ptp(pkt)) {
+		return 0;
+	}
+
+	net_pkt_cursor_init(pkt);
+	if (net_pkt_read(pkt, &frame, sizeof(struct net_eth_hdr) +
+			 sizeof(struct gptp_hdr))) {
+		return 0;
+	}
+
+	if (frame.hdr.message_type == GPTP_PATH_DELAY_RESP_MESSAGE) {
+		pdelay_resp_sent++;
+	}
+
+	net_pkt_set_timestamp(pkt, &clock_time);
+	net_if_add_tx_timestamp(pkt);
+
+	return 0;
+}
+
+static enum ethernet_hw_caps eth_capabilities(const struct device *dev)
+{
+	return ETHERNET_PTP;
+}
+
+static const struct device *eth_get_ptp_clock(const struct device *dev)
+{
+	return DEVICE_GET(ptp_clock_test);
+}
+
+static int eth_init(const struct device *dev)
+{
+	return 0;
+}
+
+static struct ethernet_api eth_api = {
+	.iface_api.init = eth_iface_init,
+
+	.get_capabilities = eth_capabilities,
+	.get_ptp_clock = eth_get_ptp_clock,
+	.send = eth_tx,
+};
+
+ETH_NET_DEVICE_INIT(eth_gptp_test, "eth_gptp_test", eth_init, NULL, NULL,
+		    NULL, CONFIG_ETH_INIT_PRIORITY, &eth_api, NET_ETH_MTU);
+
+static struct net_pkt *make_frame(const void *data, size_t len)
+{
+	struct net_pkt *pkt;
+
+	pkt = net_pkt_rx_alloc_with_buffer(iface, len, AF_UNSPEC, 0,
+					   K_NO_WAIT);
+	zassert_not_null(pkt, "Cannot allocate pkt");
+
+	zassert_ok(net_pkt_write(pkt, data, len), "Cannot write frame");
+
+	return pkt;
+}
+
+static void make_pdelay_req(struct gptp_frame *frame, uint16_t seq)
+{
+	static const uint8_t gptp_mcast[] = {
+		0x01, 0x80, 0xc2, 0x00, 0x00, 0x0e
+	};
+	static const uint8_t peer_mac[] = {
+		0x00, 0x00, 0x5e, 0x00, 0x53, 0x02
+	};
+
+	memset(frame, 0, sizeof(*frame));
+
+	memcpy(frame->eth.dst.addr, gptp_mcast, sizeof(gptp_mcast));
+	memcpy(frame->eth.src.addr, peer_mac, sizeof(peer_mac));
+	frame->eth.type = htons(NET_ETH_PTYPE_PTP);
+
+	frame->hdr.message_type = GPTP_PATH_DELAY_REQ_MESSAGE;
+	frame->hdr.transport_specific = GPTP_TRANSPORT_802_1_AS;
+	frame->hdr.ptp_version = GPTP_VERSION;
+	frame->hdr.message_length = htons(GPTP_PDELAY_REQ_LEN);
+	frame->hdr.sequence_id = htons(seq);
+}
+
+static void test_setup(void)
+{
+	iface = net_if_lookup_by_dev(DEVICE_GET(eth_gptp_test));
+	zassert_not_null(iface, "No interface");
+
+	port = gptp_get_port_number(iface);
+	zassert_true(port >= GPTP_PORT_START, "No gPTP port (%d)", port);
+
+	/* Let the gPTP thread enable the path delay responder */
+	k_sleep(K_MSEC(100));
+
+	zassert_not_equal(GPTP_PORT_STATE(port)->pdelay_resp.state,
+			  GPTP_PDELAY_RESP_NOT_ENABLED,
+			  "Path delay responder not enabled");
+}
+
+static void test_frame_type(void)
+{
+	struct net_eth_vlan_hdr vlan_hdr = { 0 };
+	struct gptp_frame frame;
+	struct net_pkt *pkt;
+
+	make_pdelay_req(&frame, 0);
+
+	pkt = make_frame(&frame, sizeof(frame));
+	zassert_true(net_gptp_is_frame(iface, pkt), "PTP frame not found");
+	net_pkt_unref(pkt);
+
+	frame.eth.type = htons(NET_ETH_PTYPE_IPV6);
+	pkt = make_frame(&frame, sizeof(frame));
+	zassert_false(net_gptp_is_frame(iface, pkt), "IPv6 frame as PTP");
+	net_pkt_unref(pkt);
+
+	vlan_hdr.vlan.tpid = htons(NET_ETH_PTYPE_VLAN);
+	vlan_hdr.type = htons(NET_ETH_PTYPE_PTP);
+	pkt = make_frame(&vlan_hdr, sizeof(vlan_hdr));
+	zassert_true(net_gptp_is_frame(iface, pkt), "VLAN PTP frame not found");
+	net_pkt_unref(pkt);
+
+	/* Too short for the inner type */
+	pkt = make_frame(&vlan_hdr, sizeof(struct net_eth_hdr));
+	zassert_false(net_gptp_is_frame(iface, pkt), "Short frame as PTP");
+	net_pkt_unref(pkt);
+}
+
+static void test_rx_fast_path(void)
+{
+	struct gptp_port_param_ds *port_param_ds = GPTP_PORT_PARAM_DS(port);
+	uint32_t latency_count = port_param_ds->rx_latency_hist[4];
+	int sent = pdelay_resp_sent;
+	struct net_ptp_time rx_time = clock_time;
+	struct gptp_frame frame;
+	struct net_pkt *pkt;
+
+	make_pdelay_req(&frame, 1);
+	pkt = make_frame(&frame, sizeof(frame));
+
+	rx_time.nanosecond -= RX_LATENCY_NS;
+	net_pkt_set_timestamp(pkt, &rx_time);
+
+	zassert_ok(net_recv_data(iface, pkt), "Cannot receive frame");
+
+	/* The response is sent before this cooperative thread yields */
+	zassert_equal(pdelay_resp_sent, sent + 1, "Response not sent");
+
+	/* 1000 ns is in the [256, 1024) bucket */
+	zassert_equal(port_param_ds->rx_latency_hist[4], latency_count + 1,
+		      "RX latency not recorded");
+}
+
+static void test_servo_stats(void)
+{
+	struct gptp_port_param_ds *port_param_ds = GPTP_PORT_PARAM_DS(port);
+	static const int64_t offsets[] = { 100000, -4000, 1500, -800, 300 };
+	uint32_t total = 0U;
+	int i;
+
+	memset(port_param_ds->offset_hist, 0,
+	       sizeof(port_param_ds->offset_hist));
+	memset(port_param_ds->servo_lock_hist, 0,
+	       sizeof(port_param_ds->servo_lock_hist));
+	port_param_ds->servo_updates = 0U;
+	port_param_ds->clock_step_count = 0U;
+	port_param_ds->servo_unlock_count = 0U;
+	port_param_ds->servo_locked = false;
+
+	for (i = 0; i < ARRAY_SIZE(offsets); i++) {
+		gptp_stats_servo_update(port, offsets[i], offsets[i] > 5000);
+	}
+
+	zassert_true(port_param_ds->servo_locked, "Servo not locked");
+	zassert_equal(port_param_ds->offset, 300, "Invalid offset");
+	zassert_equal(port_param_ds->clock_step_count, 1, "Invalid steps");
+
+	/* Locked at the fourth update */
+	zassert_equal(port_param_ds->servo_lock_hist[1], 1,
+		      "Invalid lock time");
+
+	/* 100000 ns is in the [65536, 262144) bucket */
+	zassert_equal(port_param_ds->offset_hist[8], 1, "Invalid offset bucket");
+
+	for (i = 0; i < GPTP_STATS_HIST_SIZE; i++) {
+		total += port_param_ds->offset_hist[i];
+	}
+
+	zassert_equal(total, ARRAY_SIZE(offsets), "Offsets not recorded");
+
+	gptp_stats_servo_update(port, 5000, false);
+	zassert_false(port_param_ds->servo_locked, "Servo still locked");
+	zassert_equal(port_param_ds->servo_unlock_count, 1,
+		      "Unlock not counted");
+
+	gptp_stats_servo_update(port, -20, false);
+	zassert_true(port_param_ds->servo_locked, "Servo not locked again");
+	zassert_equal(port_param_ds->servo_lock_hist[0], 1,
+		      "Invalid lock time after unlock");
+}
+
+void test_main(void)
+{
+	ztest_test_suite(net_gptp_test,
+			 ztest_unit_test(test_setup),
+			 ztest_unit_test(test_frame_type),
+			 ztest_unit_test(test_rx_fast_path),
+			 ztest_unit_test(test_servo_stats));
+
+	ztest_run_test_suite(net_gptp_test);
+}
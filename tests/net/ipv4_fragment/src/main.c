@@ -0,0 +1,345 @@
+/* main.c - Application main entry point */
+
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_test, CONFIG_NET_IPV4_LOG_LEVEL);
+
+#include <zephyr/types.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include <errno.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/linker/sections.h>
+
+#include <ztest.h>
+
+#include <zephyr/net/dummy.h>
+#include <zephyr/net/buf.h>
+#include <zephyr/net/net_ip.h>
+#include <zephyr/net/net_if.h>
+
+#define NET_LOG_ENABLED 1
+#include "net_private.h"
+
+#include "ipv4.h"
+#include "udp_internal.h"
+
+static struct in_addr my_addr = { { { 192, 0, 2, 1 } } };
+static struct in_addr peer_addr = { { { 192, 0, 2, 2 } } };
+
+#define TEST_PORT 4242
+#define TEST_MTU 576
+#define TEST_DATA_LEN 1000
+
+/* With the 576 byte MTU the test datagram is sent in two fragments */
+#define TEST_FRAG_COUNT 2
+#define TEST_FIT_LEN ((TEST_MTU - NET_IPV4H_LEN) & ~7)
+
+#define WAIT_TIME K_SECONDS(1)
+#define ALLOC_TIMEOUT K_MSEC(500)
+
+static struct net_if *iface;
+static struct k_sem wait_data;
+static struct k_sem wait_recv;
+
+static bool capture;
+static struct net_pkt *frags[TEST_FRAG_COUNT];
+static int frag_count;
+
+static uint8_t test_data[TEST_DATA_LEN];
+
+static int net_iface_dev_init(const struct device *dev)
+{
+	return 0;
+}
+
+static void net_iface_init(struct net_if *iface)
+{
+	static uint8_t mac[] = { 0x00, 0x00, 0x5E, 0x00, 0x53, 0x01 };
+
+	net_if_set_link_addr(iface, mac, sizeof(mac), NET_LINK_ETHERNET);
+}
+
+static int sender_iface(const struct device *dev, struct net_pkt *pkt)
+{
+	if (!pkt->buffer) {
+		return -ENODATA;
+	}
+
+	if (capture && frag_count < TEST_FRAG_COUNT) {
+		/* Keep the fragment so that it can be fed back to us */
+		frags[frag_count++] = net_pkt_ref(pkt);
+		k_sem_give(&wait_data);
+	}
+
+	return 0;
+}
+
+static struct dummy_api net_iface_api = {
+	.iface_api.init = net_iface_init,
+	.send = sender_iface,
+};
+
+NET_DEVICE_INIT(net_ipv4_fragment_test, "net_ipv4_fragment_test",
+		net_iface_dev_init, NULL, NULL, NULL,
+		CONFIG_KERNEL_INIT_PRIORITY_DEFAULT,
+		&net_iface_api, DUMMY_L2, NET_L2_GET_CTX_TYPE(DUMMY_L2),
+		TEST_MTU);
+
+static enum net_verdict udp_data_received(struct net_conn *conn,
+					  struct net_pkt *pkt,
+					  union net_ip_header *ip_hdr,
+					  union net_proto_header *proto_hdr,
+					  void *user_data)
+{
+	static uint8_t data[TEST_DATA_LEN];
+
+	zassert_equal(ntohs(ip_hdr->ipv4->len),
+		      NET_IPV4UDPH_LEN + TEST_DATA_LEN,
+		      "Invalid reassembled length");
+	zassert_equal(net_pkt_remaining_data(pkt), TEST_DATA_LEN,
+		      "Invalid UDP payload length");
+	zassert_ok(net_pkt_read(pkt, data, sizeof(data)), "Cannot read data");
+	zassert_mem_equal(data, test_data, sizeof(data), "Data mismatch");
+
+	net_pkt_unref(pkt);
+
+	k_sem_give(&wait_recv);
+
+	return NET_OK;
+}
+
+static void frag_count_cb(struct net_ipv4_reassembly *reass, void *user_data)
+{
+	int *count = user_data;
+
+	(*count)++;
+}
+
+static int pending_reassemblies(void)
+{
+	int count = 0;
+
+	net_ipv4_frag_foreach(frag_count_cb, &count);
+
+	return count;
+}
+
+static void id_cb(struct net_ipv4_reassembly *reass, void *user_data)
+{
+	uint16_t *id = user_data;
+
+	if (reass->id == *id) {
+		*id = 0U;
+	}
+}
+
+static bool is_pending(uint16_t id)
+{
+	net_ipv4_frag_foreach(id_cb, &id);
+
+	return id == 0U;
+}
+
+/* Send the test datagram and capture the fragments it is split into. */
+static void send_datagram(void)
+{
+	struct net_pkt *pkt;
+	int ret;
+	int i;
+
+	pkt = net_pkt_alloc_with_buffer(iface, TEST_DATA_LEN, AF_INET,
+					IPPROTO_UDP, ALLOC_TIMEOUT);
+	zassert_not_null(pkt, "Cannot allocate pkt");
+
+	zassert_ok(net_ipv4_create(pkt, &my_addr, &peer_addr),
+		   "Cannot create IPv4 header");
+	zassert_ok(net_udp_create(pkt, htons(TEST_PORT), htons(TEST_PORT)),
+		   "Cannot create UDP header");
+	zassert_ok(net_pkt_write(pkt, test_data, sizeof(test_data)),
+		   "Cannot write data");
+
+	net_pkt_cursor_init(pkt);
+	zassert_ok(net_ipv4_finalize(pkt, IPPROTO_UDP), "Cannot finalize");
+
+	frag_count = 0;
+	capture = true;
+
+	ret = net_send_data(pkt);
+	zassert_equal(ret, 0, "Cannot send (%d)", ret);
+
+	while (frag_count < TEST_FRAG_COUNT) {
+		zassert_ok(k_sem_take(&wait_data, WAIT_TIME),
+			   "Timeout while waiting fragments");
+	}
+
+	capture = false;
+
+	/* Swap the addresses so that the fragments are accepted when fed
+	 * back to us. The header and UDP checksums remain valid.
+	 */
+	for (i = 0; i < TEST_FRAG_COUNT; i++) {
+		struct net_ipv4_hdr *hdr = NET_IPV4_HDR(frags[i]);
+
+		net_ipv4_addr_copy_raw(hdr->src, (uint8_t *)&peer_addr);
+		net_ipv4_addr_copy_raw(hdr->dst, (uint8_t *)&my_addr);
+	}
+}
+
+static uint16_t frag_id(struct net_pkt *pkt)
+{
+	return sys_get_be16(NET_IPV4_HDR(pkt)->id);
+}
+
+static void test_setup(void)
+{
+	struct sockaddr local_addr = { 0 };
+	struct net_conn_handle *handle;
+	int i;
+
+	k_sem_init(&wait_data, 0, UINT_MAX);
+	k_sem_init(&wait_recv, 0, UINT_MAX);
+
+	for (i = 0; i < sizeof(test_data); i++) {
+		test_data[i] = i;
+	}
+
+	iface = net_if_get_first_by_type(&NET_L2_GET_NAME(DUMMY));
+	zassert_not_null(iface, "Interface not found");
+
+	zassert_not_null(net_if_ipv4_addr_add(iface, &my_addr,
+					      NET_ADDR_MANUAL, 0),
+			 "Cannot add IPv4 address");
+
+	local_addr.sa_family = AF_INET;
+	net_sin(&local_addr)->sin_port = htons(TEST_PORT);
+
+	zassert_ok(net_udp_register(AF_INET, NULL, &local_addr, 0,
+				    TEST_PORT, NULL, udp_data_received,
+				    NULL, &handle),
+		   "Cannot register UDP handler");
+}
+
+static void test_send_ipv4_fragment(void)
+{
+	struct net_ipv4_hdr *hdr;
+	int i;
+
+	send_datagram();
+
+	for (i = 0; i < TEST_FRAG_COUNT; i++) {
+		hdr = NET_IPV4_HDR(frags[i]);
+
+		zassert_true(net_pkt_get_len(frags[i]) <= TEST_MTU,
+			     "Fragment %d too large", i);
+		zassert_equal(net_calc_chksum_ipv4(frags[i]), 0,
+			      "Invalid header checksum in fragment %d", i);
+		zassert_equal(frag_id(frags[i]), frag_id(frags[0]),
+			      "Fragment id mismatch");
+		zassert_equal(sys_get_be16(hdr->offset) &
+			      NET_IPV4_FRAGH_OFFSET_MASK,
+			      i * TEST_FIT_LEN / 8,
+			      "Invalid offset in fragment %d", i);
+		zassert_equal(!!(sys_get_be16(hdr->offset) &
+				 NET_IPV4_FRAGH_MF),
+			      i < TEST_FRAG_COUNT - 1,
+			      "Invalid MF flag in fragment %d", i);
+	}
+
+	zassert_equal(net_pkt_get_len(frags[TEST_FRAG_COUNT - 1]),
+		      NET_IPV4H_LEN + NET_UDPH_LEN + TEST_DATA_LEN -
+		      TEST_FIT_LEN, "Invalid last fragment length");
+
+	for (i = 0; i < TEST_FRAG_COUNT; i++) {
+		net_pkt_unref(frags[i]);
+	}
+}
+
+static void test_recv_ipv4_fragment(void)
+{
+	struct net_pkt *dup;
+	int i;
+
+	send_datagram();
+
+	/* Feed the fragments in reverse order, with a duplicate */
+	dup = net_pkt_clone(frags[TEST_FRAG_COUNT - 1], ALLOC_TIMEOUT);
+	zassert_not_null(dup, "Cannot clone fragment");
+	zassert_ok(net_recv_data(iface, dup), "Cannot receive duplicate");
+
+	for (i = TEST_FRAG_COUNT - 1; i >= 0; i--) {
+		zassert_ok(net_recv_data(iface, frags[i]),
+			   "Cannot receive fragment %d", i);
+	}
+
+	zassert_ok(k_sem_take(&wait_recv, WAIT_TIME),
+		   "Reassembled packet not received");
+	zassert_equal(pending_reassemblies(), 0, "Reassembly still pending");
+}
+
+static void test_recv_ipv4_fragment_timeout(void)
+{
+	send_datagram();
+
+	zassert_ok(net_recv_data(iface, frags[0]), "Cannot receive fragment");
+	net_pkt_unref(frags[1]);
+
+	k_sleep(K_MSEC(100));
+	zassert_equal(pending_reassemblies(), 1, "Reassembly not pending");
+
+	k_sleep(K_SECONDS(CONFIG_NET_IPV4_FRAGMENT_TIMEOUT));
+	zassert_equal(pending_reassemblies(), 0, "Reassembly not timed out");
+	zassert_not_equal(k_sem_take(&wait_recv, K_NO_WAIT), 0,
+			  "Incomplete packet received");
+}
+
+static void test_recv_ipv4_fragment_mem_limit(void)
+{
+	uint16_t id[3];
+	int i;
+
+	/* The first fragments of three datagrams do not fit into the
+	 * reassembly memory limit, so the oldest one must be discarded.
+	 */
+	for (i = 0; i < ARRAY_SIZE(id); i++) {
+		send_datagram();
+
+		id[i] = frag_id(frags[0]);
+
+		zassert_ok(net_recv_data(iface, frags[0]),
+			   "Cannot receive fragment");
+		net_pkt_unref(frags[1]);
+
+		k_sleep(K_MSEC(10));
+	}
+
+	zassert_true(ARRAY_SIZE(id) * TEST_MTU >
+		     CONFIG_NET_IPV4_FRAGMENT_MAX_MEM, "Invalid test setup");
+	zassert_equal(pending_reassemblies(), 2, "Invalid pending count");
+	zassert_false(is_pending(id[0]), "Oldest reassembly not discarded");
+	zassert_true(is_pending(id[1]), "Reassembly discarded");
+	zassert_true(is_pending(id[2]), "Reassembly discarded");
+
+	k_sleep(K_SECONDS(CONFIG_NET_IPV4_FRAGMENT_TIMEOUT));
+	zassert_equal(pending_reassemblies(), 0, "Reassembly not timed out");
+}
+
+void test_main(void)
+{
+	ztest_test_suite(net_ipv4_fragment_test,
+			 ztest_unit_test(test_setup),
+			 ztest_unit_test(test_send_ipv4_fragment),
+			 ztest_unit_test(test_recv_ipv4_fragment),
+			 ztest_unit_test(test_recv_ipv4_fragment_timeout),
+			 ztest_unit_test(test_recv_ipv4_fragment_mem_limit)
+			 );
+
+	ztest_run_test_suite(net_ipv4_fragment_test);
+}
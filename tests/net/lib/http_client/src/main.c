@@ -0,0 +1,471 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_test, LOG_LEVEL_WRN);
+
+#include <ztest.h>
+
+#include <zephyr/net/http_client.h>
+#include <zephyr/net/socket.h>
+
+#define SERVER_ADDR "2001:db8::1"
+#define SERVER_PORT 8080
+#define SERVER_PORT_COUNT 3
+#define SERVER_MAX_CLIENTS 6
+
+#define SERVER_STACK_SIZE 2048
+#define SERVER_PRIORITY K_PRIO_PREEMPT(8)
+
+#define REQ_TIMEOUT 3000
+#define PIPELINE_DEPTH 3
+#define BODY_MAX 512
+
+static const char * const ports[SERVER_PORT_COUNT] = {
+	"8080", "8081", "8082",
+};
+
+/* Minimal HTTP server, answering every request with a fixed body. */
+static struct {
+	int listen_sock[SERVER_PORT_COUNT];
+	int sock[SERVER_MAX_CLIENTS];
+	/* Number of matched characters of the end of the request header */
+	int match[SERVER_MAX_CLIENTS];
+	int accept_count;
+	int request_count;
+	/* Close the connection on the next request without answering it */
+	bool drop_next;
+	size_t body_len;
+} server;
+
+static K_THREAD_STACK_DEFINE(server_stack, SERVER_STACK_SIZE);
+static struct k_thread server_thread;
+static K_SEM_DEFINE(server_ready, 0, 1);
+
+static uint8_t body[BODY_MAX];
+static uint8_t recv_buf[PIPELINE_DEPTH][128];
+
+static int final_count;
+static uint16_t last_status;
+static size_t body_total;
+
+static int server_sendall(int sock, const void *buf, size_t len)
+{
+	while (len) {
+		ssize_t out_len = send(sock, buf, len, 0);
+
+		if (out_len < 0) {
+			return -errno;
+		}
+
+		buf = (const uint8_t *)buf + out_len;
+		len -= out_len;
+	}
+
+	return 0;
+}
+
+static void server_close(int i)
+{
+	close(server.sock[i]);
+	server.sock[i] = -1;
+}
+
+static void server_respond(int i)
+{
+	char header[64];
+	int len;
+
+	server.request_count++;
+
+	if (server.drop_next) {
+		server.drop_next = false;
+		server_close(i);
+		return;
+	}
+
+	len = snprintk(header, sizeof(header),
+		       "HTTP/1.1 200 OK\r\nContent-Length: %zu\r\n\r\n",
+		       server.body_len);
+
+	if (server_sendall(server.sock[i], header, len) < 0 ||
+	    server_sendall(server.sock[i], body, server.body_len) < 0) {
+		server_close(i);
+	}
+}
+
+static void server_recv(int i)
+{
+	static const char end[] = "\r\n\r\n";
+	uint8_t buf[128];
+	int ret;
+
+	ret = recv(server.sock[i], buf, sizeof(buf), 0);
+	if (ret <= 0) {
+		server_close(i);
+		return;
+	}
+
+	/* Requests carry no body, so each end of header is a request. */
+	for (int pos = 0; pos < ret && server.sock[i] >= 0; pos++) {
+		if (buf[pos] == end[server.match[i]]) {
+			server.match[i]++;
+		} else {
+			server.match[i] = (buf[pos] == end[0]) ? 1 : 0;
+		}
+
+		if (server.match[i] == sizeof(end) - 1) {
+			server.match[i] = 0;
+			server_respond(i);
+		}
+	}
+}
+
+static void server_accept(int listen_sock)
+{
+	int sock, i;
+
+	sock = accept(listen_sock, NULL, NULL);
+	if (sock < 0) {
+		return;
+	}
+
+	for (i = 0; i < SERVER_MAX_CLIENTS; i++) {
+		if (server.sock[i] < 0) {
+			server.sock[i] = sock;
+			server.match[i] = 0;
+			server.accept_count++;
+			return;
+		}
+	}
+
+	close(sock);
+}
+
+static void server_fn(void *p1, void *p2, void *p3)
+{
+	struct zsock_pollfd fds[SERVER_PORT_COUNT + SERVER_MAX_CLIENTS];
+	struct sockaddr_in6 addr = { 0 };
+	int client[SERVER_MAX_CLIENTS];
+	int i, nfds, ret;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	addr.sin6_family = AF_INET6;
+	inet_pton(AF_INET6, SERVER_ADDR, &addr.sin6_addr);
+
+	for (i = 0; i < SERVER_PORT_COUNT; i++) {
+		server.listen_sock[i] = socket(AF_INET6, SOCK_STREAM,
+					       IPPROTO_TCP);
+		zassert_true(server.listen_sock[i] >= 0,
+			     "Cannot create server socket (%d)", errno);
+
+		addr.sin6_port = htons(SERVER_PORT + i);
+
+		ret = bind(server.listen_sock[i], (struct sockaddr *)&addr,
+			   sizeof(addr));
+		zassert_equal(ret, 0, "Cannot bind (%d)", errno);
+
+		ret = listen(server.listen_sock[i], 2);
+		zassert_equal(ret, 0, "Cannot listen (%d)", errno);
+	}
+
+	k_sem_give(&server_ready);
+
+	while (true) {
+		for (nfds = 0; nfds < SERVER_PORT_COUNT; nfds++) {
+			fds[nfds].fd = server.listen_sock[nfds];
+			fds[nfds].events = ZSOCK_POLLIN;
+		}
+
+		for (i = 0; i < SERVER_MAX_CLIENTS; i++) {
+			if (server.sock[i] >= 0) {
+				client[nfds - SERVER_PORT_COUNT] = i;
+				fds[nfds].fd = server.sock[i];
+				fds[nfds].events = ZSOCK_POLLIN;
+				nfds++;
+			}
+		}
+
+		if (poll(fds, nfds, 10) <= 0) {
+			continue;
+		}
+
+		for (i = 0; i < nfds; i++) {
+			if (fds[i].revents == 0) {
+				continue;
+			}
+
+			if (i < SERVER_PORT_COUNT) {
+				server_accept(fds[i].fd);
+			} else {
+				server_recv(client[i - SERVER_PORT_COUNT]);
+			}
+		}
+	}
+}
+
+static void response_cb(struct http_response *rsp,
+			enum http_final_call final_data, void *user_data)
+{
+	if (final_data == HTTP_DATA_FINAL) {
+		final_count++;
+		last_status = rsp->http_status_code;
+	}
+}
+
+static int body_cb(struct http_response *rsp, const uint8_t *data,
+		   size_t len, void *user_data)
+{
+	zassert_mem_equal(data, &body[body_total], len, "Wrong body data");
+	body_total += len;
+
+	return 0;
+}
+
+static void req_setup(struct http_request *req, enum http_method method,
+		      uint8_t *buf, size_t len)
+{
+	memset(req, 0, sizeof(*req));
+
+	req->method = method;
+	req->url = "/";
+	req->host = SERVER_ADDR;
+	req->protocol = "HTTP/1.1";
+	req->response = response_cb;
+	req->recv_buf = buf;
+	req->recv_buf_len = len;
+}
+
+static int pool_req(const char *port, enum http_method method)
+{
+	struct http_request req;
+
+	req_setup(&req, method, recv_buf[0], sizeof(recv_buf[0]));
+
+	return http_client_pool_req(SERVER_ADDR, port, HTTP_CLIENT_POOL_NO_TLS,
+				    &req, REQ_TIMEOUT, NULL);
+}
+
+static void test_reset(void)
+{
+	http_client_pool_flush();
+
+	final_count = 0;
+	last_status = 0;
+	server.accept_count = 0;
+	server.request_count = 0;
+}
+
+static void test_http_client_init(void)
+{
+	for (int i = 0; i < sizeof(body); i++) {
+		body[i] = 'a' + i % 26;
+	}
+
+	for (int i = 0; i < SERVER_MAX_CLIENTS; i++) {
+		server.sock[i] = -1;
+	}
+
+	server.body_len = 2;
+
+	k_thread_create(&server_thread, server_stack,
+			K_THREAD_STACK_SIZEOF(server_stack), server_fn,
+			NULL, NULL, NULL, SERVER_PRIORITY, 0, K_NO_WAIT);
+
+	k_sem_take(&server_ready, K_FOREVER);
+}
+
+static void test_http_client_conn_reuse(void)
+{
+	struct http_request req;
+	int sock, sock2, ret;
+
+	test_reset();
+
+	sock = http_client_conn_get(SERVER_ADDR, ports[0],
+				    HTTP_CLIENT_POOL_NO_TLS);
+	zassert_true(sock >= 0, "Cannot get connection (%d)", sock);
+
+	req_setup(&req, HTTP_GET, recv_buf[0], sizeof(recv_buf[0]));
+	ret = http_client_req(sock, &req, REQ_TIMEOUT, NULL);
+	zassert_true(ret > 0, "Request failed (%d)", ret);
+	zassert_equal(final_count, 1, "No response");
+	zassert_equal(last_status, 200, "Wrong status %d", last_status);
+	zassert_true(req.internal.response.keep_alive, "No keep-alive");
+
+	http_client_conn_release(sock, true);
+
+	sock2 = http_client_conn_get(SERVER_ADDR, ports[0],
+				     HTTP_CLIENT_POOL_NO_TLS);
+	zassert_equal(sock2, sock, "Connection not reused");
+
+	ret = http_client_req(sock2, &req, REQ_TIMEOUT, NULL);
+	zassert_true(ret > 0, "Request failed (%d)", ret);
+	zassert_equal(final_count, 2, "No response");
+	zassert_equal(server.accept_count, 1, "%d connections made",
+		      server.accept_count);
+	zassert_equal(server.request_count, 2, "Server got %d requests",
+		      server.request_count);
+
+	http_client_conn_release(sock2, true);
+}
+
+static void test_http_client_pool_lru(void)
+{
+	int ret;
+
+	test_reset();
+
+	/* Pool holds two connections: 8080 and 8081 */
+	ret = pool_req(ports[0], HTTP_GET);
+	zassert_true(ret > 0, "Request failed (%d)", ret);
+	k_msleep(5);
+	ret = pool_req(ports[1], HTTP_GET);
+	zassert_true(ret > 0, "Request failed (%d)", ret);
+	k_msleep(5);
+	ret = pool_req(ports[0], HTTP_GET);
+	zassert_true(ret > 0, "Request failed (%d)", ret);
+	zassert_equal(server.accept_count, 2, "%d connections made",
+		      server.accept_count);
+	k_msleep(5);
+
+	/* 8081 is the least recently used one and makes room for 8082 */
+	ret = pool_req(ports[2], HTTP_GET);
+	zassert_true(ret > 0, "Request failed (%d)", ret);
+	zassert_equal(server.accept_count, 3, "%d connections made",
+		      server.accept_count);
+
+	ret = pool_req(ports[0], HTTP_GET);
+	zassert_true(ret > 0, "Request failed (%d)", ret);
+	zassert_equal(server.accept_count, 3, "Connection to %s not reused",
+		      ports[0]);
+
+	ret = pool_req(ports[1], HTTP_GET);
+	zassert_true(ret > 0, "Request failed (%d)", ret);
+	zassert_equal(server.accept_count, 4, "Connection to %s not evicted",
+		      ports[1]);
+
+	zassert_equal(final_count, 6, "%d responses", final_count);
+	zassert_equal(server.request_count, 6, "Server got %d requests",
+		      server.request_count);
+}
+
+static void test_http_client_pool_retry(void)
+{
+	int ret;
+
+	test_reset();
+
+	ret = pool_req(ports[0], HTTP_GET);
+	zassert_true(ret > 0, "Request failed (%d)", ret);
+
+	/* The server closes the reused connection instead of answering, the
+	 * request is sent again on a new connection and the application
+	 * only sees the real response.
+	 */
+	server.drop_next = true;
+	final_count = 0;
+
+	ret = pool_req(ports[0], HTTP_GET);
+	zassert_true(ret > 0, "Request failed (%d)", ret);
+	zassert_equal(final_count, 1, "%d responses", final_count);
+	zassert_equal(last_status, 200, "Wrong status %d", last_status);
+	zassert_equal(server.accept_count, 2, "%d connections made",
+		      server.accept_count);
+	zassert_equal(server.request_count, 3, "Server got %d requests",
+		      server.request_count);
+}
+
+static void test_http_client_pool_no_retry(void)
+{
+	int ret;
+
+	test_reset();
+
+	ret = pool_req(ports[0], HTTP_GET);
+	zassert_true(ret > 0, "Request failed (%d)", ret);
+
+	/* A POST may have been processed, so it must not be sent again */
+	server.drop_next = true;
+	final_count = 0;
+	last_status = 0xffff;
+
+	(void)pool_req(ports[0], HTTP_POST);
+	zassert_equal(final_count, 1, "%d responses", final_count);
+	zassert_equal(last_status, 0, "Wrong status %d", last_status);
+	zassert_equal(server.request_count, 2, "Server got %d requests",
+		      server.request_count);
+}
+
+static void test_http_client_pipelined(void)
+{
+	struct http_request reqs[PIPELINE_DEPTH];
+	struct http_request *req_list[PIPELINE_DEPTH];
+	int sock, ret;
+
+	test_reset();
+
+	sock = http_client_conn_get(SERVER_ADDR, ports[0],
+				    HTTP_CLIENT_POOL_NO_TLS);
+	zassert_true(sock >= 0, "Cannot get connection (%d)", sock);
+
+	for (int i = 0; i < PIPELINE_DEPTH; i++) {
+		req_setup(&reqs[i], HTTP_GET, recv_buf[i], sizeof(recv_buf[i]));
+		req_list[i] = &reqs[i];
+	}
+
+	ret = http_client_req_pipelined(sock, req_list, PIPELINE_DEPTH,
+					REQ_TIMEOUT, NULL);
+	zassert_equal(ret, PIPELINE_DEPTH, "%d responses completed", ret);
+	zassert_equal(final_count, PIPELINE_DEPTH, "%d responses",
+		      final_count);
+	zassert_equal(server.request_count, PIPELINE_DEPTH,
+		      "Server got %d requests", server.request_count);
+
+	http_client_conn_release(sock, true);
+}
+
+static void test_http_client_body_cb(void)
+{
+	struct http_request req;
+	int ret;
+
+	test_reset();
+
+	server.body_len = BODY_MAX;
+	body_total = 0;
+
+	/* The body is larger than the receive buffer */
+	req_setup(&req, HTTP_GET, recv_buf[0], 64);
+	req.body_cb = body_cb;
+
+	ret = http_client_pool_req(SERVER_ADDR, ports[0],
+				   HTTP_CLIENT_POOL_NO_TLS, &req, REQ_TIMEOUT,
+				   NULL);
+	zassert_true(ret > 0, "Request failed (%d)", ret);
+	zassert_equal(body_total, BODY_MAX, "Got %zu bytes of body",
+		      body_total);
+	zassert_equal(final_count, 1, "%d responses", final_count);
+
+	server.body_len = 2;
+}
+
+void test_main(void)
+{
+	ztest_test_suite(http_client,
+			 ztest_unit_test(test_http_client_init),
+			 ztest_unit_test(test_http_client_conn_reuse),
+			 ztest_unit_test(test_http_client_pool_lru),
+			 ztest_unit_test(test_http_client_pool_retry),
+			 ztest_unit_test(test_http_client_pool_no_retry),
+			 ztest_unit_test(test_http_client_pipelined),
+			 ztest_unit_test(test_http_client_body_cb));
+
+	ztest_run_test_suite(http_client);
+}
@@ -0,0 +1,479 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_test, LOG_LEVEL_WRN);
+
+#include <ztest.h>
+
+#include <zephyr/net/mqtt.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/sys/byteorder.h>
+
+#define SERVER_ADDR "2001:db8::1"
+#define SERVER_PORT 1883
+
+#define BROKER_STACK_SIZE 2048
+#define BROKER_PRIORITY K_PRIO_PREEMPT(8)
+
+#define WINDOW CONFIG_MQTT_OUTBOX_INFLIGHT_MAX
+#define MAX_PENDING 16
+
+#define PERF_MSG_COUNT 256
+#define PERF_MSG_SIZE 64
+
+#define CLIENT_WAIT_FOR(cond)					\
+	do {							\
+		for (int _i = 0; _i < 200 && !(cond); _i++) {	\
+			client_process(10);			\
+		}						\
+	} while (0)
+
+static uint8_t rx_buffer[256];
+static uint8_t tx_buffer[256];
+static uint8_t outbox_buffer[2048];
+static uint8_t payload[PERF_MSG_SIZE];
+
+static struct mqtt_client client_ctx;
+static struct sockaddr_in6 broker_addr;
+static bool connected;
+static int puback_count;
+static uint16_t message_id;
+
+/* Minimal broker stand-in, answering on the loopback interface. */
+static struct {
+	int sock;
+	bool ack;
+	bool drop;
+	int publish_count;
+	int dup_count;
+	int pubrel_count;
+	int pending_count;
+	struct {
+		uint8_t qos;
+		uint16_t message_id;
+	} pending[MAX_PENDING];
+} broker;
+
+static K_THREAD_STACK_DEFINE(broker_stack, BROKER_STACK_SIZE);
+static struct k_thread broker_thread;
+static K_SEM_DEFINE(broker_ready, 0, 1);
+
+static int recv_all(int sock, uint8_t *buf, size_t len)
+{
+	size_t pos = 0;
+	int ret;
+
+	while (pos < len) {
+		ret = recv(sock, buf + pos, len - pos, 0);
+		if (ret <= 0) {
+			return -EIO;
+		}
+
+		pos += ret;
+	}
+
+	return 0;
+}
+
+static void broker_send_ack(int sock, uint8_t type, uint16_t id)
+{
+	uint8_t ack[4] = { type, 2 };
+
+	sys_put_be16(id, &ack[2]);
+	(void)send(sock, ack, sizeof(ack), 0);
+}
+
+static void broker_ack_pending(void)
+{
+	for (int i = 0; i < broker.pending_count; i++) {
+		broker_send_ack(broker.sock,
+				broker.pending[i].qos == 1 ? 0x40 : 0x50,
+				broker.pending[i].message_id);
+	}
+
+	broker.pending_count = 0;
+}
+
+static void broker_publish(int sock, uint8_t type, uint8_t *buf)
+{
+	uint8_t qos = (type >> 1) & 0x03;
+	uint16_t id;
+
+	broker.publish_count++;
+
+	if (type & 0x08) {
+		broker.dup_count++;
+	}
+
+	if (qos == 0) {
+		return;
+	}
+
+	id = sys_get_be16(buf + sizeof(uint16_t) + sys_get_be16(buf));
+
+	if (broker.ack) {
+		broker_send_ack(sock, qos == 1 ? 0x40 : 0x50, id);
+	} else if (broker.pending_count < MAX_PENDING) {
+		broker.pending[broker.pending_count].qos = qos;
+		broker.pending[broker.pending_count].message_id = id;
+		broker.pending_count++;
+	}
+}
+
+static void broker_serve(int sock)
+{
+	static const uint8_t connack[] = { 0x20, 0x02, 0x00, 0x00 };
+	struct zsock_pollfd fds = {
+		.fd = sock,
+		.events = ZSOCK_POLLIN,
+	};
+	uint8_t buf[256];
+	uint32_t len;
+	uint8_t type, byte;
+	int shift;
+
+	while (!broker.drop) {
+		if (poll(&fds, 1, 10) <= 0) {
+			continue;
+		}
+
+		if (recv_all(sock, &type, 1) < 0) {
+			return;
+		}
+
+		len = 0;
+		shift = 0;
+
+		do {
+			if (recv_all(sock, &byte, 1) < 0) {
+				return;
+			}
+
+			len |= (byte & 0x7f) << shift;
+			shift += 7;
+		} while (byte & 0x80);
+
+		if (len > sizeof(buf) || recv_all(sock, buf, len) < 0) {
+			return;
+		}
+
+		switch (type & 0xf0) {
+		case 0x10:
+			(void)send(sock, connack, sizeof(connack), 0);
+			break;
+
+		case 0x30:
+			broker_publish(sock, type, buf);
+			break;
+
+		case 0x60:
+			broker.pubrel_count++;
+			broker_send_ack(sock, 0x70, sys_get_be16(buf));
+			break;
+
+		case 0xe0:
+			return;
+		}
+	}
+}
+
+static void broker_fn(void *p1, void *p2, void *p3)
+{
+	int sock, ret;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	sock = socket(AF_INET6, SOCK_STREAM, IPPROTO_TCP);
+	zassert_true(sock >= 0, "Cannot create broker socket (%d)", errno);
+
+	ret = bind(sock, (struct sockaddr *)&broker_addr, sizeof(broker_addr));
+	zassert_equal(ret, 0, "Cannot bind (%d)", errno);
+
+	ret = listen(sock, 1);
+	zassert_equal(ret, 0, "Cannot listen (%d)", errno);
+
+	k_sem_give(&broker_ready);
+
+	while (true) {
+		broker.sock = accept(sock, NULL, NULL);
+		if (broker.sock < 0) {
+			continue;
+		}
+
+		broker_serve(broker.sock);
+
+		close(broker.sock);
+		broker.sock = -1;
+		broker.drop = false;
+		broker.pending_count = 0;
+	}
+}
+
+static void evt_handler(struct mqtt_client *const client,
+			const struct mqtt_evt *evt)
+{
+	switch (evt->type) {
+	case MQTT_EVT_CONNACK:
+		connected = (evt->result == 0);
+		break;
+
+	case MQTT_EVT_DISCONNECT:
+		connected = false;
+		break;
+
+	case MQTT_EVT_PUBACK:
+		puback_count++;
+		break;
+
+	default:
+		break;
+	}
+}
+
+static void client_process(int timeout)
+{
+	struct zsock_pollfd fds = {
+		.fd = client_ctx.transport.tcp.sock,
+		.events = ZSOCK_POLLIN,
+	};
+
+	if (poll(&fds, 1, timeout) > 0) {
+		(void)mqtt_input(&client_ctx);
+	}
+}
+
+static void client_connect(void)
+{
+	int ret;
+
+	ret = mqtt_connect(&client_ctx);
+	zassert_equal(ret, 0, "Cannot connect (%d)", ret);
+
+	CLIENT_WAIT_FOR(connected);
+	zassert_true(connected, "No CONNACK");
+}
+
+static int client_publish(uint8_t qos, size_t len)
+{
+	struct mqtt_publish_param param = {
+		.message.topic.topic.utf8 = "sensors",
+		.message.topic.topic.size = sizeof("sensors") - 1,
+		.message.topic.qos = qos,
+		.message.payload.data = payload,
+		.message.payload.len = len,
+	};
+
+	if (++message_id == 0) {
+		message_id = 1;
+	}
+
+	param.message_id = message_id;
+
+	return mqtt_publish_queued(&client_ctx, &param);
+}
+
+static void test_outbox_init(void)
+{
+	broker_addr.sin6_family = AF_INET6;
+	broker_addr.sin6_port = htons(SERVER_PORT);
+	inet_pton(AF_INET6, SERVER_ADDR, &broker_addr.sin6_addr);
+
+	broker.sock = -1;
+	broker.ack = true;
+
+	k_thread_create(&broker_thread, broker_stack,
+			K_THREAD_STACK_SIZEOF(broker_stack), broker_fn,
+			NULL, NULL, NULL, BROKER_PRIORITY, 0, K_NO_WAIT);
+
+	k_sem_take(&broker_ready, K_FOREVER);
+
+	mqtt_client_init(&client_ctx);
+
+	client_ctx.broker = &broker_addr;
+	client_ctx.evt_cb = evt_handler;
+	client_ctx.client_id.utf8 = "zephyr_outbox";
+	client_ctx.client_id.size = sizeof("zephyr_outbox") - 1;
+	client_ctx.transport.type = MQTT_TRANSPORT_NON_SECURE;
+	client_ctx.rx_buf = rx_buffer;
+	client_ctx.rx_buf_size = sizeof(rx_buffer);
+	client_ctx.tx_buf = tx_buffer;
+	client_ctx.tx_buf_size = sizeof(tx_buffer);
+	client_ctx.outbox_buf = outbox_buffer;
+	client_ctx.outbox_buf_size = sizeof(outbox_buffer);
+
+	/* Messages can be queued before the connection is up. */
+	zassert_equal(client_publish(MQTT_QOS_1_AT_LEAST_ONCE, 8), 0,
+		      "Cannot queue message");
+	zassert_equal(mqtt_outbox_count(&client_ctx), 1, "Message not queued");
+
+	client_connect();
+
+	CLIENT_WAIT_FOR(mqtt_outbox_count(&client_ctx) == 0);
+	zassert_equal(mqtt_outbox_count(&client_ctx), 0, "Message not sent");
+	zassert_equal(broker.publish_count, 1, "Broker got %d messages",
+		      broker.publish_count);
+}
+
+static void test_outbox_window(void)
+{
+	int ret, i;
+
+	broker.ack = false;
+	broker.publish_count = 0;
+
+	for (i = 0; i < 2 * WINDOW; i++) {
+		ret = client_publish(MQTT_QOS_1_AT_LEAST_ONCE, 16);
+		zassert_equal(ret, 0, "Cannot queue message (%d)", ret);
+	}
+
+	ret = mqtt_outbox_flush(&client_ctx);
+	zassert_equal(ret, 0, "Cannot flush (%d)", ret);
+
+	/* Only a window worth of messages may be unacknowledged. */
+	client_process(100);
+	zassert_equal(broker.publish_count, WINDOW, "Broker got %d messages",
+		      broker.publish_count);
+	zassert_equal(mqtt_outbox_count(&client_ctx), 2 * WINDOW,
+		      "Messages dropped from outbox");
+
+	broker.ack = true;
+	broker_ack_pending();
+
+	CLIENT_WAIT_FOR(mqtt_outbox_count(&client_ctx) == 0);
+	zassert_equal(mqtt_outbox_count(&client_ctx), 0, "Messages not acked");
+	zassert_equal(broker.publish_count, 2 * WINDOW,
+		      "Broker got %d messages", broker.publish_count);
+}
+
+static void test_outbox_qos2(void)
+{
+	int ret;
+
+	broker.pubrel_count = 0;
+
+	ret = client_publish(MQTT_QOS_2_EXACTLY_ONCE, 16);
+	zassert_equal(ret, 0, "Cannot queue message (%d)", ret);
+
+	ret = mqtt_outbox_flush(&client_ctx);
+	zassert_equal(ret, 0, "Cannot flush (%d)", ret);
+
+	CLIENT_WAIT_FOR(mqtt_outbox_count(&client_ctx) == 0);
+	zassert_equal(mqtt_outbox_count(&client_ctx), 0, "Message not done");
+	zassert_equal(broker.pubrel_count, 1, "PUBREL not sent");
+}
+
+static void test_outbox_retransmit(void)
+{
+	int ret, i;
+
+	broker.ack = false;
+	broker.publish_count = 0;
+	broker.dup_count = 0;
+
+	for (i = 0; i < 2; i++) {
+		ret = client_publish(MQTT_QOS_1_AT_LEAST_ONCE, 16);
+		zassert_equal(ret, 0, "Cannot queue message (%d)", ret);
+	}
+
+	ret = mqtt_outbox_flush(&client_ctx);
+	zassert_equal(ret, 0, "Cannot flush (%d)", ret);
+
+	client_process(100);
+	zassert_equal(broker.publish_count, 2, "Broker got %d messages",
+		      broker.publish_count);
+
+	/* Lose the connection before the messages are acknowledged. */
+	broker.drop = true;
+
+	CLIENT_WAIT_FOR(!connected);
+	zassert_false(connected, "Connection not closed");
+	zassert_equal(mqtt_outbox_count(&client_ctx), 2, "Messages lost");
+
+	broker.ack = true;
+	client_connect();
+
+	CLIENT_WAIT_FOR(mqtt_outbox_count(&client_ctx) == 0);
+	zassert_equal(mqtt_outbox_count(&client_ctx), 0, "Messages not acked");
+	zassert_equal(broker.dup_count, 2, "%d messages retransmitted",
+		      broker.dup_count);
+}
+
+static void test_outbox_throughput(void)
+{
+	uint32_t queued_ms, direct_ms;
+	int64_t start;
+	int ret, i;
+
+	broker.ack = true;
+
+	start = k_uptime_get();
+
+	for (i = 0; i < PERF_MSG_COUNT; i++) {
+		while (true) {
+			ret = client_publish(MQTT_QOS_1_AT_LEAST_ONCE,
+					     PERF_MSG_SIZE);
+			if (ret != -ENOMEM) {
+				break;
+			}
+
+			message_id--;
+			client_process(1);
+		}
+
+		zassert_equal(ret, 0, "Cannot queue message (%d)", ret);
+	}
+
+	(void)mqtt_outbox_flush(&client_ctx);
+	CLIENT_WAIT_FOR(mqtt_outbox_count(&client_ctx) == 0);
+	zassert_equal(mqtt_outbox_count(&client_ctx), 0, "Messages not acked");
+
+	queued_ms = k_uptime_get() - start;
+
+	/* Compare with publishing one message at a time, waiting for its
+	 * acknowledgment.
+	 */
+	puback_count = 0;
+	start = k_uptime_get();
+
+	for (i = 0; i < PERF_MSG_COUNT; i++) {
+		struct mqtt_publish_param param = {
+			.message.topic.topic.utf8 = "sensors",
+			.message.topic.topic.size = sizeof("sensors") - 1,
+			.message.topic.qos = MQTT_QOS_1_AT_LEAST_ONCE,
+			.message.payload.data = payload,
+			.message.payload.len = PERF_MSG_SIZE,
+			.message_id = i + 1,
+		};
+
+		ret = mqtt_publish(&client_ctx, &param);
+		zassert_equal(ret, 0, "Cannot publish (%d)", ret);
+
+		CLIENT_WAIT_FOR(puback_count == i + 1);
+	}
+
+	direct_ms = k_uptime_get() - start;
+
+	printk("mqtt outbox: %d messages in %u ms, one by one: %u ms\n",
+	       PERF_MSG_COUNT, queued_ms, direct_ms);
+
+	ret = mqtt_disconnect(&client_ctx);
+	zassert_equal(ret, 0, "Cannot disconnect (%d)", ret);
+}
+
+void test_main(void)
+{
+	ztest_test_suite(mqtt_outbox,
+			 ztest_unit_test(test_outbox_init),
+			 ztest_unit_test(test_outbox_window),
+			 ztest_unit_test(test_outbox_qos2),
+			 ztest_unit_test(test_outbox_retransmit),
+			 ztest_unit_test(test_outbox_throughput));
+
+	ztest_run_test_suite(mqtt_outbox);
+}
@@ -544,6 +544,41 @@ static void test_route_preference(void)
 	net_route_del(entry);
 }
 
+static void test_route_longest_prefix(void)
+{
+	struct in6_addr prefix = { { { 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0,
+				       0, 0, 0, 0, 0, 0, 0, 0 } } };
+	struct in6_addr other_addr = { { { 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0,
+					   0, 0, 0, 0, 0, 0, 0, 0x42 } } };
+	struct net_route_entry *prefix_entry, *host_entry;
+
+	prefix_entry = net_route_add(my_iface, &prefix, 64, &peer_addr,
+				     NET_IPV6_ND_INFINITE_LIFETIME,
+				     NET_ROUTE_PREFERENCE_LOW);
+	zassert_not_null(prefix_entry, "Prefix route add failed");
+
+	host_entry = net_route_add(my_iface, &dest_addr, 128, &peer_addr_alt,
+				   NET_IPV6_ND_INFINITE_LIFETIME,
+				   NET_ROUTE_PREFERENCE_LOW);
+	zassert_not_null(host_entry, "Host route add failed");
+	zassert_not_equal(host_entry, prefix_entry,
+			  "Host route replaced prefix route");
+
+	zassert_equal_ptr(net_route_lookup(my_iface, &dest_addr), host_entry,
+			  "Longest prefix not found");
+	zassert_equal_ptr(net_route_lookup(my_iface, &other_addr),
+			  prefix_entry, "Prefix route not found");
+
+	zassert_equal(net_route_del(host_entry), 0, "Route del failed");
+
+	zassert_equal_ptr(net_route_lookup(my_iface, &dest_addr), prefix_entry,
+			  "Deleted route still found");
+
+	zassert_equal(net_route_del(prefix_entry), 0, "Route del failed");
+
+	zassert_is_null(net_route_lookup(my_iface, &other_addr),
+			"Deleted route still found");
+}
 
 /*test case main entry*/
 void test_main(void)
@@ -566,6 +601,7 @@ void test_main(void)
 			ztest_unit_test(test_route_add_many),
 			ztest_unit_test(test_route_del_many),
 			ztest_unit_test(test_route_lifetime),
-			ztest_unit_test(test_route_preference));
+			ztest_unit_test(test_route_preference),
+			ztest_unit_test(test_route_longest_prefix));
 	ztest_run_test_suite(test_route);
 }
@@ -269,7 +269,7 @@ static void test_recv_two_msg(void)
 	test_recv_2(sizeof(frame1) + FRAME1_HDR_SIZE / 2);
 }
 
-int verify_sent_and_received_msg(struct msghdr *msg, bool split_msg)
+static int verify_frame(struct msghdr *msg, bool split_msg)
 {
 	static struct websocket_context ctx;
 	uint32_t msg_type = -1;
@@ -332,6 +332,63 @@ int verify_sent_and_received_msg(struct msghdr *msg, bool split_msg)
 	return msg->msg_iov[0].iov_len + total_read;
 }
 
+/* Masked data is sent in several chunks, so collect the chunks until the
+ * whole frame has been sent and only then verify it.
+ */
+int verify_sent_and_received_msg(struct msghdr *msg, bool split_msg)
+{
+	static uint8_t sent_buf[sizeof(lorem_ipsum) + EXTRA_BUF_SPACE];
+	static size_t sent_len;
+	struct iovec io_vector[2];
+	struct msghdr frame;
+	size_t len = 0, hdr_len;
+	int i;
+
+	for (i = 0; i < msg->msg_iovlen; i++) {
+		zassert_true(sent_len + msg->msg_iov[i].iov_len <=
+			     sizeof(sent_buf), "Sent too much data");
+
+		memcpy(sent_buf + sent_len, msg->msg_iov[i].iov_base,
+		       msg->msg_iov[i].iov_len);
+		sent_len += msg->msg_iov[i].iov_len;
+		len += msg->msg_iov[i].iov_len;
+	}
+
+	hdr_len = 2;
+
+	if ((sent_buf[1] & 0x7f) == 126) {
+		hdr_len += 2;
+	} else if ((sent_buf[1] & 0x7f) == 127) {
+		hdr_len += 8;
+	}
+
+	if (sent_buf[1] & BIT(7)) {
+		hdr_len += sizeof(uint32_t);
+	}
+
+	if (sent_len < hdr_len + test_msg_len) {
+		return len;
+	}
+
+	zassert_equal(sent_len, hdr_len + test_msg_len,
+		      "Invalid frame length %zd", sent_len);
+
+	io_vector[0].iov_base = sent_buf;
+	io_vector[0].iov_len = hdr_len;
+	io_vector[1].iov_base = sent_buf + hdr_len;
+	io_vector[1].iov_len = test_msg_len;
+
+	memset(&frame, 0, sizeof(frame));
+	frame.msg_iov = io_vector;
+	frame.msg_iovlen = ARRAY_SIZE(io_vector);
+
+	sent_len = 0;
+
+	(void)verify_frame(&frame, split_msg);
+
+	return len;
+}
+
 static void test_send_and_recv_lorem_ipsum(void)
 {
 	static struct websocket_context ctx;
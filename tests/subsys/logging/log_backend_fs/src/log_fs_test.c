@@ -15,6 +15,7 @@
 #include <zephyr/zephyr.h>
 #include <ztest.h>
 #include <zephyr/fs/fs.h>
+#include <zephyr/logging/log_backend_fs.h>
 
 #define DT_DRV_COMPAT zephyr_fstab_littlefs
 #define TEST_AUTOMOUNT DT_PROP(DT_DRV_INST(0), automount)
@@ -97,6 +98,7 @@ static void test_log_fs_file_content(void)
 	fs_file_t_init(&file);
 
 	rc = write_log_to_file(to_log, sizeof(to_log), NULL);
+	zassert_equal(log_backend_fs_sync(), 0, "Can not sync log file.");
 
 	sprintf(fname, "%s/%s0000", CONFIG_LOG_BACKEND_FS_DIR, log_prefix);
 
@@ -113,6 +115,7 @@ static void test_log_fs_file_content(void)
 
 	to_log[sizeof(to_log)-2] = '2';
 	rc = write_log_to_file(to_log, sizeof(to_log), NULL);
+	zassert_equal(log_backend_fs_sync(), 0, "Can not sync log file.");
 
 	zassert_equal(fs_open(&file, fname, FS_O_READ), 0,
 		      "Can not open log file.");
@@ -154,6 +157,8 @@ static void test_log_fs_file_size(void)
 		ARG_UNUSED(rc);
 	}
 
+	zassert_equal(log_backend_fs_sync(), 0, "Can not sync log file.");
+
 	zassert_equal(fs_stat(fname, &entry), 0, "Can not get file info.");
 	size_t exp_size = CONFIG_LOG_BACKEND_FS_FILE_SIZE -
 			  (CONFIG_LOG_BACKEND_FS_FILE_SIZE - entry.size) %
@@ -208,6 +213,8 @@ static void test_log_fs_files_max(void)
 		ARG_UNUSED(rc);
 	}
 
+	zassert_equal(log_backend_fs_sync(), 0, "Can not sync log file.");
+
 	rc = fs_opendir(&dir, CONFIG_LOG_BACKEND_FS_DIR);
 	zassert_equal(rc, 0, "Can not open directory.");
 	/* Count log files. */
@@ -230,6 +237,41 @@ static void test_log_fs_files_max(void)
 	zassert_equal(test_mask, 0b11110, "Unexpected file numeration");
 }
 
+static void test_log_fs_sync_count(void)
+{
+	struct log_backend_fs_stats before, after;
+	uint8_t to_log[] = "Sync Log";
+	int i;
+
+	log_backend_fs_get_stats(&before);
+
+	for (i = 0; i < 4; i++) {
+		zassert_equal(write_log_to_file(to_log, sizeof(to_log), NULL),
+			      sizeof(to_log), "Unexpected retval.");
+	}
+
+	zassert_equal(log_backend_fs_sync(), 0, "Can not sync log file.");
+
+	log_backend_fs_get_stats(&after);
+
+	zassert_equal(after.bytes - before.bytes, 4 * sizeof(to_log),
+		      "Unexpected number of bytes written");
+
+	if (IS_ENABLED(CONFIG_LOG_BACKEND_FS_BUFFERED)) {
+		/* A file change costs one more write but no sync */
+		zassert_true(after.writes - before.writes <= 2,
+			     "Too many writes (%u)",
+			     after.writes - before.writes);
+		zassert_equal(after.syncs - before.syncs, 1,
+			      "Unexpected number of syncs");
+	} else {
+		zassert_equal(after.writes - before.writes, 4,
+			      "Unexpected number of writes");
+		zassert_equal(after.syncs - before.syncs, 4,
+			      "Unexpected number of syncs");
+	}
+}
+
 /* Test case main entry. */
 void test_main(void)
 {
@@ -238,6 +280,7 @@ void test_main(void)
 			 ztest_unit_test(test_wipe_fs_logs),
 			 ztest_unit_test(test_log_fs_file_content),
 			 ztest_unit_test(test_log_fs_file_size),
-			 ztest_unit_test(test_log_fs_files_max));
+			 ztest_unit_test(test_log_fs_files_max),
+			 ztest_unit_test(test_log_fs_sync_count));
 	ztest_run_test_suite(test_log_backend_fs);
 }
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Test IPC service log backend
+ */
+
+#include <zephyr/logging/log.h>
+#include <zephyr/logging/log_ctrl.h>
+#include <zephyr/logging/log_backend.h>
+#include <zephyr/logging/log_output_dict.h>
+#include <zephyr/ipc/ipc_service_backend.h>
+#include <zephyr/zephyr.h>
+#include <ztest.h>
+
+#define LOG_MODULE_NAME test
+LOG_MODULE_REGISTER(LOG_MODULE_NAME);
+
+static uint8_t sent_buf[512];
+static size_t sent_len;
+static int sent_cnt;
+
+static int ipc_test_register_endpoint(const struct device *instance,
+				      void **token,
+				      const struct ipc_ept_cfg *cfg)
+{
+	cfg->cb.bound(cfg->priv);
+
+	return 0;
+}
+
+static int ipc_test_send(const struct device *instance, void *token,
+			 const void *data, size_t len)
+{
+	zassert_true(sent_len + len <= sizeof(sent_buf), "Too much data");
+
+	memcpy(&sent_buf[sent_len], data, len);
+	sent_len += len;
+	sent_cnt++;
+
+	return len;
+}
+
+static const struct ipc_service_backend ipc_test_api = {
+	.register_endpoint = ipc_test_register_endpoint,
+	.send = ipc_test_send,
+};
+
+static int ipc_test_init(const struct device *dev)
+{
+	return 0;
+}
+
+DEVICE_DT_DEFINE(DT_NODELABEL(ipc_test), ipc_test_init, NULL, NULL, NULL,
+		 POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEVICE,
+		 &ipc_test_api);
+
+/* Without the logging thread nothing retries the backend activation after
+ * the IPC instance is initialized, do it here.
+ */
+static void test_log_backend_ipc_activate(void)
+{
+	const struct log_backend *backend;
+
+	backend = log_backend_get_by_name("log_backend_ipc");
+	zassert_not_null(backend, "Backend not found");
+
+	zassert_equal(log_backend_is_ready(backend), 0, "Backend not ready");
+	log_backend_enable(backend, NULL, CONFIG_LOG_MAX_LEVEL);
+}
+
+static void process_all(void)
+{
+	sent_len = 0;
+	sent_cnt = 0;
+
+	while (log_process()) {
+	}
+}
+
+static void test_log_backend_ipc_msg(void)
+{
+	struct log_dict_output_normal_msg_hdr_t *hdr =
+		(struct log_dict_output_normal_msg_hdr_t *)sent_buf;
+
+	process_all();
+
+	LOG_INF("test %d", 42);
+	process_all();
+
+	/* Message is sent unformatted in one transfer */
+	zassert_equal(sent_cnt, 1, "Unexpected transfers: %d", sent_cnt);
+	zassert_equal(hdr->type, MSG_NORMAL, NULL);
+	zassert_equal(hdr->level, LOG_LEVEL_INF, NULL);
+	zassert_equal(hdr->data_len, 0, NULL);
+	zassert_equal(sent_len, sizeof(*hdr) + hdr->package_len,
+		      "Unexpected length: %zu", sent_len);
+}
+
+static void test_log_backend_ipc_long_msg(void)
+{
+	struct log_dict_output_normal_msg_hdr_t *hdr =
+		(struct log_dict_output_normal_msg_hdr_t *)sent_buf;
+	uint8_t data[100];
+
+	for (int i = 0; i < sizeof(data); i++) {
+		data[i] = i;
+	}
+
+	process_all();
+
+	LOG_HEXDUMP_WRN(data, sizeof(data), "data");
+	process_all();
+
+	/* Longer than the backend buffer so split into transfers */
+	zassert_equal(sent_cnt,
+		      ceiling_fraction(sent_len,
+				       CONFIG_LOG_BACKEND_IPC_BUFFER_SIZE),
+		      "Unexpected transfers: %d", sent_cnt);
+	zassert_equal(hdr->level, LOG_LEVEL_WRN, NULL);
+	zassert_equal(hdr->data_len, sizeof(data), NULL);
+	zassert_equal(sent_len, sizeof(*hdr) + hdr->package_len + sizeof(data),
+		      "Unexpected length: %zu", sent_len);
+	zassert_mem_equal(&sent_buf[sent_len - sizeof(data)], data,
+			  sizeof(data), NULL);
+}
+
+/*test case main entry*/
+void test_main(void)
+{
+	ztest_test_suite(test_log_backend_ipc,
+			 ztest_unit_test(test_log_backend_ipc_activate),
+			 ztest_unit_test(test_log_backend_ipc_msg),
+			 ztest_unit_test(test_log_backend_ipc_long_msg));
+	ztest_run_test_suite(test_log_backend_ipc);
+}
@@ -0,0 +1,301 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Test networking (syslog) log backend
+ */
+
+#include <zephyr/logging/log.h>
+#include <zephyr/logging/log_ctrl.h>
+#include <zephyr/logging/log_backend.h>
+#include <zephyr/logging/log_backend_net.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/zephyr.h>
+#include <ztest.h>
+#include <stdlib.h>
+
+#define LOG_MODULE_NAME test
+LOG_MODULE_REGISTER(LOG_MODULE_NAME);
+
+/* Port of CONFIG_LOG_BACKEND_NET_SERVER */
+#define SERVER_PORT 5514
+
+#if defined(CONFIG_LOG_BACKEND_NET_BATCH)
+#define BATCH_SIZE CONFIG_LOG_BACKEND_NET_BATCH_SIZE
+#define BATCH_TIMEOUT CONFIG_LOG_BACKEND_NET_BATCH_TIMEOUT
+#else
+#define BATCH_SIZE 0
+#define BATCH_TIMEOUT 0
+#endif
+
+static int sock;
+static uint8_t rx_buf[1500];
+
+static void process_all(void)
+{
+	while (log_process()) {
+	}
+}
+
+/* Returns length of the received datagram or 0 if there is none. */
+static size_t receive(int timeout)
+{
+	struct pollfd pfd = {
+		.fd = sock,
+		.events = POLLIN,
+	};
+	ssize_t ret;
+
+	if (poll(&pfd, 1, timeout) <= 0) {
+		return 0;
+	}
+
+	ret = recv(sock, rx_buf, sizeof(rx_buf), 0);
+	zassert_true(ret > 0, "recv failed (%d)", errno);
+
+	return ret;
+}
+
+/* Validate octet counting framing and return number of messages. */
+static int count_frames(size_t len)
+{
+	size_t pos = 0;
+	int cnt = 0;
+
+	while (pos < len) {
+		char *end;
+		unsigned long frame_len;
+
+		frame_len = strtoul((char *)&rx_buf[pos], &end, 10);
+		zassert_equal(*end, ' ', "Invalid frame header");
+
+		pos = (uint8_t *)end - rx_buf + 1 + frame_len;
+		zassert_true(pos <= len, "Frame exceeds datagram");
+
+		/* Syslog messages start with the priority */
+		zassert_equal(end[1], '<', "Invalid message");
+		cnt++;
+	}
+
+	return cnt;
+}
+
+static void test_log_backend_net_setup(void)
+{
+	struct sockaddr_in addr = {
+		.sin_family = AF_INET,
+		.sin_port = htons(SERVER_PORT),
+		.sin_addr = { { { 127, 0, 0, 1 } } },
+	};
+
+	sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	zassert_true(sock >= 0, "Cannot create socket (%d)", errno);
+
+	zassert_ok(bind(sock, (struct sockaddr *)&addr, sizeof(addr)),
+		   "Cannot bind (%d)", errno);
+
+	zassert_true(log_backend_is_active(log_backend_net_get()),
+		     "Backend not active");
+
+	/* Drop messages logged while the system was starting. */
+	process_all();
+	zassert_ok(log_backend_net_flush(), "Flush failed");
+
+	while (receive(10) > 0) {
+	}
+}
+
+static void test_log_backend_net_batch(void)
+{
+	struct log_backend_net_stats before, after;
+	size_t len;
+
+	if (!IS_ENABLED(CONFIG_LOG_BACKEND_NET_BATCH)) {
+		ztest_test_skip();
+	}
+
+	log_backend_net_get_stats(&before);
+
+	for (int i = 0; i < 3; i++) {
+		LOG_INF("test message %d", i);
+	}
+
+	process_all();
+
+	log_backend_net_get_stats(&after);
+	zassert_equal(after.queued, 3, "Unexpected queued: %u", after.queued);
+	zassert_equal(receive(0), 0, "Sent before flush");
+
+	zassert_ok(log_backend_net_flush(), "Flush failed");
+
+	len = receive(100);
+	zassert_true(len > 0, "Nothing received");
+	zassert_equal(count_frames(len), 3, "Unexpected number of messages");
+
+	log_backend_net_get_stats(&after);
+	zassert_equal(after.queued, 0, NULL);
+	zassert_equal(after.sent - before.sent, 3, NULL);
+	zassert_equal(after.datagrams - before.datagrams, 1, NULL);
+	zassert_equal(after.dropped, before.dropped, NULL);
+}
+
+static void test_log_backend_net_batch_timeout(void)
+{
+	size_t len;
+
+	if (!IS_ENABLED(CONFIG_LOG_BACKEND_NET_BATCH)) {
+		ztest_test_skip();
+	}
+
+	LOG_WRN("test message");
+	process_all();
+
+	len = receive(2 * BATCH_TIMEOUT);
+	zassert_true(len > 0, "Not sent after timeout");
+	zassert_equal(count_frames(len), 1, "Unexpected number of messages");
+}
+
+static void test_log_backend_net_batch_full(void)
+{
+	struct log_backend_net_stats before, after;
+	int datagrams = 0;
+	int cnt = 0;
+	size_t len;
+
+	if (!IS_ENABLED(CONFIG_LOG_BACKEND_NET_BATCH)) {
+		ztest_test_skip();
+	}
+
+	log_backend_net_get_stats(&before);
+
+	for (int i = 0; i < 20; i++) {
+		LOG_INF("test message %d which is long enough to fill "
+			"a datagram with a few of them", i);
+	}
+
+	process_all();
+	zassert_ok(log_backend_net_flush(), "Flush failed");
+
+	while ((len = receive(100)) > 0) {
+		zassert_true(len <= BATCH_SIZE,
+			     "Datagram too long: %zu", len);
+		cnt += count_frames(len);
+		datagrams++;
+	}
+
+	zassert_equal(cnt, 20, "Unexpected number of messages: %d", cnt);
+	zassert_true(datagrams > 1, "Messages not split into datagrams");
+
+	log_backend_net_get_stats(&after);
+	zassert_equal(after.sent - before.sent, 20, NULL);
+	zassert_equal(after.datagrams - before.datagrams, datagrams, NULL);
+}
+
+static void test_log_backend_net_truncate(void)
+{
+	struct log_backend_net_stats before, after;
+	char str[BATCH_SIZE + 1];
+	size_t len;
+
+	if (!IS_ENABLED(CONFIG_LOG_BACKEND_NET_BATCH)) {
+		ztest_test_skip();
+	}
+
+	memset(str, 'a', sizeof(str) - 1);
+	str[sizeof(str) - 1] = '\0';
+
+	log_backend_net_get_stats(&before);
+
+	LOG_ERR("%s", str);
+	process_all();
+	zassert_ok(log_backend_net_flush(), "Flush failed");
+
+	len = receive(100);
+	zassert_true(len <= BATCH_SIZE,
+		     "Datagram too long: %zu", len);
+	zassert_equal(count_frames(len), 1, "Unexpected number of messages");
+
+	log_backend_net_get_stats(&after);
+	zassert_equal(after.truncated - before.truncated, 1, NULL);
+}
+
+static void test_log_backend_net_no_batch(void)
+{
+	struct log_backend_net_stats before, after;
+	size_t len;
+
+	if (IS_ENABLED(CONFIG_LOG_BACKEND_NET_BATCH)) {
+		ztest_test_skip();
+	}
+
+	log_backend_net_get_stats(&before);
+
+	for (int i = 0; i < 3; i++) {
+		LOG_INF("test message %d", i);
+	}
+
+	process_all();
+
+	/* One unframed message per datagram */
+	for (int i = 0; i < 3; i++) {
+		len = receive(100);
+		zassert_true(len > 0, "Nothing received");
+		zassert_equal(rx_buf[0], '<', "Invalid message");
+	}
+
+	log_backend_net_get_stats(&after);
+	zassert_equal(after.sent - before.sent, 3, NULL);
+	zassert_equal(after.datagrams - before.datagrams, 3, NULL);
+	zassert_equal(after.queued, 0, NULL);
+}
+
+/* Must be the last test, logging stays in panic mode. */
+static void test_log_backend_net_panic(void)
+{
+	struct log_backend_net_stats before, after;
+	size_t len;
+
+	if (!IS_ENABLED(CONFIG_LOG_BACKEND_NET_BATCH)) {
+		ztest_test_skip();
+	}
+
+	log_backend_net_get_stats(&before);
+
+	for (int i = 0; i < 3; i++) {
+		LOG_ERR("test message %d", i);
+	}
+
+	process_all();
+
+	log_backend_net_get_stats(&after);
+	zassert_equal(after.queued, 3, "Unexpected queued: %u", after.queued);
+
+	/* Batched messages are sent on panic without waiting for timeout */
+	log_panic();
+
+	len = receive(BATCH_TIMEOUT / 2);
+	zassert_true(len > 0, "Batch not sent on panic");
+	zassert_equal(count_frames(len), 3, "Unexpected number of messages");
+
+	log_backend_net_get_stats(&after);
+	zassert_equal(after.queued, 0, NULL);
+	zassert_equal(after.sent - before.sent, 3, NULL);
+}
+
+/*test case main entry*/
+void test_main(void)
+{
+	ztest_test_suite(test_log_backend_net,
+			 ztest_unit_test(test_log_backend_net_setup),
+			 ztest_unit_test(test_log_backend_net_batch),
+			 ztest_unit_test(test_log_backend_net_batch_timeout),
+			 ztest_unit_test(test_log_backend_net_batch_full),
+			 ztest_unit_test(test_log_backend_net_truncate),
+			 ztest_unit_test(test_log_backend_net_no_batch),
+			 ztest_unit_test(test_log_backend_net_panic));
+	ztest_run_test_suite(test_log_backend_net);
+}
@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Test of the retained RAM log backend
+ */
+
+#include <zephyr/zephyr.h>
+#include <ztest.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/logging/log_backend.h>
+#include <zephyr/logging/log_backend_retained.h>
+#include <zephyr/logging/log_ctrl.h>
+#include <zephyr/logging/log_output.h>
+
+LOG_MODULE_REGISTER(test, LOG_LEVEL_INF);
+
+extern uint8_t log_backend_retained_buf[CONFIG_LOG_BACKEND_RETAINED_SIZE];
+
+static size_t msg_cnt;
+static char out_buf[2048];
+static size_t out_len;
+static uint8_t buf;
+
+static int char_out(uint8_t *data, size_t length, void *ctx)
+{
+	size_t len = MIN(length, sizeof(out_buf) - 1 - out_len);
+
+	memcpy(&out_buf[out_len], data, len);
+	out_len += len;
+	out_buf[out_len] = '\0';
+
+	return length;
+}
+
+LOG_OUTPUT_DEFINE(log_output, char_out, &buf, 1);
+
+static void process(const struct log_backend *const backend,
+		    union log_msg2_generic *msg)
+{
+	msg_cnt++;
+	log_output_msg2_process(&log_output, &msg->log, 0);
+}
+
+static void panic(const struct log_backend *const backend)
+{
+	ARG_UNUSED(backend);
+}
+
+static const struct log_backend_api backend_api = {
+	.process = process,
+	.panic = panic,
+};
+
+/* Target of the replay, not attached to the logger. */
+LOG_BACKEND_DEFINE(test_backend, backend_api, false);
+
+/* Let the retained backend validate the buffer as after reset. */
+static void reboot(void)
+{
+	while (log_process()) {
+	}
+
+	log_backend_init(log_backend_get_by_name("log_backend_retained"));
+}
+
+static int replay(void)
+{
+	msg_cnt = 0;
+	out_len = 0;
+	out_buf[0] = '\0';
+
+	return log_backend_retained_replay(&test_backend);
+}
+
+static void test_replay(void)
+{
+	char str[] = "not read-only";
+	uint8_t data[] = { 0xde, 0xad, 0xbe, 0xef };
+
+	log_backend_retained_clear();
+
+	LOG_INF("first %d", 1);
+	LOG_WRN("string %s", str);
+	LOG_HEXDUMP_ERR(data, sizeof(data), "hexdump");
+
+	/* String is copied when the message is stored. */
+	while (log_process()) {
+	}
+	strcpy(str, "overwritten");
+
+	zassert_equal(replay(), 0, "Messages of this boot replayed");
+
+	reboot();
+	zassert_equal(replay(), 3, NULL);
+	zassert_equal(msg_cnt, 3, NULL);
+	zassert_true(strstr(out_buf, "first 1") != NULL,
+		     "Unexpected output: %s", out_buf);
+	zassert_true(strstr(out_buf, "string not read-only") != NULL,
+		     "Unexpected output: %s", out_buf);
+	zassert_true(strstr(out_buf, "de ad be ef") != NULL,
+		     "Unexpected output: %s", out_buf);
+
+	/* Messages are kept and new ones are not replayed. */
+	LOG_INF("after reboot");
+	while (log_process()) {
+	}
+
+	zassert_equal(replay(), 3, NULL);
+	zassert_true(strstr(out_buf, "after reboot") == NULL,
+		     "Unexpected output: %s", out_buf);
+
+	reboot();
+	zassert_equal(replay(), 4, NULL);
+}
+
+static void test_corrupted(void)
+{
+	int last = sizeof(log_backend_retained_buf) - 1;
+
+	log_backend_retained_clear();
+
+	for (int i = 0; i < 3; i++) {
+		LOG_INF("message %d", i);
+	}
+
+	/* Corrupt the last record as if reset occurred while writing it. */
+	while (log_process()) {
+	}
+
+	while (log_backend_retained_buf[last] == 0) {
+		last--;
+	}
+
+	log_backend_retained_buf[last] ^= 0xff;
+
+	reboot();
+	zassert_equal(replay(), 2, NULL);
+	zassert_true(strstr(out_buf, "message 2") == NULL,
+		     "Unexpected output: %s", out_buf);
+
+	/* Invalid buffer is discarded. */
+	log_backend_retained_buf[0] ^= 0xff;
+
+	reboot();
+	zassert_equal(replay(), 0, NULL);
+}
+
+static void test_overwrite(void)
+{
+	int n;
+
+	log_backend_retained_clear();
+
+	for (int i = 0; i < 100; i++) {
+		LOG_INF("message %d", i);
+
+		while (log_process()) {
+		}
+	}
+
+	reboot();
+	n = replay();
+	zassert_true(n > 0 && n < 100, "Unexpected count %d", n);
+	zassert_true(strstr(out_buf, "message 99") != NULL,
+		     "Unexpected output: %s", out_buf);
+
+	/* Only the newest messages are kept. */
+	zassert_equal(atoi(strstr(out_buf, "message ") + strlen("message ")),
+		      100 - n, "Unexpected output: %s", out_buf);
+
+	/* Buffer is consistent after validation. */
+	reboot();
+	zassert_equal(replay(), n, NULL);
+}
+
+static void test_clear(void)
+{
+	LOG_INF("message");
+
+	while (log_process()) {
+	}
+
+	log_backend_retained_clear();
+	reboot();
+	zassert_equal(replay(), 0, NULL);
+}
+
+void test_main(void)
+{
+	ztest_test_suite(test_log_backend_retained,
+			 ztest_unit_test(test_replay),
+			 ztest_unit_test(test_corrupted),
+			 ztest_unit_test(test_overwrite),
+			 ztest_unit_test(test_clear));
+	ztest_run_test_suite(test_log_backend_retained);
+}
@@ -17,6 +17,7 @@
 #include <ztest.h>
 #include <zephyr/logging/log_backend.h>
 #include <zephyr/logging/log_ctrl.h>
+#include <zephyr/logging/log_output.h>
 #include <zephyr/logging/log.h>
 #include "test_helpers.h"
 
@@ -72,6 +73,34 @@ const struct log_backend_api log_backend_test_api = {
 LOG_BACKEND_DEFINE(backend, log_backend_test_api, false);
 struct backend_cb backend_ctrl_blk;
 
+static int text_out(uint8_t *data, size_t length, void *ctx)
+{
+	return length;
+}
+
+static uint8_t text_buf1[64];
+static uint8_t text_buf2[64];
+LOG_OUTPUT_DEFINE(text_output1, text_out, text_buf1, sizeof(text_buf1));
+LOG_OUTPUT_DEFINE(text_output2, text_out, text_buf2, sizeof(text_buf2));
+
+/* Two text backends formatting each message, e.g. UART and RTT. */
+static void text_process(struct log_backend const *const backend,
+			 union log_msg2_generic *msg)
+{
+	const struct log_output *output = backend->cb->ctx;
+
+	log_output_msg2_process(output, &msg->log,
+				LOG_OUTPUT_FLAG_LEVEL | LOG_OUTPUT_FLAG_TIMESTAMP |
+				LOG_OUTPUT_FLAG_FORMAT_TIMESTAMP);
+}
+
+const struct log_backend_api log_backend_text_api = {
+	.process = text_process,
+};
+
+LOG_BACKEND_DEFINE(text_backend1, log_backend_text_api, false);
+LOG_BACKEND_DEFINE(text_backend2, log_backend_text_api, false);
+
 #define TEST_FORMAT_SPEC(i, _) " %d"
 #define TEST_VALUE(i, _), i
 
@@ -225,6 +254,39 @@ void test_log_message_with_string(void)
 		cyc / repeat, us / repeat);
 }
 
+/** Measure time spent processing messages by two text backends. */
+void test_log_message_process_time(void)
+{
+	int repeat = 20;
+	uint32_t cyc;
+
+	test_helpers_log_setup();
+	log_backend_enable(&text_backend1, (void *)&text_output1,
+			   LOG_LEVEL_DBG);
+	log_backend_enable(&text_backend2, (void *)&text_output2,
+			   LOG_LEVEL_DBG);
+
+	for (int i = 0; i < repeat; i++) {
+		LOG_ERR("test message with arguments %d %d %s", i, 2 * i,
+			"string");
+	}
+
+	cyc = test_helpers_cycle_get();
+
+	while (log_process()) {
+	}
+
+	cyc = test_helpers_cycle_get() - cyc;
+
+	log_backend_disable(&text_backend1);
+	log_backend_disable(&text_backend2);
+
+	PRINT("Processing a message by 2 text backends%s: %u cycles (%u us)\n",
+	      IS_ENABLED(CONFIG_LOG_OUTPUT_FORMAT_CACHE) ?
+			" (format cache)" : "",
+	      cyc / repeat, k_cyc_to_us_ceil32(cyc) / repeat);
+}
+
 /*test case main entry*/
 void test_main(void)
 {
@@ -236,6 +298,7 @@ void test_main(void)
 			 ztest_unit_test(test_log_capacity),
 			 ztest_unit_test(test_log_message_store_time_no_overwrite),
 			 ztest_unit_test(test_log_message_store_time_overwrite),
+			 ztest_unit_test(test_log_message_process_time),
 			 ztest_user_unit_test(test_log_message_store_time_no_overwrite_from_user),
 			 ztest_user_unit_test(test_log_message_with_string)
 			 );
@@ -11,6 +11,8 @@
 
 #include <zephyr/logging/log.h>
 #include <zephyr/logging/log_output.h>
+#include <zephyr/logging/log_backend.h>
+#include <zephyr/logging/log_ctrl.h>
 
 #include <tc_util.h>
 #include <stdbool.h>
@@ -56,12 +58,188 @@ static void test_log_output_empty(void)
 	(void)&log_output;
 }
 
+static uint8_t mock_buffer2[512];
+static uint32_t mock_len2;
+static uint32_t mock_calls2;
+
+static int mock_output_func2(uint8_t *buf, size_t size, void *ctx)
+{
+	memcpy(&mock_buffer2[mock_len2], buf, size);
+	mock_len2 += size;
+	mock_calls2++;
+
+	return size;
+}
+
+static uint8_t log_output_buf2[8];
+LOG_OUTPUT_DEFINE(log_output2, mock_output_func2,
+		  log_output_buf2, sizeof(log_output_buf2));
+
+static uint8_t mock_buffer3[512];
+static uint32_t mock_len3;
+
+static int mock_output_func3(uint8_t *buf, size_t size, void *ctx)
+{
+	memcpy(&mock_buffer3[mock_len3], buf, size);
+	mock_len3 += size;
+
+	return size;
+}
+
+static uint8_t log_output_buf3[8];
+LOG_OUTPUT_DEFINE(log_output3, mock_output_func3,
+		  log_output_buf3, sizeof(log_output_buf3));
+
+#define PREEMPT_STACK_SIZE 1024
+
+static K_THREAD_STACK_DEFINE(preempt_stack, PREEMPT_STACK_SIZE);
+static struct k_thread preempt_thread;
+static K_SEM_DEFINE(preempt_sem, 0, 1);
+static struct log_msg2 *preempt_msg;
+static bool preempt;
+
+/* Higher priority thread formatting the message for another output while
+ * the first output is in the middle of formatting it.
+ */
+static void preempt_entry(void *p1, void *p2, void *p3)
+{
+	while (true) {
+		k_sem_take(&preempt_sem, K_FOREVER);
+		log_output_msg2_process(&log_output3, preempt_msg,
+					LOG_OUTPUT_FLAG_LEVEL);
+	}
+}
+
+static int preempting_output_func(uint8_t *buf, size_t size, void *ctx)
+{
+	if (preempt) {
+		preempt = false;
+		k_sem_give(&preempt_sem);
+	}
+
+	return mock_output_func(buf, size, ctx);
+}
+
+static uint8_t log_output_buf4[8];
+LOG_OUTPUT_DEFINE(log_output4, preempting_output_func,
+		  log_output_buf4, sizeof(log_output_buf4));
+
+static bool use_preempting_output;
+
+/* Backend formatting each message for two outputs */
+static void process(struct log_backend const *const backend,
+		    union log_msg2_generic *msg)
+{
+	uint32_t flags = LOG_OUTPUT_FLAG_LEVEL;
+
+	preempt_msg = &msg->log;
+	log_output_msg2_process(use_preempting_output ?
+				&log_output4 : &log_output, &msg->log, flags);
+	log_output_msg2_process(&log_output2, &msg->log, flags);
+}
+
+static const struct log_backend_api backend_api = {
+	.process = process,
+};
+
+LOG_BACKEND_DEFINE(test_backend, backend_api, false);
+
+static void process_msgs(void)
+{
+	reset_mock_buffer();
+	memset(mock_buffer2, 0, sizeof(mock_buffer2));
+	mock_len2 = 0U;
+	mock_calls2 = 0U;
+
+	while (log_process()) {
+	}
+}
+
+static void test_log_output_format_cache(void)
+{
+	static const char exp_str[] = "<inf> test: test 1\r\n";
+	static const char exp_str2[] = "<inf> test: other test 2\r\n";
+
+	if (!IS_ENABLED(CONFIG_LOG_MODE_DEFERRED)) {
+		ztest_test_skip();
+	}
+
+	log_backend_enable(&test_backend, NULL, LOG_LEVEL_INF);
+
+	LOG_INF("test %d", 1);
+	process_msgs();
+
+	zassert_equal(mock_len, strlen(exp_str), NULL);
+	zassert_mem_equal(mock_buffer, exp_str, mock_len, NULL);
+	zassert_equal(mock_len2, mock_len, NULL);
+	zassert_mem_equal(mock_buffer2, mock_buffer, mock_len, NULL);
+
+	if (IS_ENABLED(CONFIG_LOG_OUTPUT_FORMAT_CACHE)) {
+		/* Copied from the cache instead of formatted again */
+		zassert_equal(mock_calls2, 1, "Message formatted again");
+	}
+
+	/* Cache is not reused for the next message */
+	LOG_INF("other test %d", 2);
+	process_msgs();
+
+	zassert_equal(mock_len2, strlen(exp_str2), NULL);
+	zassert_mem_equal(mock_buffer2, exp_str2, mock_len2, NULL);
+
+	log_backend_disable(&test_backend);
+}
+
+static void test_log_output_format_cache_concurrent(void)
+{
+	static const char exp_str[] = "<inf> test: concurrent test 3\r\n";
+	int prio;
+
+	if (!IS_ENABLED(CONFIG_LOG_MODE_DEFERRED)) {
+		ztest_test_skip();
+	}
+
+	/* Let the formatting be preempted by a higher priority thread */
+	prio = k_thread_priority_get(k_current_get());
+	k_thread_priority_set(k_current_get(), K_PRIO_PREEMPT(5));
+
+	k_thread_create(&preempt_thread, preempt_stack,
+			K_THREAD_STACK_SIZEOF(preempt_stack), preempt_entry,
+			NULL, NULL, NULL, K_PRIO_PREEMPT(4), 0, K_NO_WAIT);
+
+	log_backend_enable(&test_backend, NULL, LOG_LEVEL_INF);
+	use_preempting_output = true;
+	preempt = true;
+	memset(mock_buffer3, 0, sizeof(mock_buffer3));
+	mock_len3 = 0U;
+
+	LOG_INF("concurrent test %d", 3);
+	process_msgs();
+
+	/* The preempting thread formatted the message on its own */
+	zassert_false(preempt, "Formatting was not preempted");
+	zassert_equal(mock_len3, strlen(exp_str), NULL);
+	zassert_mem_equal(mock_buffer3, exp_str, mock_len3, NULL);
+
+	/* Its text is not mixed into the text given to the other output */
+	zassert_equal(mock_len, strlen(exp_str), NULL);
+	zassert_mem_equal(mock_buffer, exp_str, mock_len, NULL);
+	zassert_equal(mock_len2, strlen(exp_str), NULL);
+	zassert_mem_equal(mock_buffer2, exp_str, mock_len2, NULL);
+
+	use_preempting_output = false;
+	log_backend_disable(&test_backend);
+	k_thread_abort(&preempt_thread);
+	k_thread_priority_set(k_current_get(), prio);
+}
+
 /*test case main entry*/
 void test_main(void)
 {
 	ztest_test_suite(test_log_output,
 		ztest_unit_test_setup_teardown(test_log_output_empty,
-					       setup, teardown)
+					       setup, teardown),
+		ztest_unit_test(test_log_output_format_cache),
+		ztest_unit_test(test_log_output_format_cache_concurrent)
 		);
 	ztest_run_test_suite(test_log_output);
 }
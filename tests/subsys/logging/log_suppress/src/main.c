@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Test of rate limiting and deduplication of log messages
+ */
+
+#include <zephyr/zephyr.h>
+#include <ztest.h>
+#include <string.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/logging/log_backend.h>
+#include <zephyr/logging/log_ctrl.h>
+#include <zephyr/logging/log_output.h>
+
+LOG_MODULE_REGISTER(test, LOG_LEVEL_INF);
+
+#define LOOPS 10
+
+static size_t msg_cnt;
+static char out_buf[256];
+static size_t out_len;
+static uint8_t buf;
+
+static int char_out(uint8_t *data, size_t length, void *ctx)
+{
+	size_t len = MIN(length, sizeof(out_buf) - 1 - out_len);
+
+	memcpy(&out_buf[out_len], data, len);
+	out_len += len;
+	out_buf[out_len] = '\0';
+
+	return length;
+}
+
+LOG_OUTPUT_DEFINE(log_output, char_out, &buf, 1);
+
+static void process(const struct log_backend *const backend,
+		    union log_msg2_generic *msg)
+{
+	msg_cnt++;
+	log_output_msg2_process(&log_output, &msg->log, 0);
+}
+
+static void panic(const struct log_backend *const backend)
+{
+	ARG_UNUSED(backend);
+}
+
+static const struct log_backend_api backend_api = {
+	.process = process,
+	.panic = panic,
+};
+
+LOG_BACKEND_DEFINE(test_backend, backend_api, true);
+
+/* Process pending messages and return number of messages since last call. */
+static size_t processed_get(void)
+{
+	size_t cnt;
+
+	while (log_process()) {
+	}
+
+	cnt = msg_cnt;
+	msg_cnt = 0;
+
+	return cnt;
+}
+
+/* Start with fresh intervals and no message being deduplicated. */
+static void reset(void)
+{
+	k_msleep(MAX(CONFIG_LOG_RATELIMIT_INTERVAL_MS,
+		     CONFIG_LOG_DEDUP_TIMEOUT_MS) + 10);
+	LOG_INF("reset");
+	(void)processed_get();
+	out_len = 0;
+	out_buf[0] = '\0';
+}
+
+static void log_two_sites(int loops)
+{
+	for (int i = 0; i < loops; i++) {
+		LOG_INF("first %d", i);
+		LOG_INF("second %d", i);
+	}
+}
+
+static void test_ratelimit(void)
+{
+	uint32_t ratelimited, repeated;
+	uint32_t ratelimited_start, repeated_start;
+
+	reset();
+	zassert_ok(log_suppressed_get(&ratelimited_start, &repeated_start),
+		   NULL);
+
+	/* Call sites are limited independently. */
+	log_two_sites(LOOPS);
+	zassert_equal(processed_get(), 2 * CONFIG_LOG_RATELIMIT_BURST, NULL);
+
+	zassert_ok(log_suppressed_get(&ratelimited, &repeated), NULL);
+	zassert_equal(ratelimited - ratelimited_start,
+		      2 * (LOOPS - CONFIG_LOG_RATELIMIT_BURST), NULL);
+	zassert_equal(repeated, repeated_start, "Unexpected deduplication");
+
+	/* Limit is restored after the interval. */
+	k_msleep(CONFIG_LOG_RATELIMIT_INTERVAL_MS + 10);
+	log_two_sites(1);
+	zassert_equal(processed_get(), 2, NULL);
+}
+
+static void test_ratelimit_set(void)
+{
+	int16_t id = LOG_CURRENT_MODULE_ID();
+	int16_t other = (id == 0) ? 1 : 0;
+
+	zassert_true(log_src_cnt_get(CONFIG_LOG_DOMAIN_ID) > 1, NULL);
+
+	reset();
+	zassert_ok(log_ratelimit_set(CONFIG_LOG_DOMAIN_ID, id, 0), NULL);
+	log_two_sites(LOOPS);
+	zassert_equal(processed_get(), 2 * LOOPS, "Source is limited");
+
+	reset();
+	zassert_ok(log_ratelimit_set(CONFIG_LOG_DOMAIN_ID, id, 1), NULL);
+	log_two_sites(LOOPS);
+	zassert_equal(processed_get(), 2, NULL);
+
+	/* Only one source can have a custom limit. */
+	zassert_equal(log_ratelimit_set(CONFIG_LOG_DOMAIN_ID, other, 0),
+		      -ENOMEM, NULL);
+	zassert_equal(log_ratelimit_set(CONFIG_LOG_DOMAIN_ID, -1, 0),
+		      -EINVAL, NULL);
+	zassert_equal(log_ratelimit_set(CONFIG_LOG_DOMAIN_ID,
+					log_src_cnt_get(CONFIG_LOG_DOMAIN_ID),
+					0),
+		      -EINVAL, NULL);
+
+	/* Setting the default limit releases the entry. */
+	zassert_ok(log_ratelimit_set(CONFIG_LOG_DOMAIN_ID, id,
+				     CONFIG_LOG_RATELIMIT_BURST), NULL);
+	zassert_ok(log_ratelimit_set(CONFIG_LOG_DOMAIN_ID, other, 0), NULL);
+	zassert_ok(log_ratelimit_set(CONFIG_LOG_DOMAIN_ID, other,
+				     CONFIG_LOG_RATELIMIT_BURST), NULL);
+}
+
+static void log_same(int loops)
+{
+	for (int i = 0; i < loops; i++) {
+		LOG_WRN("same %d", i);
+	}
+}
+
+static void test_dedup(void)
+{
+	uint32_t ratelimited, repeated;
+	uint32_t repeated_start;
+
+	reset();
+	zassert_ok(log_suppressed_get(&ratelimited, &repeated_start), NULL);
+
+	log_same(CONFIG_LOG_RATELIMIT_BURST);
+	zassert_equal(processed_get(), 1, NULL);
+	zassert_ok(log_suppressed_get(&ratelimited, &repeated), NULL);
+	zassert_equal(repeated - repeated_start,
+		      CONFIG_LOG_RATELIMIT_BURST - 1, NULL);
+
+	/* Different message reports the repetitions first. */
+	LOG_INF("different");
+	zassert_equal(processed_get(), 2, NULL);
+	zassert_true(strstr(out_buf, "Last message repeated 2 times") != NULL,
+		     "Unexpected output: %s", out_buf);
+	zassert_true(strstr(out_buf, "Last message") <
+		     strstr(out_buf, "different"), "Unexpected order");
+}
+
+static void test_dedup_timeout(void)
+{
+	reset();
+
+	log_same(2);
+	zassert_equal(processed_get(), 1, NULL);
+
+	/* Message is logged again after the timeout. */
+	k_msleep(CONFIG_LOG_DEDUP_TIMEOUT_MS + 10);
+	log_same(1);
+	zassert_equal(processed_get(), 2, NULL);
+	zassert_true(strstr(out_buf, "Last message repeated 1 times") != NULL,
+		     "Unexpected output: %s", out_buf);
+}
+
+static void test_dedup_hexdump(void)
+{
+	uint8_t data[] = { 1, 2, 3 };
+
+	reset();
+
+	for (int i = 0; i < LOOPS; i++) {
+		LOG_HEXDUMP_INF(data, sizeof(data), "data");
+	}
+
+	zassert_equal(processed_get(), 1, NULL);
+}
+
+static void test_panic_flush(void)
+{
+	reset();
+
+	log_same(3);
+	zassert_equal(processed_get(), 1, NULL);
+
+	log_panic();
+	zassert_equal(processed_get(), 1, "Repetitions not reported");
+	zassert_true(strstr(out_buf, "Last message repeated 2 times") != NULL,
+		     "Unexpected output: %s", out_buf);
+}
+
+void test_main(void)
+{
+	ztest_test_suite(test_log_suppress,
+			 ztest_unit_test(test_ratelimit),
+			 ztest_unit_test(test_ratelimit_set),
+			 ztest_unit_test(test_dedup),
+			 ztest_unit_test(test_dedup_timeout),
+			 ztest_unit_test(test_dedup_hexdump),
+			 ztest_unit_test(test_panic_flush));
+	ztest_run_test_suite(test_log_suppress);
+}
@@ -15,6 +15,8 @@
 #include <zephyr/shell/shell.h>
 #include <zephyr/shell/shell_dummy.h>
 
+#include "shell_utils.h"
+
 #define MAX_CMD_SYNTAX_LEN	(11)
 static char dynamic_cmd_buffer[][MAX_CMD_SYNTAX_LEN] = {
 		"dynamic",
@@ -419,6 +421,106 @@ static void test_cmd_dict(void)
 	test_shell_execute_cmd("dict2 two", 4);
 }
 
+static void root_cmd_lookup(void)
+{
+	/* Names next to registered commands in alphabetical order */
+	test_shell_execute_cmd("dict", -ENOEXEC);
+	test_shell_execute_cmd("dict0 one", -ENOEXEC);
+	test_shell_execute_cmd("dict12 one", -ENOEXEC);
+	test_shell_execute_cmd("dumm", -ENOEXEC);
+	test_shell_execute_cmd("dummy0", -ENOEXEC);
+	test_shell_execute_cmd("zzz", -ENOEXEC);
+
+	test_shell_execute_cmd("dict1 one", 1);
+	test_shell_execute_cmd("dict2 one", 2);
+	test_shell_execute_cmd("dummy", 0);
+}
+
+static bool is_prefixed(const struct shell_static_entry *entry,
+			const char *prefix)
+{
+	return strncmp(entry->syntax, prefix, strlen(prefix)) == 0;
+}
+
+static void root_cmd_completion(const char *prefix, size_t exp_cnt,
+				uint16_t exp_longest)
+{
+	const struct shell_static_entry *entry;
+	size_t first = SIZE_MAX;
+	uint16_t longest;
+	size_t cnt;
+
+	z_shell_find_completion_candidates(NULL, prefix, &first, &cnt,
+					   &longest);
+
+	zassert_equal(cnt, exp_cnt, "%s: unexpected count %zu", prefix, cnt);
+	if (cnt == 0) {
+		zassert_equal(first, SIZE_MAX, "%s: first set", prefix);
+		return;
+	}
+
+	zassert_equal(longest, exp_longest, "%s: unexpected longest %u",
+		      prefix, longest);
+
+	/* Candidates are adjacent and the commands around them differ */
+	for (size_t idx = first; idx < first + cnt; idx++) {
+		entry = z_shell_cmd_get(NULL, idx, NULL);
+		zassert_true(is_prefixed(entry, prefix), "%s: %s not expected",
+			     prefix, entry->syntax);
+	}
+
+	if (first > 0) {
+		entry = z_shell_cmd_get(NULL, first - 1, NULL);
+		zassert_false(is_prefixed(entry, prefix), "%s: %s missed",
+			      prefix, entry->syntax);
+	}
+
+	entry = z_shell_cmd_get(NULL, first + cnt, NULL);
+	zassert_true(entry == NULL || !is_prefixed(entry, prefix),
+		     "%s: %s missed", prefix, entry->syntax);
+}
+
+static void root_cmds_complete(void)
+{
+	root_cmd_completion("dict", 2, 5);
+	root_cmd_completion("dict2", 1, 5);
+	root_cmd_completion("dicu", 0, 0);
+	root_cmd_completion("dummy", 1, 5);
+	root_cmd_completion("zzz", 0, 0);
+}
+
+static void test_root_cmd_lookup(void)
+{
+	zassert_true(z_shell_root_cmds_sorted(), "Root commands not sorted");
+
+	root_cmd_lookup();
+}
+
+static void test_root_cmd_completion(void)
+{
+	size_t idx;
+
+	zassert_true(z_shell_root_cmds_sorted(), "Root commands not sorted");
+
+	/* Search starts at the first candidate */
+	idx = z_shell_root_cmd_lower_bound("dict", strlen("dict"));
+	zassert_equal(strcmp(z_shell_cmd_get(NULL, idx, NULL)->syntax, "dict1"),
+		      0, "Unexpected lower bound");
+
+	root_cmds_complete();
+}
+
+static void test_root_cmd_unsorted(void)
+{
+	/* Same results with the linear search used for unsorted commands */
+	z_shell_root_cmds_sorted_set(false);
+
+	root_cmd_lookup();
+	root_cmds_complete();
+
+	z_shell_root_cmds_sorted_set(true);
+}
+
 SHELL_SUBCMD_SET_CREATE(sub_section_cmd, (section_cmd));
 
 static int cmd1_handler(const struct shell *sh, size_t argc, char **argv)
@@ -465,6 +567,9 @@ void test_main(void)
 			ztest_unit_test(test_raw_arg),
 			ztest_unit_test(test_max_argc),
 			ztest_unit_test(test_cmd_dict),
+			ztest_unit_test(test_root_cmd_lookup),
+			ztest_unit_test(test_root_cmd_completion),
+			ztest_unit_test(test_root_cmd_unsorted),
 			ztest_unit_test(test_section_cmd)
 			);
 
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/** @file
+ *  @brief Test of dropping shell output when the transport is stalled
+ */
+
+#include <zephyr/zephyr.h>
+#include <ztest.h>
+
+#include <zephyr/shell/shell.h>
+
+static bool stalled;
+static size_t written;
+
+static int init(const struct shell_transport *transport,
+		const void *config,
+		shell_transport_handler_t evt_handler,
+		void *context)
+{
+	return 0;
+}
+
+static int uninit(const struct shell_transport *transport)
+{
+	return 0;
+}
+
+static int enable(const struct shell_transport *transport, bool blocking)
+{
+	return 0;
+}
+
+/* Transport which does not accept any data when stalled and never reports
+ * that it is ready again, like RTT or USB without a host.
+ */
+static int write(const struct shell_transport *transport,
+		 const void *data, size_t length, size_t *cnt)
+{
+	*cnt = stalled ? 0 : length;
+	written += *cnt;
+
+	return 0;
+}
+
+static int read(const struct shell_transport *transport,
+		void *data, size_t length, size_t *cnt)
+{
+	*cnt = 0;
+
+	return 0;
+}
+
+static const struct shell_transport_api test_transport_api = {
+	.init = init,
+	.uninit = uninit,
+	.enable = enable,
+	.write = write,
+	.read = read
+};
+
+static struct shell_transport test_transport = {
+	.api = &test_transport_api,
+};
+
+SHELL_DEFINE(shell_test, "test:~$ ", &test_transport, 1, 0,
+	     SHELL_FLAG_OLF_CRLF);
+
+static void test_setup(void)
+{
+	static const struct shell_backend_config_flags cfg_flags =
+					SHELL_DEFAULT_BACKEND_CONFIG_FLAGS;
+
+	zassert_ok(shell_init(&shell_test, NULL, cfg_flags, false, 0),
+		   "Cannot initialize shell");
+
+	/* Let the shell thread print the prompt. */
+	k_sleep(K_MSEC(100));
+	zassert_true(written > 0, "Nothing written");
+}
+
+static void test_tx_drop(void)
+{
+	int64_t start;
+
+	shell_test.stats->tx_dropped_cnt = 0;
+	stalled = true;
+
+	/* First write waits for the timeout */
+	start = k_uptime_get();
+	shell_print(&shell_test, "stalled");
+	zassert_true(k_uptime_get() - start >= CONFIG_SHELL_TX_DROP_TIMEOUT,
+		     "Output not waiting for the transport");
+	zassert_true(shell_test.stats->tx_dropped_cnt > 0,
+		     "Dropped output not counted");
+
+	/* Next write is dropped without waiting */
+	start = k_uptime_get();
+	shell_print(&shell_test, "stalled again");
+	zassert_true(k_uptime_get() - start < CONFIG_SHELL_TX_DROP_TIMEOUT,
+		     "Output waiting for stalled transport");
+
+	/* Output is not dropped once the transport accepts data */
+	stalled = false;
+	written = 0;
+	shell_print(&shell_test, "resumed");
+	zassert_true(written > 0, "Output not written");
+}
+
+void test_main(void)
+{
+	ztest_test_suite(shell_tx_drop_test,
+			 ztest_unit_test(test_setup),
+			 ztest_unit_test(test_tx_drop));
+
+	ztest_run_test_suite(shell_tx_drop_test);
+}
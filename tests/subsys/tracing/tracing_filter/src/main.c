@@ -0,0 +1,265 @@
+/*
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Test runtime filtering of tracing events
+ */
+
+#include <ztest.h>
+#include <zephyr/zephyr.h>
+#include <zephyr/tracing/tracing_filter.h>
+#include <tracing_core.h>
+#if defined(CONFIG_TRACING_CTF)
+#include <ctf_top.h>
+#endif
+
+#define LOOPS 4
+
+extern uint8_t ram_tracing[CONFIG_RAM_TRACING_BUFFER_SIZE];
+
+static K_MUTEX_DEFINE(test_mutex);
+static K_SEM_DEFINE(test_sem, 0, 1);
+
+/* Thread which is never traced as it does not run. */
+static void idle_thread(void *p1, void *p2, void *p3)
+{
+}
+
+K_THREAD_DEFINE(other_thread, 512, idle_thread, NULL, NULL, NULL,
+		0, 0, SYS_FOREVER_MS);
+
+static void send_cmd(const char *str)
+{
+	uint8_t cmd[CONFIG_TRACING_CMD_BUFFER_SIZE];
+	size_t len = strlen(str);
+
+	zassert_true(len < sizeof(cmd), "Command too long");
+	memcpy(cmd, str, len + 1);
+	tracing_cmd_handle(cmd, len);
+}
+
+/* Number of events with given name in the RAM backend buffer. */
+static int count(const char *name)
+{
+	size_t len = strlen(name);
+	int cnt = 0;
+
+	for (size_t i = 0; i + len < sizeof(ram_tracing); i++) {
+		if (memcmp(&ram_tracing[i], name, len) == 0 &&
+		    ram_tracing[i + len] == ':') {
+			cnt++;
+		}
+	}
+
+	return cnt;
+}
+
+#if defined(CONFIG_TRACING_CTF)
+/* Number of CTF events with given ID and first field in the RAM backend
+ * buffer.
+ */
+static int count_ctf(uint8_t id, uint32_t field)
+{
+	uint8_t pattern[1 + sizeof(field)];
+	int cnt = 0;
+
+	pattern[0] = id;
+	memcpy(&pattern[1], &field, sizeof(field));
+
+	for (size_t i = 0; i + sizeof(pattern) <= sizeof(ram_tracing); i++) {
+		if (memcmp(&ram_tracing[i], pattern, sizeof(pattern)) == 0) {
+			cnt++;
+		}
+	}
+
+	return cnt;
+}
+#endif
+
+static void mutex_loop(void)
+{
+	send_cmd("enable");
+
+	for (int i = 0; i < LOOPS; i++) {
+		k_mutex_lock(&test_mutex, K_FOREVER);
+		k_mutex_unlock(&test_mutex);
+		k_sem_give(&test_sem);
+		k_sem_take(&test_sem, K_NO_WAIT);
+	}
+
+	send_cmd("disable");
+}
+
+static void test_filter_type(void)
+{
+	int mutex = count("sys_trace_k_mutex_lock_enter");
+	int sem = count("sys_trace_k_sem_give_enter");
+
+	/* Events are counted by name in the test format */
+	if (!IS_ENABLED(CONFIG_TRACING_TEST)) {
+		ztest_test_skip();
+	}
+
+	send_cmd("filter type all off");
+	send_cmd("filter type mutex on");
+	zassert_true(tracing_filter_type_is_enabled(TRACING_FILTER_TYPE_MUTEX),
+		     NULL);
+	zassert_false(tracing_filter_type_is_enabled(TRACING_FILTER_TYPE_SEMAPHORE),
+		      NULL);
+
+	mutex_loop();
+
+	zassert_equal(count("sys_trace_k_mutex_lock_enter") - mutex, LOOPS,
+		      "Mutex events not traced");
+	zassert_equal(count("sys_trace_k_sem_give_enter") - sem, 0,
+		      "Semaphore events traced");
+
+	send_cmd("filter type sem on");
+	mutex_loop();
+
+	zassert_equal(count("sys_trace_k_sem_give_enter") - sem, LOOPS,
+		      "Semaphore events not traced");
+}
+
+static void test_filter_sampling(void)
+{
+	int enter = count("sys_trace_k_mutex_lock_enter");
+	int exit = count("sys_trace_k_mutex_lock_exit");
+	int sem = count("sys_trace_k_sem_give_enter");
+
+	/* Events are counted by name in the test format */
+	if (!IS_ENABLED(CONFIG_TRACING_TEST)) {
+		ztest_test_skip();
+	}
+
+	send_cmd("filter sample mutex 2");
+	zassert_equal(tracing_filter_sampling_get(TRACING_FILTER_TYPE_MUTEX), 2,
+		      NULL);
+
+	mutex_loop();
+
+	/* Every second call of each hook is traced. Hooks are counted
+	 * separately, so the traced enter and exit may be of different calls.
+	 */
+	zassert_equal(count("sys_trace_k_mutex_lock_enter") - enter, LOOPS / 2,
+		      "Unexpected number of events");
+	zassert_equal(count("sys_trace_k_mutex_lock_exit") - exit, LOOPS / 2,
+		      "Unexpected number of events");
+	zassert_equal(count("sys_trace_k_sem_give_enter") - sem, LOOPS,
+		      "Other types sampled");
+
+	send_cmd("filter sample mutex 0");
+	zassert_equal(tracing_filter_sampling_get(TRACING_FILTER_TYPE_MUTEX), 1,
+		      NULL);
+}
+
+static void test_filter_thread(void)
+{
+	int mutex = count("sys_trace_k_mutex_lock_enter");
+
+	/* Events are counted by name in the test format */
+	if (!IS_ENABLED(CONFIG_TRACING_TEST)) {
+		ztest_test_skip();
+	}
+
+	zassert_ok(tracing_filter_thread_add(other_thread), NULL);
+
+	mutex_loop();
+	zassert_equal(count("sys_trace_k_mutex_lock_enter") - mutex, 0,
+		      "Events of other threads traced");
+
+	zassert_ok(tracing_filter_thread_add(k_current_get()), NULL);
+
+	mutex_loop();
+	zassert_equal(count("sys_trace_k_mutex_lock_enter") - mutex, LOOPS,
+		      "Events of the thread not traced");
+
+	zassert_ok(tracing_filter_thread_remove(k_current_get()), NULL);
+	zassert_equal(tracing_filter_thread_remove(k_current_get()), -ENOENT,
+		      NULL);
+
+	send_cmd("filter thread all on");
+
+	mutex_loop();
+	zassert_equal(count("sys_trace_k_mutex_lock_enter") - mutex, 2 * LOOPS,
+		      "Events not traced after clearing the filter");
+}
+
+static void test_filter_event(void)
+{
+	send_cmd("filter event 0x29 off");
+	zassert_false(tracing_filter_event_is_enabled(0x29), NULL);
+	zassert_true(tracing_filter_event_is_enabled(0x28), NULL);
+
+	tracing_filter_event_set(0x29, true);
+	zassert_true(tracing_filter_event_is_enabled(0x29), NULL);
+}
+
+/* Event filter applied to events of the CTF format */
+static void test_filter_ctf_event(void)
+{
+#if defined(CONFIG_TRACING_CTF)
+	uint32_t id = (uint32_t)(uintptr_t)&test_mutex;
+	int enter = count_ctf(CTF_EVENT_MUTEX_LOCK_ENTER, id);
+	int exit = count_ctf(CTF_EVENT_MUTEX_LOCK_EXIT, id);
+
+	tracing_filter_event_set(CTF_EVENT_MUTEX_LOCK_ENTER, false);
+	mutex_loop();
+	tracing_filter_event_set(CTF_EVENT_MUTEX_LOCK_ENTER, true);
+
+	zassert_equal(count_ctf(CTF_EVENT_MUTEX_LOCK_ENTER, id) - enter, 0,
+		      "Disabled event emitted");
+	zassert_equal(count_ctf(CTF_EVENT_MUTEX_LOCK_EXIT, id) - exit, LOOPS,
+		      "Enabled event dropped");
+
+	mutex_loop();
+
+	zassert_equal(count_ctf(CTF_EVENT_MUTEX_LOCK_ENTER, id) - enter, LOOPS,
+		      "Event dropped after enabling it");
+#else
+	ztest_test_skip();
+#endif
+}
+
+static void test_filter_cmd(void)
+{
+	char *type_inval[] = { "type", "foo", "on" };
+	char *sample_inval[] = { "sample", "mutex", "x" };
+	char *event_inval[] = { "event", "300", "off" };
+	char *thread_inval[] = { "thread", "no_such_thread", "on" };
+	char *reset[] = { "reset" };
+
+	zassert_equal(tracing_filter_cmd(ARRAY_SIZE(type_inval), type_inval),
+		      -EINVAL, NULL);
+	zassert_equal(tracing_filter_cmd(ARRAY_SIZE(sample_inval),
+					 sample_inval), -EINVAL, NULL);
+	zassert_equal(tracing_filter_cmd(ARRAY_SIZE(event_inval), event_inval),
+		      -EINVAL, NULL);
+	zassert_equal(tracing_filter_cmd(ARRAY_SIZE(thread_inval),
+					 thread_inval), -ENOENT, NULL);
+
+	send_cmd("filter type all off");
+	send_cmd("filter sample thread 10");
+	zassert_ok(tracing_filter_cmd(ARRAY_SIZE(reset), reset), NULL);
+
+	for (int i = 0; i < TRACING_FILTER_TYPE_COUNT; i++) {
+		zassert_true(tracing_filter_type_is_enabled(i), NULL);
+		zassert_equal(tracing_filter_sampling_get(i), 1, NULL);
+	}
+}
+
+void test_main(void)
+{
+	ztest_test_suite(tracing_filter,
+			 ztest_unit_test(test_filter_type),
+			 ztest_unit_test(test_filter_sampling),
+			 ztest_unit_test(test_filter_thread),
+			 ztest_unit_test(test_filter_event),
+			 ztest_unit_test(test_filter_ctf_event),
+			 ztest_unit_test(test_filter_cmd));
+	ztest_run_test_suite(tracing_filter);
+}
@@ -28,6 +28,7 @@
  */
 #define USE_LIBC 0
 #define USE_PACKAGED 0
+#define USE_STR_OUT 0
 #define CONFIG_CBPRINTF_COMPLETE 1
 #define CONFIG_CBPRINTF_FULL_INTEGRAL 1
 #define CONFIG_CBPRINTF_FP_SUPPORT 1
@@ -106,6 +107,12 @@
 #define PACKAGE_FLAGS CBPRINTF_PACKAGE_ADD_STRING_IDXS
 #endif
 
+#if (VIA_TWISTER & 0x4000) != 0
+#define USE_STR_OUT 1
+#else
+#define USE_STR_OUT 0
+#endif
+
 #endif /* VIA_TWISTER */
 
 /* Can't use IS_ENABLED on symbols that don't start with CONFIG_
@@ -227,6 +234,28 @@ static int out(int c, void *dest)
 	return rv;
 }
 
+static int out_str(const char *str, size_t len, void *dest)
+{
+	struct out_buffer *buf = dest;
+	size_t n = MIN(len, buf->size - buf->idx);
+
+	memcpy(&buf->buf[buf->idx], str, n);
+	buf->idx += n;
+
+	return (n == len) ? 0 : EOF;
+}
+
+/* Route the formatted output through the string callback when testing
+ * that variant.
+ */
+#if USE_STR_OUT
+#define OUT_VPRINTF(_ctx, _fmt, _ap) cbvprintf_str(out_str, _ctx, _fmt, _ap)
+#define OUT_PPRINTF(_ctx, _pkg) cbpprintf_str(out_str, _ctx, _pkg)
+#else
+#define OUT_VPRINTF(_ctx, _fmt, _ap) cbvprintf(out, _ctx, _fmt, _ap)
+#define OUT_PPRINTF(_ctx, _pkg) cbpprintf(out, _ctx, _pkg)
+#endif
+
 __printf_like(2, 3)
 static int prf(char *static_package_str, const char *format, ...)
 {
@@ -241,13 +270,13 @@ static int prf(char *static_package_str, const char *format, ...)
 #if USE_PACKAGED
 	rv = cbvprintf_package(packaged, sizeof(packaged), PACKAGE_FLAGS, format, ap);
 	if (rv >= 0) {
-		rv = cbpprintf(out, &outbuf, packaged);
+		rv = OUT_PPRINTF(&outbuf, packaged);
 		if (rv == 0 && static_package_str) {
 			rv = strcmp(static_package_str, outbuf.buf);
 		}
 	}
 #else
-	rv = cbvprintf(out, &outbuf, format, ap);
+	rv = OUT_VPRINTF(&outbuf, format, ap);
 #endif
 	outbuf_null_terminate(&outbuf);
 #endif
@@ -276,10 +305,10 @@ static int rawprf(const char *format, ...)
 		rv = len;
 	}
 	if (rv >= 0) {
-		rv = cbpprintf(out, &outbuf, pkg_buf);
+		rv = OUT_PPRINTF(&outbuf, pkg_buf);
 	}
 #else
-	rv = cbvprintf(out, &outbuf, format, ap);
+	rv = OUT_VPRINTF(&outbuf, format, ap);
 #endif
 	va_end(ap);
 
@@ -313,7 +342,7 @@ static int rawprf(const char *format, ...)
 					st_pkg_rv, PKG_ALIGN_OFFSET, \
 					PACKAGE_FLAGS, _fmt, __VA_ARGS__); \
 		zassert_equal(st_pkg_rv, _len, NULL); \
-		rv = cbpprintf(out, &package_buf, &package[PKG_ALIGN_OFFSET]); \
+		rv = OUT_PPRINTF(&package_buf, &package[PKG_ALIGN_OFFSET]); \
 		if (rv >= 0) { \
 			sp_buf = _buf; \
 		} \
@@ -1197,6 +1226,61 @@ static void test_libc_substs(void)
 	}
 }
 
+static size_t str_out_calls;
+
+static int out_str_counter(const char *str, size_t len, void *ctx)
+{
+	++str_out_calls;
+	return out_str(str, len, ctx);
+}
+
+static int str_prf(const char *format, ...)
+{
+	va_list ap;
+	int rv;
+
+	va_start(ap, format);
+	rv = cbvprintf_str(out_str_counter, &outbuf, format, ap);
+	va_end(ap);
+
+	return rv;
+}
+
+static void test_str_out(void)
+{
+	static const char fmt[] = "value %d of %s:%8x end";
+	static const char expected[] = "value -42 of some string:   cafe0 end";
+	char cbuf[sizeof(buf)];
+	int rc, str_rc;
+
+	reset_out();
+	rc = cbprintf(out, &outbuf, fmt, -42, "some string", 0xcafe0);
+	outbuf_null_terminate(&outbuf);
+	zassert_equal(strcmp(buf, expected), 0, "Got %s", buf);
+	strcpy(cbuf, buf);
+
+	reset_out();
+	str_out_calls = 0;
+	str_rc = str_prf(fmt, -42, "some string", 0xcafe0);
+	outbuf_null_terminate(&outbuf);
+
+	zassert_equal(str_rc, rc, "rc %d", str_rc);
+	zassert_equal(strcmp(buf, cbuf), 0, "Got %s", buf);
+
+	/* Text is emitted in runs, not one character per call */
+	zassert_true(str_out_calls < (sizeof(expected) - 1) / 2,
+		     "%zu calls", str_out_calls);
+
+	if (!IS_ENABLED(CONFIG_CBPRINTF_NANO)) {
+		/* Callback errors are returned */
+		reset_out();
+		outbuf.size = 10;
+		rc = str_prf(fmt, -42, "some string", 0xcafe0);
+		zassert_equal(rc, EOF, "rc %d", rc);
+		zassert_equal(strncmp(buf, expected, 10), 0, NULL);
+	}
+}
+
 static void test_cbprintf_package(void)
 {
 	if (!ENABLED_USE_PACKAGED) {
@@ -1466,6 +1550,7 @@ void test_main(void)
 			 ztest_unit_test(test_n),
 			 ztest_unit_test(test_p),
 			 ztest_unit_test(test_libc_substs),
+			 ztest_unit_test(test_str_out),
 			 ztest_unit_test(test_cbprintf_package),
 			 ztest_unit_test(test_cbpprintf),
 			 ztest_unit_test(test_cbprintf_package_rw_string_indexes),